@@ -0,0 +1,1080 @@
+/**
+ * @file xf_osal_bench.c
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_osal_bench.h"
+
+/* ==================== [Defines] =========================================== */
+
+#define BENCH_MAX_THREADS       (4U)
+#define BENCH_CONTENDERS        (4U)
+#define BENCH_QUEUE_LEN         (8U)
+#define BENCH_MSG_SIZE_MAX      (256U)
+#define BENCH_EVENT_FLAG        (0x01U)
+#define BENCH_SELECT_QUEUES     (4U)
+#define BENCH_TRACE_CALIBRATE   (8U)
+#define BENCH_AFFINITY_WORDS    (1024U)
+
+/* ==================== [Typedefs] ========================================== */
+
+typedef struct _bench_pair_t {
+    xf_osal_semaphore_t ping;
+    xf_osal_semaphore_t pong;
+} bench_pair_t;
+
+#if XF_OSAL_LWSEM_IS_ENABLE
+typedef struct _bench_lwsem_pair_t {
+    xf_osal_lwsem_t     ping;
+    xf_osal_lwsem_t     pong;
+} bench_lwsem_pair_t;
+#endif
+
+/* 两个线程交替写、读同一块缓冲区，数据是否留在同一个核的缓存中取决于二者的核掩码 */
+typedef struct _bench_affinity_t {
+    xf_osal_semaphore_t ping;
+    xf_osal_semaphore_t pong;
+    uint32_t            buf[BENCH_AFFINITY_WORDS];
+    volatile uint32_t   sum;
+} bench_affinity_t;
+
+typedef struct _bench_queue_t {
+    xf_osal_queue_t     queue;
+    uint32_t            msg_size;
+} bench_queue_t;
+
+#if XF_OSAL_SELECT_IS_ENABLE
+typedef struct _bench_select_t {
+    xf_osal_queue_t     queues[BENCH_SELECT_QUEUES];
+    xf_osal_select_t    set;
+    uint32_t            polling;    /* 消费者轮询各队列而不使用 set */
+} bench_select_t;
+#endif
+
+/* ==================== [Static Prototypes] ================================= */
+
+static xf_err_t bench_yield(xf_osal_bench_print_t print);
+static xf_err_t bench_semaphore(xf_osal_bench_print_t print);
+#if XF_OSAL_LWSEM_IS_ENABLE
+static xf_err_t bench_lwsem(xf_osal_bench_print_t print);
+#endif
+static xf_err_t bench_uncontended(xf_osal_bench_print_t print);
+static xf_err_t bench_create_delete(xf_osal_bench_print_t print);
+static xf_err_t bench_affinity(xf_osal_bench_print_t print);
+static xf_err_t bench_mutex_contended(xf_osal_bench_print_t print);
+static xf_err_t bench_queue(xf_osal_bench_print_t print);
+#if XF_OSAL_SELECT_IS_ENABLE
+static xf_err_t bench_select(xf_osal_bench_print_t print);
+#endif
+static xf_err_t bench_event_latency(xf_osal_bench_print_t print);
+static xf_err_t bench_timer_jitter(xf_osal_bench_print_t print);
+#if XF_OSAL_TRACE_IS_ENABLE
+static xf_err_t bench_trace(xf_osal_bench_print_t print);
+#endif
+
+static void yield_thread(void *argument);
+static void ping_thread(void *argument);
+static void pong_thread(void *argument);
+#if XF_OSAL_LWSEM_IS_ENABLE
+static void lwsem_ping_thread(void *argument);
+static void lwsem_pong_thread(void *argument);
+#endif
+static void affinity_writer_thread(void *argument);
+static void affinity_reader_thread(void *argument);
+static void contend_thread(void *argument);
+static void producer_thread(void *argument);
+static void consumer_thread(void *argument);
+#if XF_OSAL_SELECT_IS_ENABLE
+static void select_producer_thread(void *argument);
+static void select_consumer_thread(void *argument);
+#endif
+static void event_wait_thread(void *argument);
+static void event_set_thread(void *argument);
+static void jitter_timer_cb(void *argument);
+
+static xf_err_t bench_spawn(xf_osal_thread_func_t func, void *arg, xf_osal_priority_t priority);
+static xf_err_t bench_spawn_on(xf_osal_thread_func_t func, void *arg, xf_osal_priority_t priority, uint32_t mask);
+static uint32_t bench_go(uint32_t threads);
+static xf_err_t bench_wait(uint32_t threads);
+static void bench_begin(void);
+static void bench_finish(void);
+static uint64_t bench_to_ns(uint64_t ts);
+static void bench_report_ops(xf_osal_bench_print_t print, const char *name, uint32_t threads,
+                             uint32_t msg_size, uint32_t ops, uint32_t elapsed);
+static void bench_report_samples(xf_osal_bench_print_t print, const char *name, uint32_t period, uint32_t count);
+
+/* ==================== [Static Variables] ================================== */
+
+static xf_osal_bench_print_t s_print;
+
+/* 测量线程阻塞在 s_start 上，由 bench_go() 同时放行；结束时释放 s_done */
+static xf_osal_semaphore_t s_start;
+static xf_osal_semaphore_t s_done;
+static xf_osal_mutex_t s_mutex;
+
+/* 最后一个结束的测量线程写入的时间戳 */
+static volatile uint32_t s_end;
+static volatile uint32_t s_set_ts;
+static volatile uint32_t s_timer_count;
+
+static uint32_t s_samples[XF_OSAL_BENCH_SAMPLES + 1U];
+
+/* ==================== [Macros] ============================================ */
+
+#define BENCH_TS()              ((uint32_t)XF_OSAL_BENCH_TIMESTAMP())
+
+/* ==================== [Global Functions] ================================== */
+
+xf_err_t xf_osal_bench_run(xf_osal_bench_print_t print)
+{
+    xf_err_t (*const benches[])(xf_osal_bench_print_t) = {
+        bench_yield,
+        bench_semaphore,
+#if XF_OSAL_LWSEM_IS_ENABLE
+        bench_lwsem,
+#endif
+        bench_uncontended,
+        bench_create_delete,
+        bench_affinity,
+        bench_mutex_contended,
+        bench_queue,
+#if XF_OSAL_SELECT_IS_ENABLE
+        bench_select,
+#endif
+        bench_event_latency,
+        bench_timer_jitter,
+#if XF_OSAL_TRACE_IS_ENABLE
+        bench_trace,
+#endif
+    };
+    xf_err_t err = XF_OK;
+    uint32_t i;
+
+    if (print == NULL) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    s_print = print;
+
+    /* 比较不同配置的结果时据此区分 */
+    print("{\"bench\":\"config\",\"inline\":%d,\"check_args\":%d,\"trace\":%d,"
+          "\"semaphore_pool\":%d,\"mutex_pool\":%d,\"event_pool\":%d}\n",
+          XF_OSAL_INLINE_IS_ENABLE, XF_OSAL_CHECK_ARGS_IS_ENABLE, XF_OSAL_TRACE_IS_ENABLE,
+          (int)XF_OSAL_SEMAPHORE_POOL_SIZE, (int)XF_OSAL_MUTEX_POOL_SIZE, (int)XF_OSAL_EVENT_POOL_SIZE);
+
+    s_start = xf_osal_semaphore_create(BENCH_MAX_THREADS, 0U, NULL);
+    s_done  = xf_osal_semaphore_create(BENCH_MAX_THREADS, 0U, NULL);
+    if ((s_start == NULL) || (s_done == NULL)) {
+        err = XF_ERR_NO_MEM;
+    }
+
+    for (i = 0U; (err == XF_OK) && (i < (sizeof(benches) / sizeof(benches[0]))); i++) {
+        err = benches[i](print);
+    }
+
+    /* 超时时测量线程可能仍在使用信号量，不能删除 */
+    if (err != XF_ERR_TIMEOUT) {
+        if (s_start != NULL) {
+            xf_osal_semaphore_delete(s_start);
+        }
+        if (s_done != NULL) {
+            xf_osal_semaphore_delete(s_done);
+        }
+    }
+
+    return err;
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static xf_err_t bench_yield(xf_osal_bench_print_t print)
+{
+    uint32_t t0;
+    xf_err_t err;
+
+    err = bench_spawn(yield_thread, NULL, XF_OSAL_BENCH_PRIORITY);
+    if (err == XF_OK) {
+        err = bench_spawn(yield_thread, NULL, XF_OSAL_BENCH_PRIORITY);
+        if (err != XF_OK) {
+            /* 放行已创建的线程，让它自行结束 */
+            (void)bench_go(1U);
+            (void)bench_wait(1U);
+        }
+    }
+    if (err != XF_OK) {
+        return err;
+    }
+
+    t0 = bench_go(2U);
+    err = bench_wait(2U);
+    if (err == XF_OK) {
+        bench_report_ops(print, "yield", 2U, 0U, 2U * XF_OSAL_BENCH_ITERATIONS, s_end - t0);
+    }
+
+    return err;
+}
+
+static xf_err_t bench_semaphore(xf_osal_bench_print_t print)
+{
+    static bench_pair_t pair;
+    uint32_t t0;
+    xf_err_t err;
+
+    pair.ping = xf_osal_semaphore_create(1U, 0U, NULL);
+    pair.pong = xf_osal_semaphore_create(1U, 0U, NULL);
+    err = ((pair.ping != NULL) && (pair.pong != NULL)) ? XF_OK : XF_ERR_NO_MEM;
+
+    if (err == XF_OK) {
+        err = bench_spawn(pong_thread, &pair, XF_OSAL_BENCH_PRIORITY);
+    }
+    if (err == XF_OK) {
+        /* 创建失败时 pong 线程会一直等待 ping, 只能留给调用者处理 */
+        err = bench_spawn(ping_thread, &pair, XF_OSAL_BENCH_PRIORITY);
+        if (err != XF_OK) {
+            return err;
+        }
+
+        t0 = bench_go(2U);
+        err = bench_wait(2U);
+        if (err != XF_OK) {
+            return err;
+        }
+        bench_report_ops(print, "semaphore", 2U, 0U, XF_OSAL_BENCH_ITERATIONS, s_end - t0);
+    }
+
+    if (pair.ping != NULL) {
+        xf_osal_semaphore_delete(pair.ping);
+    }
+    if (pair.pong != NULL) {
+        xf_osal_semaphore_delete(pair.pong);
+    }
+
+    return err;
+}
+
+#if XF_OSAL_LWSEM_IS_ENABLE
+/* 与 bench_semaphore 相同的往返，另测无竞争时不进入内核的快速路径 */
+static xf_err_t bench_lwsem(xf_osal_bench_print_t print)
+{
+    static bench_lwsem_pair_t pair;
+    uint32_t t0;
+    uint32_t i;
+    xf_err_t err;
+
+    err = xf_osal_lwsem_init(&pair.ping, 1U, 0U);
+    if (err != XF_OK) {
+        return err;
+    }
+    err = xf_osal_lwsem_init(&pair.pong, 1U, 0U);
+    if (err != XF_OK) {
+        xf_osal_lwsem_deinit(&pair.ping);
+        return err;
+    }
+
+    t0 = BENCH_TS();
+    for (i = 0U; i < XF_OSAL_BENCH_ITERATIONS; i++) {
+        xf_osal_lwsem_release(&pair.ping);
+        xf_osal_lwsem_acquire(&pair.ping, 0U);
+    }
+    bench_report_ops(print, "lwsem_uncontended", 1U, 0U, XF_OSAL_BENCH_ITERATIONS, BENCH_TS() - t0);
+
+    err = bench_spawn(lwsem_pong_thread, &pair, XF_OSAL_BENCH_PRIORITY);
+    if (err == XF_OK) {
+        /* 创建失败时 pong 线程会一直等待 ping, 只能留给调用者处理 */
+        err = bench_spawn(lwsem_ping_thread, &pair, XF_OSAL_BENCH_PRIORITY);
+        if (err != XF_OK) {
+            return err;
+        }
+
+        t0 = bench_go(2U);
+        err = bench_wait(2U);
+        if (err != XF_OK) {
+            return err;
+        }
+        bench_report_ops(print, "lwsem", 2U, 0U, XF_OSAL_BENCH_ITERATIONS, s_end - t0);
+    }
+
+    xf_osal_lwsem_deinit(&pair.ping);
+    xf_osal_lwsem_deinit(&pair.pong);
+
+    return err;
+}
+#endif
+
+/* 单线程、从不阻塞的快速路径，开启 XF_OSAL_INLINE_ENABLE 前后的差别主要体现在这里 */
+static xf_err_t bench_uncontended(xf_osal_bench_print_t print)
+{
+    uint8_t msg[4] = { 0 };
+    xf_osal_semaphore_t sem;
+    xf_osal_mutex_t mutex;
+    xf_osal_queue_t queue;
+    uint32_t t0;
+    uint32_t i;
+    xf_err_t err = XF_OK;
+
+    sem   = xf_osal_semaphore_create(1U, 0U, NULL);
+    mutex = xf_osal_mutex_create(NULL);
+    queue = xf_osal_queue_create(1U, sizeof(msg), NULL);
+
+    if ((sem == NULL) || (mutex == NULL) || (queue == NULL)) {
+        err = XF_ERR_NO_MEM;
+    } else {
+        t0 = BENCH_TS();
+        for (i = 0U; i < XF_OSAL_BENCH_ITERATIONS; i++) {
+            xf_osal_semaphore_release(sem);
+            xf_osal_semaphore_acquire(sem, 0U);
+        }
+        bench_report_ops(print, "semaphore_uncontended", 1U, 0U, XF_OSAL_BENCH_ITERATIONS, BENCH_TS() - t0);
+
+        t0 = BENCH_TS();
+        for (i = 0U; i < XF_OSAL_BENCH_ITERATIONS; i++) {
+            xf_osal_mutex_acquire(mutex, XF_OSAL_WAIT_FOREVER);
+            xf_osal_mutex_release(mutex);
+        }
+        bench_report_ops(print, "mutex_uncontended", 1U, 0U, XF_OSAL_BENCH_ITERATIONS, BENCH_TS() - t0);
+
+        t0 = BENCH_TS();
+        for (i = 0U; i < XF_OSAL_BENCH_ITERATIONS; i++) {
+            xf_osal_queue_put(queue, msg, 0U, 0U);
+            xf_osal_queue_get(queue, msg, NULL, 0U);
+        }
+        bench_report_ops(print, "queue_uncontended", 1U, sizeof(msg), XF_OSAL_BENCH_ITERATIONS, BENCH_TS() - t0);
+    }
+
+    if (sem != NULL) {
+        xf_osal_semaphore_delete(sem);
+    }
+    if (mutex != NULL) {
+        xf_osal_mutex_delete(mutex);
+    }
+    if (queue != NULL) {
+        xf_osal_queue_delete(queue);
+    }
+
+    return err;
+}
+
+/* 单线程反复创建、删除同一类对象，配置 XF_OSAL_*_POOL_SIZE 时控制块来自对象池而不是堆 */
+static xf_err_t bench_create_delete(xf_osal_bench_print_t print)
+{
+    xf_osal_semaphore_t sem;
+    xf_osal_mutex_t mutex;
+    xf_osal_event_t event;
+    uint32_t t0;
+    uint32_t i;
+
+    t0 = BENCH_TS();
+    for (i = 0U; i < XF_OSAL_BENCH_ITERATIONS; i++) {
+        sem = xf_osal_semaphore_create(1U, 0U, NULL);
+        if (sem == NULL) {
+            return XF_ERR_NO_MEM;
+        }
+        xf_osal_semaphore_delete(sem);
+    }
+    bench_report_ops(print, "semaphore_create_delete", 1U, 0U, XF_OSAL_BENCH_ITERATIONS, BENCH_TS() - t0);
+
+    t0 = BENCH_TS();
+    for (i = 0U; i < XF_OSAL_BENCH_ITERATIONS; i++) {
+        mutex = xf_osal_mutex_create(NULL);
+        if (mutex == NULL) {
+            return XF_ERR_NO_MEM;
+        }
+        xf_osal_mutex_delete(mutex);
+    }
+    bench_report_ops(print, "mutex_create_delete", 1U, 0U, XF_OSAL_BENCH_ITERATIONS, BENCH_TS() - t0);
+
+    t0 = BENCH_TS();
+    for (i = 0U; i < XF_OSAL_BENCH_ITERATIONS; i++) {
+        event = xf_osal_event_create(NULL);
+        if (event == NULL) {
+            return XF_ERR_NO_MEM;
+        }
+        xf_osal_event_delete(event);
+    }
+    bench_report_ops(print, "event_create_delete", 1U, 0U, XF_OSAL_BENCH_ITERATIONS, BENCH_TS() - t0);
+
+    return XF_OK;
+}
+
+/*
+ * 写线程每轮改写整块缓冲区后交给读线程求和：两线程固定在同一个核、固定在不同核、不限制，
+ * 比较每轮的时间即缓存局部性的收益。单核系统上三者没有区别，只输出核数。
+ */
+static xf_err_t bench_affinity(xf_osal_bench_print_t print)
+{
+    static bench_affinity_t ctx;
+    static const struct {
+        const char *name;
+        uint32_t    writer;
+        uint32_t    reader;
+    } modes[] = {
+        { "affinity_same_core",  0x01U, 0x01U },
+        { "affinity_cross_core", 0x01U, 0x02U },
+        { "affinity_unpinned",   0x00U, 0x00U },
+    };
+    uint32_t cores = 0U;
+    uint32_t t0;
+    uint32_t i;
+    xf_err_t err;
+
+    err = xf_osal_thread_get_affinity(xf_osal_thread_get_current(), &cores);
+    if ((err != XF_OK) || ((cores & (cores - 1U)) == 0U)) {
+        print("{\"bench\":\"affinity\",\"cores\":1}\n");
+        return XF_OK;
+    }
+
+    ctx.ping = xf_osal_semaphore_create(1U, 0U, NULL);
+    ctx.pong = xf_osal_semaphore_create(1U, 0U, NULL);
+    err = ((ctx.ping != NULL) && (ctx.pong != NULL)) ? XF_OK : XF_ERR_NO_MEM;
+
+    for (i = 0U; (err == XF_OK) && (i < (sizeof(modes) / sizeof(modes[0]))); i++) {
+        err = bench_spawn_on(affinity_reader_thread, &ctx, XF_OSAL_BENCH_PRIORITY, modes[i].reader);
+        if (err != XF_OK) {
+            break;
+        }
+        /* 创建失败时读线程会一直等待，只能留给调用者处理 */
+        err = bench_spawn_on(affinity_writer_thread, &ctx, XF_OSAL_BENCH_PRIORITY, modes[i].writer);
+        if (err != XF_OK) {
+            return err;
+        }
+
+        t0 = bench_go(2U);
+        err = bench_wait(2U);
+        if (err != XF_OK) {
+            return err;
+        }
+        bench_report_ops(print, modes[i].name, 2U, sizeof(ctx.buf), XF_OSAL_BENCH_ITERATIONS, s_end - t0);
+    }
+
+    if (ctx.ping != NULL) {
+        xf_osal_semaphore_delete(ctx.ping);
+    }
+    if (ctx.pong != NULL) {
+        xf_osal_semaphore_delete(ctx.pong);
+    }
+
+    return err;
+}
+
+static xf_err_t bench_mutex_contended(xf_osal_bench_print_t print)
+{
+    uint32_t spawned = 0U;
+    uint32_t t0;
+    xf_err_t err = XF_OK;
+
+    s_mutex = xf_osal_mutex_create(NULL);
+    if (s_mutex == NULL) {
+        return XF_ERR_NO_MEM;
+    }
+
+    while ((err == XF_OK) && (spawned < BENCH_CONTENDERS)) {
+        err = bench_spawn(contend_thread, NULL, XF_OSAL_BENCH_PRIORITY);
+        if (err == XF_OK) {
+            spawned++;
+        }
+    }
+
+    t0 = bench_go(spawned);
+    if (bench_wait(spawned) != XF_OK) {
+        return XF_ERR_TIMEOUT;
+    }
+    if (err == XF_OK) {
+        bench_report_ops(print, "mutex_contended", BENCH_CONTENDERS, 0U,
+                         (XF_OSAL_BENCH_ITERATIONS / BENCH_CONTENDERS) * BENCH_CONTENDERS, s_end - t0);
+    }
+
+    xf_osal_mutex_delete(s_mutex);
+
+    return err;
+}
+
+static xf_err_t bench_queue(xf_osal_bench_print_t print)
+{
+    static const uint32_t sizes[] = { 4U, 16U, 64U, BENCH_MSG_SIZE_MAX };
+    static bench_queue_t ctx;
+    uint32_t t0;
+    uint32_t i;
+    xf_err_t err = XF_OK;
+
+    for (i = 0U; (err == XF_OK) && (i < (sizeof(sizes) / sizeof(sizes[0]))); i++) {
+        ctx.msg_size = sizes[i];
+        ctx.queue = xf_osal_queue_create(BENCH_QUEUE_LEN, ctx.msg_size, NULL);
+        if (ctx.queue == NULL) {
+            return XF_ERR_NO_MEM;
+        }
+
+        err = bench_spawn(consumer_thread, &ctx, XF_OSAL_BENCH_PRIORITY);
+        if (err == XF_OK) {
+            err = bench_spawn(producer_thread, &ctx, XF_OSAL_BENCH_PRIORITY);
+            if (err != XF_OK) {
+                /* 消费者会一直等待消息，只能留给调用者处理 */
+                return err;
+            }
+        }
+        if (err != XF_OK) {
+            xf_osal_queue_delete(ctx.queue);
+            return err;
+        }
+
+        t0 = bench_go(2U);
+        err = bench_wait(2U);
+        if (err != XF_OK) {
+            return err;
+        }
+        bench_report_ops(print, "queue", 2U, ctx.msg_size, XF_OSAL_BENCH_ITERATIONS, s_end - t0);
+
+        xf_osal_queue_delete(ctx.queue);
+    }
+
+    return err;
+}
+
+#if XF_OSAL_SELECT_IS_ENABLE
+/* 生产者轮流向多个队列放入消息，消费者用 xf_osal_select() 等待，或者轮询各队列、都为空时让出 */
+static xf_err_t bench_select(xf_osal_bench_print_t print)
+{
+    static bench_select_t ctx;
+    uint32_t t0;
+    uint32_t i;
+    xf_err_t err = XF_OK;
+
+    ctx.set = xf_osal_select_create(BENCH_SELECT_QUEUES * BENCH_QUEUE_LEN, NULL);
+    if (ctx.set == NULL) {
+        err = XF_ERR_NO_MEM;
+    }
+    for (i = 0U; i < BENCH_SELECT_QUEUES; i++) {
+        ctx.queues[i] = xf_osal_queue_create(BENCH_QUEUE_LEN, sizeof(uint32_t), NULL);
+        if (ctx.queues[i] == NULL) {
+            err = XF_ERR_NO_MEM;
+        } else if (err == XF_OK) {
+            err = xf_osal_select_add_queue(ctx.set, ctx.queues[i]);
+        }
+    }
+
+    for (ctx.polling = 0U; (err == XF_OK) && (ctx.polling < 2U); ctx.polling++) {
+        err = bench_spawn(select_consumer_thread, &ctx, XF_OSAL_BENCH_PRIORITY);
+        if (err != XF_OK) {
+            break;
+        }
+        err = bench_spawn(select_producer_thread, &ctx, XF_OSAL_BENCH_PRIORITY);
+        if (err != XF_OK) {
+            /* 消费者会一直等待消息，只能留给调用者处理 */
+            return err;
+        }
+
+        t0 = bench_go(2U);
+        err = bench_wait(2U);
+        if (err != XF_OK) {
+            return err;
+        }
+        bench_report_ops(print, (ctx.polling == 0U) ? "select" : "select_polling", 2U, 0U,
+                         XF_OSAL_BENCH_ITERATIONS, s_end - t0);
+    }
+
+    for (i = 0U; i < BENCH_SELECT_QUEUES; i++) {
+        if (ctx.queues[i] != NULL) {
+            if (ctx.set != NULL) {
+                (void)xf_osal_select_remove(ctx.set, ctx.queues[i]);
+            }
+            xf_osal_queue_delete(ctx.queues[i]);
+        }
+    }
+    if (ctx.set != NULL) {
+        xf_osal_select_delete(ctx.set);
+    }
+
+    return err;
+}
+#endif
+
+static xf_err_t bench_event_latency(xf_osal_bench_print_t print)
+{
+    xf_osal_event_t event;
+    xf_err_t err;
+
+    event = xf_osal_event_create(NULL);
+    if (event == NULL) {
+        return XF_ERR_NO_MEM;
+    }
+
+    /* 等待线程优先级更高，xf_osal_event_set() 返回前就会切换过去 */
+    err = bench_spawn(event_wait_thread, event, (xf_osal_priority_t)(XF_OSAL_BENCH_PRIORITY + 1));
+    if (err == XF_OK) {
+        err = bench_spawn(event_set_thread, event, XF_OSAL_BENCH_PRIORITY);
+        if (err != XF_OK) {
+            return err;
+        }
+    }
+    if (err != XF_OK) {
+        xf_osal_event_delete(event);
+        return err;
+    }
+
+    (void)bench_go(2U);
+    err = bench_wait(2U);
+    if (err != XF_OK) {
+        return err;
+    }
+    bench_report_samples(print, "event_latency", 0U, XF_OSAL_BENCH_SAMPLES);
+
+    xf_osal_event_delete(event);
+
+    return XF_OK;
+}
+
+static xf_err_t bench_timer_jitter(xf_osal_bench_print_t print)
+{
+    xf_osal_timer_t timer;
+    uint32_t period;
+    uint32_t delta;
+    uint32_t i;
+    xf_err_t err;
+
+    timer = xf_osal_timer_create(jitter_timer_cb, XF_OSAL_TIMER_PERIODIC, NULL, NULL);
+    if (timer == NULL) {
+        return XF_ERR_NO_MEM;
+    }
+
+    s_timer_count = 0U;
+    err = xf_osal_timer_start(timer, XF_OSAL_BENCH_TIMER_PERIOD);
+    if (err == XF_OK) {
+        err = bench_wait(1U);
+        xf_osal_timer_stop(timer);
+    }
+    xf_osal_timer_delete(timer);
+    if (err != XF_OK) {
+        return err;
+    }
+
+    /* 相邻两次回调的间隔与周期之差的绝对值 */
+    period = (uint32_t)(((uint64_t)XF_OSAL_BENCH_TIMER_PERIOD * XF_OSAL_BENCH_TIMESTAMP_FREQ())
+                        / xf_osal_kernel_get_tick_freq());
+    for (i = 0U; i < XF_OSAL_BENCH_SAMPLES; i++) {
+        delta = s_samples[i + 1U] - s_samples[i];
+        s_samples[i] = (delta >= period) ? (delta - period) : (period - delta);
+    }
+    bench_report_samples(print, "timer_jitter", period, XF_OSAL_BENCH_SAMPLES);
+
+    return XF_OK;
+}
+
+/* ==================== [Threads] =========================================== */
+
+#if XF_OSAL_TRACE_IS_ENABLE
+/*
+ * 每条跟踪记录的开销：xf_osal_trace_calibrate() 的结果取多次中的最小值，排除偶发的抢占；
+ * 另以记录开启、关闭时同一段不阻塞的 release / acquire 之差交叉验证。
+ */
+static xf_err_t bench_trace(xf_osal_bench_print_t print)
+{
+    xf_osal_semaphore_t sem;
+    uint32_t elapsed[2];
+    uint32_t overhead = UINT32_MAX;
+    uint32_t value;
+    uint64_t calibrate_ns;
+    uint64_t per_event_ns;
+    uint32_t t0;
+    uint32_t run;
+    uint32_t i;
+
+    sem = xf_osal_semaphore_create(1U, 0U, NULL);
+    if (sem == NULL) {
+        return XF_ERR_NO_MEM;
+    }
+
+    xf_osal_trace_stop();
+    for (i = 0U; i < BENCH_TRACE_CALIBRATE; i++) {
+        value = xf_osal_trace_calibrate();
+        if (value < overhead) {
+            overhead = value;
+        }
+    }
+    calibrate_ns = ((uint64_t)overhead * 1000000000ULL) / XF_OSAL_TRACE_TIMESTAMP_FREQ();
+
+    /* run 为 0 时不记录，为 1 时每次调用写入一条记录 */
+    for (run = 0U; run < 2U; run++) {
+        if (run != 0U) {
+            xf_osal_trace_start();
+        }
+        t0 = BENCH_TS();
+        for (i = 0U; i < XF_OSAL_BENCH_ITERATIONS; i++) {
+            xf_osal_semaphore_release(sem);
+            xf_osal_semaphore_acquire(sem, 0U);
+        }
+        elapsed[run] = BENCH_TS() - t0;
+    }
+    xf_osal_trace_stop();
+    xf_osal_trace_reset();
+    xf_osal_semaphore_delete(sem);
+
+    per_event_ns = (elapsed[1] > elapsed[0]) ?
+                   (bench_to_ns(elapsed[1] - elapsed[0]) / (2U * XF_OSAL_BENCH_ITERATIONS)) : 0U;
+
+    print("{\"bench\":\"trace\",\"calibrate_ns\":%llu,\"per_event_ns\":%llu,\"bound_ns\":%lu}\n",
+          (unsigned long long)calibrate_ns, (unsigned long long)per_event_ns,
+          (unsigned long)XF_OSAL_BENCH_TRACE_BOUND_NS);
+
+    return (calibrate_ns <= XF_OSAL_BENCH_TRACE_BOUND_NS) ? XF_OK : XF_FAIL;
+}
+#endif
+
+static void yield_thread(void *argument)
+{
+    uint32_t i;
+
+    (void)argument;
+
+    bench_begin();
+    for (i = 0U; i < XF_OSAL_BENCH_ITERATIONS; i++) {
+        xf_osal_thread_yield();
+    }
+    bench_finish();
+}
+
+static void ping_thread(void *argument)
+{
+    bench_pair_t *pair = (bench_pair_t *)argument;
+    uint32_t i;
+
+    bench_begin();
+    for (i = 0U; i < XF_OSAL_BENCH_ITERATIONS; i++) {
+        xf_osal_semaphore_release(pair->ping);
+        xf_osal_semaphore_acquire(pair->pong, XF_OSAL_WAIT_FOREVER);
+    }
+    bench_finish();
+}
+
+static void pong_thread(void *argument)
+{
+    bench_pair_t *pair = (bench_pair_t *)argument;
+    uint32_t i;
+
+    bench_begin();
+    for (i = 0U; i < XF_OSAL_BENCH_ITERATIONS; i++) {
+        xf_osal_semaphore_acquire(pair->ping, XF_OSAL_WAIT_FOREVER);
+        xf_osal_semaphore_release(pair->pong);
+    }
+    bench_finish();
+}
+
+#if XF_OSAL_LWSEM_IS_ENABLE
+static void lwsem_ping_thread(void *argument)
+{
+    bench_lwsem_pair_t *pair = (bench_lwsem_pair_t *)argument;
+    uint32_t i;
+
+    bench_begin();
+    for (i = 0U; i < XF_OSAL_BENCH_ITERATIONS; i++) {
+        xf_osal_lwsem_release(&pair->ping);
+        xf_osal_lwsem_acquire(&pair->pong, XF_OSAL_WAIT_FOREVER);
+    }
+    bench_finish();
+}
+
+static void lwsem_pong_thread(void *argument)
+{
+    bench_lwsem_pair_t *pair = (bench_lwsem_pair_t *)argument;
+    uint32_t i;
+
+    bench_begin();
+    for (i = 0U; i < XF_OSAL_BENCH_ITERATIONS; i++) {
+        xf_osal_lwsem_acquire(&pair->ping, XF_OSAL_WAIT_FOREVER);
+        xf_osal_lwsem_release(&pair->pong);
+    }
+    bench_finish();
+}
+#endif
+
+/* 持有期间让出，使其他线程都阻塞在这把锁上 */
+static void affinity_writer_thread(void *argument)
+{
+    bench_affinity_t *ctx = (bench_affinity_t *)argument;
+    uint32_t i;
+    uint32_t j;
+
+    bench_begin();
+    for (i = 0U; i < XF_OSAL_BENCH_ITERATIONS; i++) {
+        for (j = 0U; j < BENCH_AFFINITY_WORDS; j++) {
+            ctx->buf[j] += i;
+        }
+        xf_osal_semaphore_release(ctx->ping);
+        xf_osal_semaphore_acquire(ctx->pong, XF_OSAL_WAIT_FOREVER);
+    }
+    bench_finish();
+}
+
+static void affinity_reader_thread(void *argument)
+{
+    bench_affinity_t *ctx = (bench_affinity_t *)argument;
+    uint32_t sum = 0U;
+    uint32_t i;
+    uint32_t j;
+
+    bench_begin();
+    for (i = 0U; i < XF_OSAL_BENCH_ITERATIONS; i++) {
+        xf_osal_semaphore_acquire(ctx->ping, XF_OSAL_WAIT_FOREVER);
+        for (j = 0U; j < BENCH_AFFINITY_WORDS; j++) {
+            sum += ctx->buf[j];
+        }
+        xf_osal_semaphore_release(ctx->pong);
+    }
+    ctx->sum = sum;
+    bench_finish();
+}
+
+static void contend_thread(void *argument)
+{
+    uint32_t i;
+
+    (void)argument;
+
+    bench_begin();
+    for (i = 0U; i < (XF_OSAL_BENCH_ITERATIONS / BENCH_CONTENDERS); i++) {
+        xf_osal_mutex_acquire(s_mutex, XF_OSAL_WAIT_FOREVER);
+        xf_osal_thread_yield();
+        xf_osal_mutex_release(s_mutex);
+    }
+    bench_finish();
+}
+
+static void producer_thread(void *argument)
+{
+    bench_queue_t *ctx = (bench_queue_t *)argument;
+    uint8_t msg[BENCH_MSG_SIZE_MAX] = { 0 };
+    uint32_t i;
+
+    bench_begin();
+    for (i = 0U; i < XF_OSAL_BENCH_ITERATIONS; i++) {
+        msg[0] = (uint8_t)i;
+        xf_osal_queue_put(ctx->queue, msg, 0U, XF_OSAL_WAIT_FOREVER);
+    }
+    bench_finish();
+}
+
+static void consumer_thread(void *argument)
+{
+    bench_queue_t *ctx = (bench_queue_t *)argument;
+    uint8_t msg[BENCH_MSG_SIZE_MAX];
+    uint32_t i;
+
+    bench_begin();
+    for (i = 0U; i < XF_OSAL_BENCH_ITERATIONS; i++) {
+        xf_osal_queue_get(ctx->queue, msg, NULL, XF_OSAL_WAIT_FOREVER);
+    }
+    bench_finish();
+}
+
+#if XF_OSAL_SELECT_IS_ENABLE
+static void select_producer_thread(void *argument)
+{
+    bench_select_t *ctx = (bench_select_t *)argument;
+    uint32_t i;
+
+    bench_begin();
+    for (i = 0U; i < XF_OSAL_BENCH_ITERATIONS; i++) {
+        xf_osal_queue_put(ctx->queues[i % BENCH_SELECT_QUEUES], &i, 0U, XF_OSAL_WAIT_FOREVER);
+    }
+    bench_finish();
+}
+
+static void select_consumer_thread(void *argument)
+{
+    bench_select_t *ctx = (bench_select_t *)argument;
+    uint32_t received = 0U;
+    uint32_t msg;
+    uint32_t got;
+    uint32_t q;
+    void *ready;
+
+    bench_begin();
+    while (received < XF_OSAL_BENCH_ITERATIONS) {
+        if (ctx->polling == 0U) {
+            xf_osal_select(ctx->set, &ready, XF_OSAL_WAIT_FOREVER);
+            xf_osal_queue_get((xf_osal_queue_t)ready, &msg, NULL, 0U);
+            received++;
+        } else {
+            got = 0U;
+            for (q = 0U; q < BENCH_SELECT_QUEUES; q++) {
+                if (xf_osal_queue_get(ctx->queues[q], &msg, NULL, 0U) == XF_OK) {
+                    received++;
+                    got = 1U;
+                }
+            }
+            if (got == 0U) {
+                xf_osal_thread_yield();
+            }
+        }
+    }
+    bench_finish();
+}
+#endif
+
+static void event_wait_thread(void *argument)
+{
+    xf_osal_event_t event = (xf_osal_event_t)argument;
+    uint32_t i;
+
+    bench_begin();
+    for (i = 0U; i < XF_OSAL_BENCH_SAMPLES; i++) {
+        xf_osal_event_wait(event, BENCH_EVENT_FLAG, XF_OSAL_WAIT_ANY, XF_OSAL_WAIT_FOREVER);
+        s_samples[i] = BENCH_TS() - s_set_ts;
+    }
+    bench_finish();
+}
+
+static void event_set_thread(void *argument)
+{
+    xf_osal_event_t event = (xf_osal_event_t)argument;
+    uint32_t i;
+
+    bench_begin();
+    for (i = 0U; i < XF_OSAL_BENCH_SAMPLES; i++) {
+        /* 确保等待线程已经阻塞 */
+        xf_osal_delay(1U);
+        s_set_ts = BENCH_TS();
+        xf_osal_event_set(event, BENCH_EVENT_FLAG);
+    }
+    bench_finish();
+}
+
+static void jitter_timer_cb(void *argument)
+{
+    uint32_t count = s_timer_count;
+
+    (void)argument;
+
+    if (count > XF_OSAL_BENCH_SAMPLES) {
+        return;
+    }
+
+    s_samples[count] = BENCH_TS();
+    s_timer_count = count + 1U;
+    if (count == XF_OSAL_BENCH_SAMPLES) {
+        xf_osal_semaphore_release(s_done);
+    }
+}
+
+/* ==================== [Helpers] =========================================== */
+
+static xf_err_t bench_spawn(xf_osal_thread_func_t func, void *arg, xf_osal_priority_t priority)
+{
+    return bench_spawn_on(func, arg, priority, 0U);
+}
+
+/**
+ * @brief 创建只在 mask 中的核上运行的测量线程，mask 为 0 时不限制。
+ */
+static xf_err_t bench_spawn_on(xf_osal_thread_func_t func, void *arg, xf_osal_priority_t priority, uint32_t mask)
+{
+    const xf_osal_thread_attr_t attr = {
+        .name           = "bench",
+        .stack_size     = XF_OSAL_BENCH_STACK_SIZE,
+        .priority       = priority,
+        .affinity_mask  = mask,
+    };
+
+    return (xf_osal_thread_create(func, arg, &attr) != NULL) ? XF_OK : XF_ERR_NO_MEM;
+}
+
+/**
+ * @brief 同时放行 threads 个阻塞在 bench_begin() 中的测量线程，返回放行前的时间戳。
+ */
+static uint32_t bench_go(uint32_t threads)
+{
+    uint32_t t0 = BENCH_TS();
+
+    if (threads != 0U) {
+        xf_osal_semaphore_release_n(s_start, threads);
+    }
+
+    return t0;
+}
+
+static xf_err_t bench_wait(uint32_t threads)
+{
+    const uint32_t timeout = xf_osal_kernel_ms_to_ticks(XF_OSAL_BENCH_TIMEOUT_MS);
+    uint32_t i;
+
+    for (i = 0U; i < threads; i++) {
+        if (xf_osal_semaphore_acquire(s_done, timeout) != XF_OK) {
+            s_print("{\"bench\":\"error\",\"reason\":\"timeout\"}\n");
+            return XF_ERR_TIMEOUT;
+        }
+    }
+
+    return XF_OK;
+}
+
+static void bench_begin(void)
+{
+    xf_osal_semaphore_acquire(s_start, XF_OSAL_WAIT_FOREVER);
+}
+
+static void bench_finish(void)
+{
+    s_end = BENCH_TS();
+    xf_osal_semaphore_release(s_done);
+    xf_osal_thread_delete(NULL);
+}
+
+static uint64_t bench_to_ns(uint64_t ts)
+{
+    return (ts * 1000000000ULL) / XF_OSAL_BENCH_TIMESTAMP_FREQ();
+}
+
+static void bench_report_ops(xf_osal_bench_print_t print, const char *name, uint32_t threads,
+                             uint32_t msg_size, uint32_t ops, uint32_t elapsed)
+{
+    uint64_t total_ns = bench_to_ns(elapsed);
+
+    print("{\"bench\":\"%s\",\"threads\":%lu,", name, (unsigned long)threads);
+    if (msg_size != 0U) {
+        print("\"msg_size\":%lu,\"bytes_per_s\":%llu,", (unsigned long)msg_size,
+              (unsigned long long)((total_ns != 0U) ? ((uint64_t)msg_size * ops * 1000000000ULL / total_ns) : 0U));
+    }
+    print("\"ops\":%lu,\"total_ns\":%llu,\"ns_per_op\":%llu}\n", (unsigned long)ops,
+          (unsigned long long)total_ns, (unsigned long long)(total_ns / ops));
+}
+
+/**
+ * @brief 对 s_samples 中的 count 个样本排序并输出分布，period 不为 0 时一并输出。
+ */
+static void bench_report_samples(xf_osal_bench_print_t print, const char *name, uint32_t period, uint32_t count)
+{
+    uint64_t sum = 0U;
+    uint32_t value;
+    uint32_t i;
+    uint32_t j;
+
+    /* 样本数很少，插入排序即可 */
+    for (i = 1U; i < count; i++) {
+        value = s_samples[i];
+        for (j = i; (j > 0U) && (s_samples[j - 1U] > value); j--) {
+            s_samples[j] = s_samples[j - 1U];
+        }
+        s_samples[j] = value;
+    }
+    for (i = 0U; i < count; i++) {
+        sum += s_samples[i];
+    }
+
+    print("{\"bench\":\"%s\",", name);
+    if (period != 0U) {
+        print("\"period_ns\":%llu,", (unsigned long long)bench_to_ns(period));
+    }
+    print("\"samples\":%lu,\"min_ns\":%llu,\"avg_ns\":%llu,\"p50_ns\":%llu,\"p99_ns\":%llu,\"max_ns\":%llu}\n",
+          (unsigned long)count,
+          (unsigned long long)bench_to_ns(s_samples[0]),
+          (unsigned long long)bench_to_ns(sum / count),
+          (unsigned long long)bench_to_ns(s_samples[(count * 50U) / 100U]),
+          (unsigned long long)bench_to_ns(s_samples[(count * 99U) / 100U]),
+          (unsigned long long)bench_to_ns(s_samples[count - 1U]));
+}
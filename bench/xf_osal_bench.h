@@ -0,0 +1,143 @@
+/**
+ * @file xf_osal_bench.h
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief 只使用 xf_osal 接口的基准测试，可在目标板或 FreeRTOS POSIX 模拟器上运行。
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * xf_osal_bench_run() 先输出一行 "config"（是否开启内联快速路径、参数检查、跟踪与各对象池大小），
+ * 再依次测量：
+ *
+ * - yield:           两个同优先级线程循环 xf_osal_thread_yield(), 每次切换的时间；
+ * - semaphore:       两个线程通过两个信号量交替 release / acquire, 每次往返的时间；
+ * - lwsem:           同上，改用轻量信号量；lwsem_uncontended 为单线程不阻塞的 release / acquire;
+ * - *_uncontended:   单线程、不阻塞的信号量 release / acquire、互斥锁 acquire / release、
+ *                    消息队列 put / get, 即 XF_OSAL_INLINE_ENABLE 优化的快速路径；
+ * - *_create_delete:  单线程反复创建、删除信号量、互斥锁、事件，配置 XF_OSAL_*_POOL_SIZE 时
+ *                    控制块来自对象池，与不配置时比较即对象池省下的堆分配开销；
+ * - affinity_*:      写线程每轮改写 4 KB 缓冲区后交给读线程求和，两线程在同一个核、在不同核、
+ *                    不限制时每轮的时间，比较即绑核的缓存局部性收益；单核系统只输出 "cores":1;
+ * - mutex_contended: 多个线程争用同一把锁，持有期间让出；
+ * - queue:           生产者、消费者线程按不同消息大小收发，每条消息的时间与吞吐量；
+ * - select:          生产者轮流向 4 个队列放入消息，消费者用 xf_osal_select() 等待；
+ *                    select_polling 为消费者轮询各队列、都为空时让出，二者比较每条消息的时间；
+ * - event_latency:   xf_osal_event_set() 到等待线程从 xf_osal_event_wait() 返回的延迟分布；
+ * - timer_jitter:    周期定时器相邻两次回调的间隔与周期之差的分布；
+ * - trace:           仅在开启 XF_OSAL_TRACE_ENABLE 时运行，xf_osal_trace_calibrate() 测得的每条记录开销
+ *                    （calibrate_ns）与记录开启、关闭时不阻塞 release / acquire 之差（per_event_ns）,
+ *                    calibrate_ns 超过 XF_OSAL_BENCH_TRACE_BOUND_NS 时返回 XF_FAIL.
+ *
+ * 每项结果输出一行 JSON, 时间统一换算为 ns:
+ *
+ * @code
+ * {"bench":"yield","threads":2,"ops":20000,"total_ns":8400000,"ns_per_op":420}
+ * {"bench":"event_latency","samples":200,"min_ns":900,"avg_ns":1100,"p50_ns":1000,"p99_ns":2100,"max_ns":2600}
+ * @endcode
+ *
+ * 默认以 tick 计时，分辨率不足以测量单次操作，应把 XF_OSAL_BENCH_TIMESTAMP() 改为周期计数器。
+ * 调用线程的优先级应低于 XF_OSAL_BENCH_PRIORITY, 测量期间它只阻塞等待测量线程结束。
+ */
+
+#ifndef __XF_OSAL_BENCH_H__
+#define __XF_OSAL_BENCH_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_osal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/**
+ * @brief 计时函数与其频率（Hz）。两次读数之差按无符号数计算，单项测量不能超过一个回绕周期。
+ */
+#ifndef XF_OSAL_BENCH_TIMESTAMP
+#define XF_OSAL_BENCH_TIMESTAMP()       xf_osal_kernel_get_tick_count()
+#define XF_OSAL_BENCH_TIMESTAMP_FREQ()  xf_osal_kernel_get_tick_freq()
+#endif
+
+/**
+ * @brief 吞吐类测量的操作次数。
+ */
+#ifndef XF_OSAL_BENCH_ITERATIONS
+#define XF_OSAL_BENCH_ITERATIONS        (10000U)
+#endif
+
+/**
+ * @brief 延迟类测量的样本数。
+ */
+#ifndef XF_OSAL_BENCH_SAMPLES
+#define XF_OSAL_BENCH_SAMPLES           (200U)
+#endif
+
+/**
+ * @brief 测量线程的优先级，延迟测量中的等待线程比它高一级。
+ */
+#ifndef XF_OSAL_BENCH_PRIORITY
+#define XF_OSAL_BENCH_PRIORITY          XF_OSAL_PRIORITY_ABOVE_NORMAL
+#endif
+
+/**
+ * @brief 测量线程的栈大小（单位字节）。
+ */
+#ifndef XF_OSAL_BENCH_STACK_SIZE
+#define XF_OSAL_BENCH_STACK_SIZE        (2048U)
+#endif
+
+/**
+ * @brief 定时器抖动测量的周期（单位 tick）。
+ */
+#ifndef XF_OSAL_BENCH_TIMER_PERIOD
+#define XF_OSAL_BENCH_TIMER_PERIOD      (2U)
+#endif
+
+/**
+ * @brief 每条跟踪记录开销的上限（单位 ns）。
+ */
+#ifndef XF_OSAL_BENCH_TRACE_BOUND_NS
+#define XF_OSAL_BENCH_TRACE_BOUND_NS    (10000U)
+#endif
+
+/**
+ * @brief 等待一项测量结束的最长时间（单位 ms）。
+ */
+#ifndef XF_OSAL_BENCH_TIMEOUT_MS
+#define XF_OSAL_BENCH_TIMEOUT_MS        (30000U)
+#endif
+
+/* ==================== [Typedefs] ========================================== */
+
+/**
+ * @brief 输出函数，格式与 printf 相同。
+ */
+typedef int (*xf_osal_bench_print_t)(const char *format, ...);
+
+/* ==================== [Global Prototypes] ================================= */
+
+/**
+ * @brief 依次运行所有测量，每项输出一行 JSON.
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @param print 输出函数，如 printf.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    无效参数
+ *      - XF_ERR_NO_MEM         创建线程或对象失败
+ *      - XF_ERR_TIMEOUT        测量线程未在 XF_OSAL_BENCH_TIMEOUT_MS 内结束
+ *      - XF_FAIL               跟踪记录的开销超过 XF_OSAL_BENCH_TRACE_BOUND_NS
+ */
+xf_err_t xf_osal_bench_run(xf_osal_bench_print_t print);
+
+/* ==================== [Macros] ============================================ */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif // __XF_OSAL_BENCH_H__
@@ -88,12 +88,109 @@ extern "C" {
 #define XF_CMSIS_THREAD_NOTIFY_IS_ENABLE (0)
 #endif
 
+/**
+ * @brief 线程核亲和性，需 CMSIS-RTOS2 API 2.3 及以上（osThreadAttr_t::affinity_mask、
+ *        osThreadSetAffinityMask()）且实现支持 SMP. 默认关闭，关闭时按单核处理。
+ */
+#if (defined(XF_CMSIS_THREAD_AFFINITY_ENABLE) && (XF_CMSIS_THREAD_AFFINITY_ENABLE)) || defined(__DOXYGEN__)
+#define XF_CMSIS_THREAD_AFFINITY_IS_ENABLE (1)
+#else
+#define XF_CMSIS_THREAD_AFFINITY_IS_ENABLE (0)
+#endif
+
 #if (!defined(XF_CMSIS_TIMER_GET_NAME_ENABLE) || (XF_CMSIS_TIMER_GET_NAME_ENABLE) || defined(__DOXYGEN__))
 #define XF_CMSIS_TIMER_GET_NAME_IS_ENABLE (1)
 #else
 #define XF_CMSIS_TIMER_GET_NAME_IS_ENABLE (0)
 #endif
 
+/**
+ * @brief 对接层内部唤醒使用的线程标志位。
+ *
+ * 条件变量等由对接层自行实现等待队列的对象通过该标志唤醒线程，
+ * 应用程序不得使用该位。默认使用 bit30.
+ */
+#ifndef XF_CMSIS_WAKE_FLAG
+#define XF_CMSIS_WAKE_FLAG (1UL << 30)
+#endif
+
+/**
+ * @brief 对接层动态分配内存的接口。
+ *
+ * CMSIS-RTOS2 未提供通用的内存分配接口，对接层自行实现的对象
+ * （如条件变量）未指定 cb_mem 时使用该接口分配控制块。默认使用 C 库 malloc/free.
+ */
+#ifndef XF_CMSIS_MALLOC
+#include <stdlib.h>
+#define XF_CMSIS_MALLOC(size)   malloc(size)
+#define XF_CMSIS_FREE(ptr)      free(ptr)
+#endif
+
+/**
+ * @brief xf_osal_select() 按对象地址查找所在集合的散列表槽位数，须为 2 的幂。
+ *
+ * 释放、写入路径只查找一个槽位，槽位数接近加入集合的对象总数时基本不必遍历链表。
+ */
+#ifndef XF_CMSIS_SELECT_HASH_SIZE
+#define XF_CMSIS_SELECT_HASH_SIZE   (16U)
+#endif
+
+/**
+ * @brief 邮箱模式（XF_OSAL_QUEUE_OVERWRITE）消息队列的最大消息大小（单位字节）。
+ *
+ * CMSIS-RTOS2 没有覆盖写接口，对接层在邮箱已满时先把旧消息取到栈上的临时缓冲区再放入新消息，
+ * 该值即临时缓冲区大小，消息更大的邮箱创建失败。
+ */
+#ifndef XF_CMSIS_QUEUE_OVERWRITE_MSG_MAX
+#define XF_CMSIS_QUEUE_OVERWRITE_MSG_MAX (64U)
+#endif
+
+/**
+ * @brief 线程局部存储的键数量（最多 32 个）与可同时使用线程局部存储的线程数，见 xf_osal_tls_alloc().
+ *
+ * CMSIS-RTOS2 没有线程局部存储，对接层按线程 ID 散列到 XF_CMSIS_TLS_THREAD_MAX 个槽位，
+ * 线程首次调用 xf_osal_tls_set() 时占用槽位，通过 xf_osal_thread_delete() 删除时归还。
+ */
+#ifndef XF_CMSIS_TLS_NUM
+#define XF_CMSIS_TLS_NUM (4U)
+#endif
+
+#ifndef XF_CMSIS_TLS_THREAD_MAX
+#define XF_CMSIS_TLS_THREAD_MAX (8U)
+#endif
+
+/**
+ * @brief 延迟执行队列长度，见 xf_osal_kernel_defer(). 必须为 2 的幂。
+ */
+#ifndef XF_CMSIS_DEFER_QUEUE_SIZE
+#define XF_CMSIS_DEFER_QUEUE_SIZE (16U)
+#endif
+
+/**
+ * @brief 延迟执行工作线程的栈大小（单位字节）与优先级。
+ */
+#ifndef XF_CMSIS_DEFER_STACK_SIZE
+#define XF_CMSIS_DEFER_STACK_SIZE (1024U)
+#endif
+
+#ifndef XF_CMSIS_DEFER_PRIORITY
+#define XF_CMSIS_DEFER_PRIORITY   (osPriorityRealtime)
+#endif
+
+/**
+ * @brief 低功耗睡眠，由 xf_cmsis_idle_process() 在内核暂停后调用（开启 XF_OSAL_IDLE_HOOK_ENABLE 时）。
+ *
+ * 需由应用定义为一个函数调用：设置低功耗定时器在 ticks 个滴答后唤醒、进入睡眠，
+ * 醒来后返回实际睡眠的滴答数。未定义时 xf_cmsis_idle_process() 只调用空闲钩子，不暂停内核。
+ *
+ * @code
+ * #define XF_CMSIS_IDLE_SLEEP(ticks)  board_lptim_sleep(ticks)
+ * @endcode
+ */
+#if defined(__DOXYGEN__)
+#define XF_CMSIS_IDLE_SLEEP(ticks) (0U)
+#endif
+
 /* ==================== [Typedefs] ========================================== */
 
 /* ==================== [Global Prototypes] ================================= */
@@ -0,0 +1,230 @@
+/**
+ * @file xf_osal_cond.c
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_osal_internal.h"
+
+#if XF_OSAL_COND_IS_ENABLE
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/* 等待节点，位于等待线程的栈上 */
+typedef struct _cond_waiter_t {
+    struct _cond_waiter_t  *next;
+    osThreadId_t            thread;
+    osPriority_t            prio;
+    volatile uint32_t       signaled;
+} cond_waiter_t;
+
+/* 条件变量控制块 */
+typedef struct _cond_cb_t {
+    cond_waiter_t  *head;       /* 按优先级从高到低、同优先级先到先得排列 */
+    const char     *name;
+    uint32_t        dyn;        /* 控制块是否动态分配 */
+} cond_cb_t;
+
+/* 控制块不得超过公共头文件声明的大小 */
+typedef char cond_cb_size_check_t[(sizeof(cond_cb_t) <= XF_OSAL_COND_CB_SIZE) ? 1 : -1];
+
+/* ==================== [Static Prototypes] ================================= */
+
+static void cond_waiter_insert(cond_cb_t *cb, cond_waiter_t *waiter);
+static void cond_waiter_remove(cond_cb_t *cb, cond_waiter_t *waiter);
+
+/* ==================== [Static Variables] ================================== */
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+xf_osal_cond_t xf_osal_cond_create(const xf_osal_cond_attr_t *attr)
+{
+    cond_cb_t *cb = NULL;
+    uint32_t dyn = 0U;
+
+    if (attr == NULL || (attr->cb_mem == NULL && attr->cb_size == 0U)) {
+        cb = (cond_cb_t *)XF_CMSIS_MALLOC(sizeof(cond_cb_t));
+        dyn = 1U;
+    } else if (attr->cb_mem != NULL && attr->cb_size >= sizeof(cond_cb_t)) {
+        cb = (cond_cb_t *)attr->cb_mem;
+    }
+
+    if (cb != NULL) {
+        cb->head = NULL;
+        cb->name = (attr != NULL) ? attr->name : NULL;
+        cb->dyn  = dyn;
+    }
+
+    return (xf_osal_cond_t)cb;
+}
+
+xf_err_t xf_osal_cond_wait(xf_osal_cond_t cond, xf_osal_mutex_t mutex)
+{
+    return xf_osal_cond_timedwait(cond, mutex, XF_OSAL_WAIT_FOREVER);
+}
+
+xf_err_t xf_osal_cond_timedwait(xf_osal_cond_t cond, xf_osal_mutex_t mutex, uint32_t timeout)
+{
+    cond_cb_t *cb = (cond_cb_t *)cond;
+    cond_waiter_t waiter;
+    uint32_t remaining;
+    int32_t lock;
+    xf_err_t err;
+
+    if ((cb == NULL) || (mutex == NULL)) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    waiter.next     = NULL;
+    waiter.thread   = osThreadGetId();
+    waiter.prio     = osThreadGetPriority(waiter.thread);
+    waiter.signaled = 0U;
+
+    /* 先入队再释放互斥锁，保证释放后发出的通知不会丢失 */
+    lock = osKernelLock();
+    if (lock < 0) {
+        /* 中断中调用时 osKernelLock 返回 osErrorISR */
+        return transform_to_xf_err((osStatus_t)lock);
+    }
+    cond_waiter_insert(cb, &waiter);
+    (void)osKernelRestoreLock(lock);
+
+    err = xf_osal_mutex_release(mutex);
+    if (err != XF_OK) {
+        lock = osKernelLock();
+        cond_waiter_remove(cb, &waiter);
+        (void)osKernelRestoreLock(lock);
+        return err;
+    }
+
+    remaining = (timeout == XF_OSAL_WAIT_FOREVER) ? osWaitForever : timeout;
+
+    while ((waiter.signaled == 0U) && (remaining != 0U)) {
+        if (xf_cmsis_wait_wake(&remaining) == 0) {
+            break;
+        }
+    }
+
+    lock = osKernelLock();
+    if (waiter.signaled != 0U) {
+        err = XF_OK;
+    } else {
+        /* 超时，且在此之前未被通知 */
+        cond_waiter_remove(cb, &waiter);
+        err = (timeout != 0U) ? XF_ERR_TIMEOUT : XF_ERR_RESOURCE;
+    }
+    (void)osKernelRestoreLock(lock);
+
+    (void)xf_osal_mutex_acquire(mutex, XF_OSAL_WAIT_FOREVER);
+
+    return err;
+}
+
+xf_err_t xf_osal_cond_signal(xf_osal_cond_t cond)
+{
+    cond_cb_t *cb = (cond_cb_t *)cond;
+    cond_waiter_t *waiter;
+    int32_t lock;
+
+    if (cb == NULL) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    lock = osKernelLock();
+    if (lock < 0) {
+        return transform_to_xf_err((osStatus_t)lock);
+    }
+    waiter = cb->head;
+    if (waiter != NULL) {
+        cb->head = waiter->next;
+        waiter->signaled = 1U;
+        xf_cmsis_wake(waiter->thread);
+    }
+    (void)osKernelRestoreLock(lock);
+
+    return XF_OK;
+}
+
+xf_err_t xf_osal_cond_broadcast(xf_osal_cond_t cond)
+{
+    cond_cb_t *cb = (cond_cb_t *)cond;
+    cond_waiter_t *waiter;
+    int32_t lock;
+
+    if (cb == NULL) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    lock = osKernelLock();
+    if (lock < 0) {
+        return transform_to_xf_err((osStatus_t)lock);
+    }
+    while (cb->head != NULL) {
+        waiter = cb->head;
+        cb->head = waiter->next;
+        waiter->signaled = 1U;
+        xf_cmsis_wake(waiter->thread);
+    }
+    (void)osKernelRestoreLock(lock);
+
+    return XF_OK;
+}
+
+xf_err_t xf_osal_cond_delete(xf_osal_cond_t cond)
+{
+    cond_cb_t *cb = (cond_cb_t *)cond;
+
+    if (cb == NULL) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    if (cb->head != NULL) {
+        return XF_ERR_RESOURCE;
+    }
+
+    if (cb->dyn != 0U) {
+        XF_CMSIS_FREE(cb);
+    }
+
+    return XF_OK;
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static void cond_waiter_insert(cond_cb_t *cb, cond_waiter_t *waiter)
+{
+    cond_waiter_t **pp = &cb->head;
+
+    while ((*pp != NULL) && ((*pp)->prio >= waiter->prio)) {
+        pp = &(*pp)->next;
+    }
+
+    waiter->next = *pp;
+    *pp = waiter;
+}
+
+static void cond_waiter_remove(cond_cb_t *cb, cond_waiter_t *waiter)
+{
+    cond_waiter_t **pp = &cb->head;
+
+    while (*pp != NULL) {
+        if (*pp == waiter) {
+            *pp = waiter->next;
+            break;
+        }
+        pp = &(*pp)->next;
+    }
+}
+
+#endif
@@ -29,7 +29,13 @@
 
 xf_osal_event_t xf_osal_event_create(const xf_osal_event_attr_t *attr)
 {
-    return (xf_osal_event_t)osEventFlagsNew((const osEventFlagsAttr_t *)attr);
+    xf_osal_event_t event = (xf_osal_event_t)osEventFlagsNew((const osEventFlagsAttr_t *)attr);
+
+    if ((event != NULL) && ((attr == NULL) || (attr->cb_mem == NULL))) {
+        XF_CMSIS_ALLOC_HOOK(XF_OSAL_ALLOC_OP_ALLOC, XF_OSAL_OBJ_EVENT, event, (attr != NULL) ? attr->name : NULL);
+    }
+
+    return event;
 }
 
 xf_err_t xf_osal_event_set(xf_osal_event_t event, uint32_t flags)
@@ -37,9 +43,18 @@ xf_err_t xf_osal_event_set(xf_osal_event_t event, uint32_t flags)
     uint32_t status = osEventFlagsSet((osEventFlagsId_t)event, flags);
     xf_err_t err = (status & osFlagsError) ? (transform_to_xf_err(status)) : (XF_OK);
 
+    if (err == XF_OK) {
+        XF_CMSIS_SELECT_NOTIFY(event);
+    }
+
     return err;
 }
 
+xf_err_t xf_osal_event_set_from_isr(xf_osal_event_t event, uint32_t flags)
+{
+    return xf_osal_event_set(event, flags);
+}
+
 xf_err_t xf_osal_event_clear(xf_osal_event_t event, uint32_t flags)
 {
     uint32_t status = osEventFlagsClear((osEventFlagsId_t)event, flags);
@@ -66,6 +81,10 @@ xf_err_t xf_osal_event_delete(xf_osal_event_t event)
     uint32_t status = osEventFlagsDelete((osEventFlagsId_t)event);
     xf_err_t err = (status & osFlagsError) ? (transform_to_xf_err(status)) : (XF_OK);
 
+    if (err == XF_OK) {
+        XF_CMSIS_ALLOC_HOOK(XF_OSAL_ALLOC_OP_FREE, XF_OSAL_OBJ_EVENT, event, NULL);
+    }
+
     return err;
 }
 
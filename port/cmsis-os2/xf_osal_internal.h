@@ -14,8 +14,12 @@
 
 /* ==================== [Includes] ========================================== */
 
+/* 对接层源文件：不将公共接口映射为内联实现 */
+#define XF_OSAL_PORT_SOURCE
+
 #include "cmsis_os2.h"
 #include "xf_osal.h"
+#include "xf_osal_port.h"
 #include "xf_cmsis_os2_config.h"
 
 #ifdef __cplusplus
@@ -24,6 +28,23 @@ extern "C" {
 
 /* ==================== [Defines] =========================================== */
 
+/*
+ * 创建、删除对象时调用分配跟踪钩子，见 xf_osal_kernel_set_alloc_hook().
+ * 控制块由 CMSIS-RTOS2 实现分配，大小未知，分配时报告的 size 为 0.
+ */
+#if XF_OSAL_ALLOC_HOOK_IS_ENABLE
+extern xf_osal_alloc_hook_t volatile xf_cmsis_alloc_hook;
+#define XF_CMSIS_ALLOC_HOOK(op, type, obj, name)                                    \
+    do {                                                                            \
+        xf_osal_alloc_hook_t _hook = xf_cmsis_alloc_hook;                           \
+        if (_hook != NULL) {                                                        \
+            _hook((op), (type), (void *)(obj), (name), 0U);                         \
+        }                                                                           \
+    } while (0)
+#else
+#define XF_CMSIS_ALLOC_HOOK(op, type, obj, name)    do { } while (0)
+#endif
+
 /* ==================== [Typedefs] ========================================== */
 
 /* ==================== [Global Prototypes] ================================= */
@@ -32,26 +53,40 @@ extern "C" {
 
 /* ==================== [Global Functions] ================================== */
 
-static inline xf_err_t transform_to_xf_err(osStatus_t status)
+/**
+ * @brief 唤醒等待在对接层内部等待队列上的线程。
+ */
+static inline void xf_cmsis_wake(osThreadId_t thread)
 {
-    switch (status) {
-    case osOK:
-        return XF_OK;
-    case osErrorTimeout:
-        return XF_ERR_TIMEOUT;
-    case osErrorResource:
-        return XF_ERR_RESOURCE;
-    case osErrorISR:
-        return XF_ERR_ISR;
-    case osErrorParameter:
-        return XF_ERR_INVALID_ARG;
-    case osErrorNoMemory:
-        return XF_ERR_NO_MEM;
-    case osError:
-        return XF_FAIL;
-    default:
-        return XF_FAIL;
+    (void)osThreadFlagsSet(thread, XF_CMSIS_WAKE_FLAG);
+}
+
+/**
+ * @brief 阻塞当前线程，直到收到唤醒标志或超时。
+ *
+ * @param remaining 剩余等待时间（tick），返回时更新。osWaitForever 表示一直等待。
+ * @return 1: 收到唤醒标志（可能是此前残留的，调用者需重新检查条件）；0: 超时。
+ */
+static inline int32_t xf_cmsis_wait_wake(uint32_t *remaining)
+{
+    uint32_t start;
+    uint32_t elapsed;
+    uint32_t flags;
+
+    start = osKernelGetTickCount();
+    flags = osThreadFlagsWait(XF_CMSIS_WAKE_FLAG, osFlagsWaitAny, *remaining);
+
+    if (*remaining != osWaitForever) {
+        elapsed = osKernelGetTickCount() - start;
+        *remaining = (elapsed < *remaining) ? (*remaining - elapsed) : 0U;
+    }
+
+    if ((flags & osFlagsError) != 0U) {
+        *remaining = 0U;
+        return 0;
     }
+
+    return 1;
 }
 
 #ifdef __cplusplus
@@ -12,17 +12,65 @@
 /* ==================== [Includes] ========================================== */
 
 #include "xf_osal_internal.h"
+#include "xf_osal_atomic.h"
 
 #if XF_OSAL_KERNEL_IS_ENABLE
 
+/* ==================== [Global Variables] ================================== */
+
+#if XF_OSAL_ALLOC_HOOK_IS_ENABLE
+/* 分配跟踪钩子，见 XF_CMSIS_ALLOC_HOOK() */
+xf_osal_alloc_hook_t volatile xf_cmsis_alloc_hook = NULL;
+#endif
+
 /* ==================== [Defines] =========================================== */
 
+#if (XF_CMSIS_DEFER_QUEUE_SIZE == 0U) || ((XF_CMSIS_DEFER_QUEUE_SIZE) & ((XF_CMSIS_DEFER_QUEUE_SIZE) - 1U)) != 0U
+#error "XF_CMSIS_DEFER_QUEUE_SIZE must be a power of two"
+#endif
+
+#define DEFER_MASK          ((uint32_t)(XF_CMSIS_DEFER_QUEUE_SIZE) - 1U)
+
+/* 工作线程专用，不与 XF_CMSIS_WAKE_FLAG 冲突 */
+#define DEFER_FLAG          (1UL << 0)
+
 /* ==================== [Typedefs] ========================================== */
 
+/**
+ * @brief 延迟执行队列槽位。
+ *
+ * 有界无锁多生产者队列（D. Vyukov），seq 记录槽位可写入/可读取的序号。
+ * 为了让零初始化的队列直接可用，seq 存放的是相对槽位下标的偏移，实际序号为 seq + 下标。
+ */
+typedef struct _defer_slot_t {
+    uint32_t                seq;
+    xf_osal_defer_func_t    func;
+    void                   *arg1;
+    uint32_t                arg2;
+} defer_slot_t;
+
 /* ==================== [Static Prototypes] ================================= */
 
+static bool defer_pop(defer_slot_t *item);
+static void defer_worker(void *argument);
+
 /* ==================== [Static Variables] ================================== */
 
+static defer_slot_t s_defer_ring[XF_CMSIS_DEFER_QUEUE_SIZE];
+static uint32_t s_defer_head = 0U;          /* 下一个写入位置，多个生产者竞争 */
+static uint32_t s_defer_tail = 0U;          /* 下一个读取位置，只有工作线程访问 */
+static uint32_t s_defer_overflow = 0U;
+static osThreadId_t volatile s_defer_thread = NULL;
+
+#if XF_OSAL_IDLE_HOOK_IS_ENABLE
+static xf_osal_idle_hook_t volatile s_idle_hook = NULL;
+static xf_osal_sleep_hooks_t s_sleep_hooks = {NULL, NULL};
+#endif
+
+/* 最近一次暂停内核时计算的唤醒时刻，见 xf_osal_kernel_suspend() */
+static volatile uint32_t s_wakeup_tick = 0U;
+static volatile uint32_t s_wakeup_valid = 0U;
+
 /* ==================== [Macros] ============================================ */
 
 /* ==================== [Global Functions] ================================== */
@@ -82,11 +130,217 @@ xf_err_t xf_osal_kernel_unlock(void)
 #endif
 }
 
+xf_err_t xf_osal_kernel_get_heap_stats(xf_osal_heap_stats_t *stats)
+{
+    (void)stats;
+
+    /* CMSIS-RTOS2 没有查询内存池状态的接口 */
+    return XF_ERR_NOT_SUPPORTED;
+}
+
+#if XF_OSAL_ALLOC_HOOK_IS_ENABLE
+xf_err_t xf_osal_kernel_set_alloc_hook(xf_osal_alloc_hook_t hook)
+{
+    xf_cmsis_alloc_hook = hook;
+
+    return XF_OK;
+}
+#endif
+
+xf_err_t xf_osal_kernel_get_pool_stats(xf_osal_obj_type_t type, xf_osal_pool_stats_t *stats)
+{
+    (void)type;
+    (void)stats;
+
+    /* 控制块大小由 CMSIS-RTOS2 实现决定，对接层无法预先分配对象池 */
+    return XF_ERR_NOT_SUPPORTED;
+}
+
+#if XF_OSAL_IDLE_HOOK_IS_ENABLE
+xf_err_t xf_osal_kernel_set_idle_hook(xf_osal_idle_hook_t hook)
+{
+    s_idle_hook = hook;
+
+    return XF_OK;
+}
+
+xf_err_t xf_osal_kernel_set_sleep_hooks(const xf_osal_sleep_hooks_t *hooks)
+{
+    int32_t lock = osKernelLock();
+
+    if (hooks != NULL) {
+        s_sleep_hooks = *hooks;
+    } else {
+        s_sleep_hooks.pre_sleep = NULL;
+        s_sleep_hooks.post_sleep = NULL;
+    }
+    (void)osKernelRestoreLock(lock);
+
+    return XF_OK;
+}
+
+uint32_t xf_osal_kernel_get_next_wakeup(void)
+{
+    int32_t remain;
+
+    if (s_wakeup_valid == 0U) {
+        return XF_OSAL_WAIT_FOREVER;
+    }
+
+    remain = (int32_t)(s_wakeup_tick - osKernelGetTickCount());
+
+    return (remain > 0) ? (uint32_t)remain : 0U;
+}
+
+void xf_cmsis_idle_process(void)
+{
+    xf_osal_idle_hook_t hook = s_idle_hook;
+#ifdef XF_CMSIS_IDLE_SLEEP
+    uint32_t ticks;
+    uint32_t slept = 0U;
+#endif
+
+    if (hook != NULL) {
+        hook();
+    }
+
+#ifdef XF_CMSIS_IDLE_SLEEP
+    if (xf_osal_kernel_suspend(&ticks) != XF_OK) {
+        return;
+    }
+    if (s_sleep_hooks.pre_sleep != NULL) {
+        s_sleep_hooks.pre_sleep(&ticks);
+    }
+    if (ticks != 0U) {
+        slept = XF_CMSIS_IDLE_SLEEP(ticks);
+    }
+    if (s_sleep_hooks.post_sleep != NULL) {
+        s_sleep_hooks.post_sleep(ticks);
+    }
+    (void)xf_osal_kernel_resume(slept);
+#endif
+}
+#endif /* XF_OSAL_IDLE_HOOK_IS_ENABLE */
+
+xf_err_t xf_osal_kernel_suspend(uint32_t *sleep_ticks)
+{
+    uint32_t ticks;
+
+    if (sleep_ticks == NULL) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    ticks = osKernelSuspend();
+    if (ticks != osWaitForever) {
+        s_wakeup_tick = osKernelGetTickCount() + ticks;
+        s_wakeup_valid = 1U;
+    } else {
+        s_wakeup_valid = 0U;
+    }
+    *sleep_ticks = ticks;
+
+    return XF_OK;
+}
+
+xf_err_t xf_osal_kernel_resume(uint32_t sleep_ticks)
+{
+    /* 离开睡眠窗口后记录的唤醒时刻不再代表下一次超时 */
+    s_wakeup_valid = 0U;
+    osKernelResume(sleep_ticks);
+
+    return XF_OK;
+}
+
+xf_err_t xf_osal_kernel_defer_init(void)
+{
+    const osThreadAttr_t attr = {
+        .name       = "xf_defer",
+        .stack_size = XF_CMSIS_DEFER_STACK_SIZE,
+        .priority   = XF_CMSIS_DEFER_PRIORITY,
+    };
+    osThreadId_t thread;
+
+    if (s_defer_thread != NULL) {
+        return XF_OK;
+    }
+
+    /* 中断中调用时 osThreadNew() 同样返回 NULL */
+    thread = osThreadNew(defer_worker, NULL, &attr);
+    if (thread == NULL) {
+        return XF_ERR_NO_MEM;
+    }
+    s_defer_thread = thread;
+
+    /* 唤醒工作线程处理启动前已提交的函数 */
+    (void)osThreadFlagsSet(thread, DEFER_FLAG);
+
+    return XF_OK;
+}
+
+xf_err_t xf_osal_kernel_defer(xf_osal_defer_func_t func, void *arg1, uint32_t arg2)
+{
+    osThreadId_t thread;
+    defer_slot_t *slot;
+    uint32_t pos;
+    int32_t diff;
+
+    if (func == NULL) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    /* 抢占一个可写槽位 */
+    pos = xf_osal_atomic_load(&s_defer_head);
+    for (;;) {
+        slot = &s_defer_ring[pos & DEFER_MASK];
+        diff = (int32_t)(xf_osal_atomic_load(&slot->seq) + (pos & DEFER_MASK) - pos);
+        if (diff == 0) {
+            if (xf_osal_atomic_cas(&s_defer_head, &pos, pos + 1U)) {
+                break;
+            }
+        } else if (diff < 0) {
+            /* 工作线程尚未取走上一轮的数据，队列已满 */
+            (void)xf_osal_atomic_fetch_add(&s_defer_overflow, 1U);
+            return XF_ERR_RESOURCE;
+        } else {
+            pos = xf_osal_atomic_load(&s_defer_head);
+        }
+    }
+
+    slot->func = func;
+    slot->arg1 = arg1;
+    slot->arg2 = arg2;
+    xf_osal_atomic_store(&slot->seq, pos + 1U - (pos & DEFER_MASK));
+
+    thread = s_defer_thread;
+    if (thread != NULL) {
+        (void)osThreadFlagsSet(thread, DEFER_FLAG);
+    }
+
+    return XF_OK;
+}
+
+xf_err_t xf_osal_kernel_get_defer_stats(xf_osal_defer_stats_t *stats)
+{
+    if (stats == NULL) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    stats->capacity = XF_CMSIS_DEFER_QUEUE_SIZE;
+    stats->overflow = xf_osal_atomic_load(&s_defer_overflow);
+
+    return XF_OK;
+}
+
 uint32_t xf_osal_kernel_get_tick_count(void)
 {
     return osKernelGetTickCount();
 }
 
+uint32_t xf_osal_kernel_get_tick_count_from_isr(void)
+{
+    return osKernelGetTickCount();
+}
+
 uint32_t xf_osal_kernel_get_tick_freq(void)
 {
     return osKernelGetTickFreq();
@@ -104,4 +358,43 @@ uint32_t xf_osal_kernel_ms_to_ticks(uint32_t ms)
 
 /* ==================== [Static Functions] ================================== */
 
+/**
+ * @brief 取出一个已写入的槽位，队列为空时返回 false. 只在工作线程中调用。
+ */
+static bool defer_pop(defer_slot_t *item)
+{
+    uint32_t pos = s_defer_tail;
+    defer_slot_t *slot = &s_defer_ring[pos & DEFER_MASK];
+    int32_t diff;
+
+    diff = (int32_t)(xf_osal_atomic_load(&slot->seq) + (pos & DEFER_MASK) - (pos + 1U));
+    if (diff < 0) {
+        return false;
+    }
+
+    item->func = slot->func;
+    item->arg1 = slot->arg1;
+    item->arg2 = slot->arg2;
+    /* 槽位留给下一轮写入 */
+    xf_osal_atomic_store(&slot->seq, pos + XF_CMSIS_DEFER_QUEUE_SIZE - (pos & DEFER_MASK));
+    s_defer_tail = pos + 1U;
+
+    return true;
+}
+
+static void defer_worker(void *argument)
+{
+    defer_slot_t item;
+
+    (void)argument;
+
+    for (;;) {
+        while (defer_pop(&item)) {
+            item.func(item.arg1, item.arg2);
+        }
+        /* 取空后提交的函数会置位标志，不会漏掉 */
+        (void)osThreadFlagsWait(DEFER_FLAG, osFlagsWaitAny, osWaitForever);
+    }
+}
+
 #endif
@@ -0,0 +1,89 @@
+/**
+ * @file xf_osal_msgbuf.c
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_osal_internal.h"
+
+#if XF_OSAL_MSGBUF_IS_ENABLE
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Static Prototypes] ================================= */
+
+/* ==================== [Static Variables] ================================== */
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+/* CMSIS-RTOS2 没有消息缓冲区，以下接口均返回不支持 */
+
+xf_osal_msgbuf_t xf_osal_msgbuf_create(uint32_t size, const xf_osal_msgbuf_attr_t *attr)
+{
+    (void)size;
+    (void)attr;
+    return NULL;
+}
+
+xf_err_t xf_osal_msgbuf_send(xf_osal_msgbuf_t msgbuf, const void *msg_ptr, uint32_t msg_len, uint32_t timeout)
+{
+    (void)msgbuf;
+    (void)msg_ptr;
+    (void)msg_len;
+    (void)timeout;
+    return XF_ERR_NOT_SUPPORTED;
+}
+
+xf_err_t xf_osal_msgbuf_receive(xf_osal_msgbuf_t msgbuf, void *buf, uint32_t buf_size,
+                                uint32_t *msg_len, uint32_t timeout)
+{
+    (void)msgbuf;
+    (void)buf;
+    (void)buf_size;
+    (void)msg_len;
+    (void)timeout;
+    return XF_ERR_NOT_SUPPORTED;
+}
+
+xf_err_t xf_osal_msgbuf_send_from_isr(xf_osal_msgbuf_t msgbuf, const void *msg_ptr, uint32_t msg_len)
+{
+    return xf_osal_msgbuf_send(msgbuf, msg_ptr, msg_len, 0U);
+}
+
+xf_err_t xf_osal_msgbuf_receive_from_isr(xf_osal_msgbuf_t msgbuf, void *buf, uint32_t buf_size, uint32_t *msg_len)
+{
+    return xf_osal_msgbuf_receive(msgbuf, buf, buf_size, msg_len, 0U);
+}
+
+uint32_t xf_osal_msgbuf_get_space(xf_osal_msgbuf_t msgbuf)
+{
+    (void)msgbuf;
+    return 0U;
+}
+
+xf_err_t xf_osal_msgbuf_reset(xf_osal_msgbuf_t msgbuf)
+{
+    (void)msgbuf;
+    return XF_ERR_NOT_SUPPORTED;
+}
+
+xf_err_t xf_osal_msgbuf_delete(xf_osal_msgbuf_t msgbuf)
+{
+    (void)msgbuf;
+    return XF_ERR_NOT_SUPPORTED;
+}
+
+/* ==================== [Static Functions] ================================== */
+
+#endif
@@ -29,23 +29,23 @@
 
 xf_osal_mutex_t xf_osal_mutex_create(const xf_osal_mutex_attr_t *attr)
 {
-    return (xf_osal_mutex_t)osMutexNew((const osMutexAttr_t *)attr);
+    xf_osal_mutex_t mutex = (xf_osal_mutex_t)osMutexNew((const osMutexAttr_t *)attr);
+
+    if ((mutex != NULL) && ((attr == NULL) || (attr->cb_mem == NULL))) {
+        XF_CMSIS_ALLOC_HOOK(XF_OSAL_ALLOC_OP_ALLOC, XF_OSAL_OBJ_MUTEX, mutex, (attr != NULL) ? attr->name : NULL);
+    }
+
+    return mutex;
 }
 
 xf_err_t xf_osal_mutex_acquire(xf_osal_mutex_t mutex, uint32_t timeout)
 {
-    osStatus_t status = osMutexAcquire((osMutexId_t)mutex, timeout);
-    xf_err_t err = transform_to_xf_err(status);
-
-    return err;
+    return xf_osal_port_mutex_acquire(mutex, timeout);
 }
 
 xf_err_t xf_osal_mutex_release(xf_osal_mutex_t mutex)
 {
-    osStatus_t status = osMutexRelease((osMutexId_t)mutex);
-    xf_err_t err = transform_to_xf_err(status);
-
-    return err;
+    return xf_osal_port_mutex_release(mutex);
 }
 
 xf_osal_thread_t xf_osal_mutex_get_owner(xf_osal_mutex_t mutex)
@@ -58,6 +58,10 @@ xf_err_t xf_osal_mutex_delete(xf_osal_mutex_t mutex)
     osStatus_t status = osMutexDelete((osMutexId_t)mutex);
     xf_err_t err = transform_to_xf_err(status);
 
+    if (err == XF_OK) {
+        XF_CMSIS_ALLOC_HOOK(XF_OSAL_ALLOC_OP_FREE, XF_OSAL_OBJ_MUTEX, mutex, NULL);
+    }
+
     return err;
 }
 
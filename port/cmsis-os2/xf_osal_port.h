@@ -0,0 +1,205 @@
+/**
+ * @file xf_osal_port.h
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief CMSIS-OS2 对接层公共头文件，提供热点接口的内联实现。
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * 开启 XF_OSAL_INLINE_ENABLE 后，xf_osal.h 会包含本文件，
+ * 用户代码对热点接口的调用直接展开为此处的 static inline 函数。
+ * 参数检查由 CMSIS-OS2 实现自行完成。
+ */
+
+#ifndef __XF_OSAL_PORT_H__
+#define __XF_OSAL_PORT_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "cmsis_os2.h"
+#include "xf_osal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/*
+ * 静态分配所需的控制块与消息内存大小（单位字节），供 xf_osal.hpp 预留静态内存。
+ * CMSIS-OS2 未规定控制块大小：RTX5 由 rtx_os.h 提供，其他实现需在编译选项中自行定义。
+ */
+#if !defined(XF_OSAL_PORT_THREAD_CB_SIZE) && defined(osRtxThreadCbSize)
+#define XF_OSAL_PORT_THREAD_CB_SIZE                 (osRtxThreadCbSize)
+#define XF_OSAL_PORT_MUTEX_CB_SIZE                  (osRtxMutexCbSize)
+#define XF_OSAL_PORT_QUEUE_CB_SIZE                  (osRtxMessageQueueCbSize)
+#define XF_OSAL_PORT_QUEUE_MEM_SIZE(count, size)    (osRtxMessageQueueMemSize((count), (size)))
+#endif
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Global Prototypes] ================================= */
+
+#if XF_OSAL_IDLE_HOOK_IS_ENABLE
+/**
+ * @brief 空闲处理，应在 RTOS 的空闲线程中循环调用（RTX5 中为 osRtxIdleThread()）。
+ *
+ * 调用空闲钩子；定义了 XF_CMSIS_IDLE_SLEEP() 时再暂停内核，
+ * 依次调用 xf_osal_sleep_hooks_t::pre_sleep、XF_CMSIS_IDLE_SLEEP()、xf_osal_sleep_hooks_t::post_sleep,
+ * 最后按实际睡眠时间恢复内核。
+ */
+void xf_cmsis_idle_process(void);
+#endif
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+static inline xf_err_t transform_to_xf_err(osStatus_t status)
+{
+    switch (status) {
+    case osOK:
+        return XF_OK;
+    case osErrorTimeout:
+        return XF_ERR_TIMEOUT;
+    case osErrorResource:
+        return XF_ERR_RESOURCE;
+    case osErrorISR:
+        return XF_ERR_ISR;
+    case osErrorParameter:
+        return XF_ERR_INVALID_ARG;
+    case osErrorNoMemory:
+        return XF_ERR_NO_MEM;
+    case osError:
+        return XF_FAIL;
+    default:
+        return XF_FAIL;
+    }
+}
+
+#if XF_OSAL_SELECT_IS_ENABLE
+
+/**
+ * @brief 在 xf_osal_select() 中阻塞等待的线程数，非 0 时对象就绪后需唤醒这些线程。
+ */
+extern volatile uint32_t xf_cmsis_select_waiting;
+
+/**
+ * @brief 对象就绪后唤醒在其所在集合上阻塞等待的线程，可在中断中调用。
+ */
+void xf_cmsis_select_notify(const void *obj);
+
+#define XF_CMSIS_SELECT_NOTIFY(obj)                 \
+    do {                                            \
+        if (xf_cmsis_select_waiting != 0U) {        \
+            xf_cmsis_select_notify(obj);            \
+        }                                           \
+    } while (0)
+
+#else
+
+#define XF_CMSIS_SELECT_NOTIFY(obj) do { (void)(obj); } while (0)
+
+#endif /* XF_OSAL_SELECT_IS_ENABLE */
+
+#if XF_OSAL_SEMAPHORE_IS_ENABLE
+
+static inline xf_err_t xf_osal_port_semaphore_acquire(xf_osal_semaphore_t semaphore, uint32_t timeout)
+{
+    return transform_to_xf_err(osSemaphoreAcquire((osSemaphoreId_t)semaphore, timeout));
+}
+
+static inline xf_err_t xf_osal_port_semaphore_release(xf_osal_semaphore_t semaphore)
+{
+    xf_err_t err = transform_to_xf_err(osSemaphoreRelease((osSemaphoreId_t)semaphore));
+
+    if (err == XF_OK) {
+        XF_CMSIS_SELECT_NOTIFY(semaphore);
+    }
+
+    return err;
+}
+
+/* CMSIS-OS2 实现内部自行区分中断上下文，以下 *_from_isr 与普通接口相同 */
+
+static inline xf_err_t xf_osal_port_semaphore_acquire_from_isr(xf_osal_semaphore_t semaphore)
+{
+    return transform_to_xf_err(osSemaphoreAcquire((osSemaphoreId_t)semaphore, 0U));
+}
+
+static inline xf_err_t xf_osal_port_semaphore_release_from_isr(xf_osal_semaphore_t semaphore)
+{
+    return xf_osal_port_semaphore_release(semaphore);
+}
+
+#endif /* XF_OSAL_SEMAPHORE_IS_ENABLE */
+
+#if XF_OSAL_MUTEX_IS_ENABLE
+
+static inline xf_err_t xf_osal_port_mutex_acquire(xf_osal_mutex_t mutex, uint32_t timeout)
+{
+    return transform_to_xf_err(osMutexAcquire((osMutexId_t)mutex, timeout));
+}
+
+static inline xf_err_t xf_osal_port_mutex_release(xf_osal_mutex_t mutex)
+{
+    return transform_to_xf_err(osMutexRelease((osMutexId_t)mutex));
+}
+
+#endif /* XF_OSAL_MUTEX_IS_ENABLE */
+
+#if XF_OSAL_QUEUE_IS_ENABLE
+
+/* 邮箱模式的消息队列句柄最低位置 1 */
+#define XF_CMSIS_QUEUE_ID(queue)            ((osMessageQueueId_t)((uintptr_t)(queue) & ~(uintptr_t)1U))
+#define XF_CMSIS_QUEUE_IS_OVERWRITE(queue)  (((uintptr_t)(queue) & 1U) != 0U)
+
+/**
+ * @brief 向邮箱模式的消息队列放入消息，邮箱已满时覆盖旧消息。
+ */
+xf_err_t xf_cmsis_queue_overwrite(xf_osal_queue_t queue, const void *msg_ptr, uint8_t msg_prio);
+
+static inline xf_err_t xf_osal_port_queue_put(
+    xf_osal_queue_t queue, const void *msg_ptr, uint8_t msg_prio, uint32_t timeout)
+{
+    xf_err_t err;
+
+    if (XF_CMSIS_QUEUE_IS_OVERWRITE(queue)) {
+        err = xf_cmsis_queue_overwrite(queue, msg_ptr, msg_prio);
+    } else {
+        err = transform_to_xf_err(osMessageQueuePut(XF_CMSIS_QUEUE_ID(queue), msg_ptr, msg_prio, timeout));
+    }
+
+    if (err == XF_OK) {
+        XF_CMSIS_SELECT_NOTIFY(queue);
+    }
+
+    return err;
+}
+
+static inline xf_err_t xf_osal_port_queue_get(
+    xf_osal_queue_t queue, void *msg_ptr, uint8_t *msg_prio, uint32_t timeout)
+{
+    return transform_to_xf_err(osMessageQueueGet(XF_CMSIS_QUEUE_ID(queue), msg_ptr, msg_prio, timeout));
+}
+
+static inline xf_err_t xf_osal_port_queue_put_from_isr(
+    xf_osal_queue_t queue, const void *msg_ptr, uint8_t msg_prio)
+{
+    return xf_osal_port_queue_put(queue, msg_ptr, msg_prio, 0U);
+}
+
+static inline xf_err_t xf_osal_port_queue_get_from_isr(
+    xf_osal_queue_t queue, void *msg_ptr, uint8_t *msg_prio)
+{
+    return transform_to_xf_err(osMessageQueueGet(XF_CMSIS_QUEUE_ID(queue), msg_ptr, msg_prio, 0U));
+}
+
+#endif /* XF_OSAL_QUEUE_IS_ENABLE */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif // __XF_OSAL_PORT_H__
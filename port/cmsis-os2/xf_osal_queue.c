@@ -29,33 +29,112 @@
 
 xf_osal_queue_t xf_osal_queue_create(uint32_t msg_count, uint32_t msg_size, const xf_osal_queue_attr_t *attr)
 {
-    return (xf_osal_queue_t)osMessageQueueNew(msg_count, msg_size, (const osMessageQueueAttr_t *)attr);
+    osMessageQueueAttr_t mq_attr;
+    osMessageQueueId_t id;
+    xf_osal_queue_t queue;
+
+    if ((attr == NULL) || ((attr->attr_bits & XF_OSAL_QUEUE_OVERWRITE) == 0U)) {
+        queue = (xf_osal_queue_t)osMessageQueueNew(msg_count, msg_size, (const osMessageQueueAttr_t *)attr);
+    } else {
+        if ((msg_count != 1U) || (msg_size > XF_CMSIS_QUEUE_OVERWRITE_MSG_MAX)) {
+            return NULL;
+        }
+
+        /* 邮箱属性位由本层处理，不传给 CMSIS-RTOS2 */
+        mq_attr = *(const osMessageQueueAttr_t *)attr;
+        mq_attr.attr_bits &= ~XF_OSAL_QUEUE_OVERWRITE;
+
+        id = osMessageQueueNew(msg_count, msg_size, &mq_attr);
+        if (id == NULL) {
+            return NULL;
+        }
+
+        /* Set LSB as overwrite flag */
+        queue = (xf_osal_queue_t)((uintptr_t)id | 1U);
+    }
+
+    if ((queue != NULL) && ((attr == NULL) || (attr->cb_mem == NULL))) {
+        XF_CMSIS_ALLOC_HOOK(XF_OSAL_ALLOC_OP_ALLOC, XF_OSAL_OBJ_QUEUE, queue, (attr != NULL) ? attr->name : NULL);
+    }
+
+    return queue;
 }
 
 xf_err_t xf_osal_queue_put(xf_osal_queue_t queue, const void *msg_ptr, uint8_t msg_prio, uint32_t timeout)
 {
-    osStatus_t status = osMessageQueuePut((osMessageQueueId_t) queue, msg_ptr, msg_prio, timeout);
-    xf_err_t err = transform_to_xf_err(status);
-
-    return err;
+    return xf_osal_port_queue_put(queue, msg_ptr, msg_prio, timeout);
 }
 
 xf_err_t xf_osal_queue_get(xf_osal_queue_t queue, void *msg_ptr, uint8_t *msg_prio, uint32_t timeout)
 {
-    osStatus_t status = osMessageQueueGet((osMessageQueueId_t) queue, msg_ptr, msg_prio, timeout);
-    xf_err_t err = transform_to_xf_err(status);
+    return xf_osal_port_queue_get(queue, msg_ptr, msg_prio, timeout);
+}
 
-    return err;
+xf_err_t xf_osal_queue_put_from_isr(xf_osal_queue_t queue, const void *msg_ptr, uint8_t msg_prio)
+{
+    return xf_osal_port_queue_put_from_isr(queue, msg_ptr, msg_prio);
+}
+
+xf_err_t xf_osal_queue_get_from_isr(xf_osal_queue_t queue, void *msg_ptr, uint8_t *msg_prio)
+{
+    return xf_osal_port_queue_get_from_isr(queue, msg_ptr, msg_prio);
+}
+
+xf_err_t xf_osal_queue_peek(xf_osal_queue_t queue, void *msg_ptr, uint32_t timeout)
+{
+    osMessageQueueId_t id = XF_CMSIS_QUEUE_ID(queue);
+    osStatus_t status;
+    int32_t lock;
+    uint8_t prio;
+
+    if ((id == NULL) || (msg_ptr == NULL)) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    /* 取出后再放回会改变普通队列中的消息顺序，只有邮箱可以这样模拟 */
+    if (!XF_CMSIS_QUEUE_IS_OVERWRITE(queue)) {
+        return XF_ERR_NOT_SUPPORTED;
+    }
+
+    for (;;) {
+        /* 中断中 osKernelLock() 返回 osErrorISR, 此时不锁定调度器 */
+        lock = osKernelLock();
+        status = osMessageQueueGet(id, msg_ptr, &prio, 0U);
+        if (status == osOK) {
+            (void)osMessageQueuePut(id, msg_ptr, prio, 0U);
+        }
+        if (lock >= 0) {
+            (void)osKernelRestoreLock(lock);
+        } else if (timeout != 0U) {
+            return XF_ERR_INVALID_ARG;
+        }
+
+        if (status == osOK) {
+            return XF_OK;
+        }
+
+        if (timeout == 0U) {
+            return XF_ERR_RESOURCE;
+        }
+
+        (void)osDelay(1U);
+        if (timeout != XF_OSAL_WAIT_FOREVER) {
+            timeout--;
+            if (timeout == 0U) {
+                return XF_ERR_TIMEOUT;
+            }
+        }
+    }
 }
 
 uint32_t xf_osal_queue_get_count(xf_osal_queue_t queue)
 {
-    return osMessageQueueGetCount((osMessageQueueId_t) queue);
+    return osMessageQueueGetCount(XF_CMSIS_QUEUE_ID(queue));
 }
 
 xf_err_t xf_osal_queue_reset(xf_osal_queue_t queue)
 {
-    osStatus_t status = osMessageQueueReset((osMessageQueueId_t) queue);
+    osStatus_t status = osMessageQueueReset(XF_CMSIS_QUEUE_ID(queue));
     xf_err_t err = transform_to_xf_err(status);
 
     return err;
@@ -63,12 +142,42 @@ xf_err_t xf_osal_queue_reset(xf_osal_queue_t queue)
 
 xf_err_t xf_osal_queue_delete(xf_osal_queue_t queue)
 {
-    osStatus_t status = osMessageQueueDelete((osMessageQueueId_t) queue);
+    osStatus_t status = osMessageQueueDelete(XF_CMSIS_QUEUE_ID(queue));
     xf_err_t err = transform_to_xf_err(status);
 
+    if (err == XF_OK) {
+        XF_CMSIS_ALLOC_HOOK(XF_OSAL_ALLOC_OP_FREE, XF_OSAL_OBJ_QUEUE, queue, NULL);
+    }
+
     return err;
 }
 
+xf_err_t xf_cmsis_queue_overwrite(xf_osal_queue_t queue, const void *msg_ptr, uint8_t msg_prio)
+{
+    osMessageQueueId_t id = XF_CMSIS_QUEUE_ID(queue);
+    uint8_t old_msg[XF_CMSIS_QUEUE_OVERWRITE_MSG_MAX];
+    osStatus_t status;
+    int32_t lock;
+
+    if ((id == NULL) || (msg_ptr == NULL)) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    /* 锁定调度器，避免其他线程在取出旧消息与放入新消息之间插入；中断中无需锁定 */
+    lock = osKernelLock();
+    status = osMessageQueuePut(id, msg_ptr, msg_prio, 0U);
+    if (status == osErrorResource) {
+        /* 邮箱已满，丢弃旧消息 */
+        (void)osMessageQueueGet(id, old_msg, NULL, 0U);
+        status = osMessageQueuePut(id, msg_ptr, msg_prio, 0U);
+    }
+    if (lock >= 0) {
+        (void)osKernelRestoreLock(lock);
+    }
+
+    return transform_to_xf_err(status);
+}
+
 /* ==================== [Static Functions] ================================== */
 
 #endif
@@ -0,0 +1,422 @@
+/**
+ * @file xf_osal_select.c
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_osal_internal.h"
+
+#if XF_OSAL_SELECT_IS_ENABLE
+
+/* ==================== [Defines] =========================================== */
+
+#define SELECT_HASH(obj)    ((((uintptr_t)(obj)) >> 3) & (XF_CMSIS_SELECT_HASH_SIZE - 1U))
+
+/* ==================== [Typedefs] ========================================== */
+
+/*
+ * CMSIS-RTOS2 没有队列集，这里逐个检查成员是否就绪；都未就绪时登记到集合的等待者链表，
+ * 阻塞在线程标志 XF_CMSIS_WAKE_FLAG 上。
+ * 每个成员同时挂在以对象地址散列的全局表中，消息队列写入、信号量释放、事件置位的路径
+ * 据此找到对象所在的集合，只唤醒在该集合上等待的线程。
+ *
+ * 链表在线程中修改时锁定调度器；中断中无法锁定调度器，只读遍历。
+ * 单核上中断会在线程修改的两步之间完整执行，摘下的节点在中断返回后才释放。
+ */
+
+typedef enum _select_type_t {
+    SELECT_TYPE_QUEUE = 0,
+    SELECT_TYPE_SEMAPHORE,
+    SELECT_TYPE_EVENT,
+} select_type_t;
+
+struct _select_cb_t;
+
+typedef struct _select_member_t {
+    struct _select_member_t    *next;       /* 集合中的下一个成员 */
+    struct _select_member_t    *hnext;      /* 散列表同一槽位的下一个成员 */
+    struct _select_cb_t        *cb;         /* 所在集合 */
+    void                       *obj;
+    select_type_t               type;
+    uint32_t                    flags;
+} select_member_t;
+
+/* 等待节点，位于等待线程的栈上 */
+typedef struct _select_waiter_t {
+    struct _select_waiter_t    *next;
+    osThreadId_t                thread;
+} select_waiter_t;
+
+typedef struct _select_cb_t {
+    select_member_t    *head;
+    select_waiter_t    *waiters;
+    const char         *name;
+    uint32_t            dyn;        /* 控制块是否动态分配 */
+} select_cb_t;
+
+/* ==================== [Static Prototypes] ================================= */
+
+static xf_err_t select_add(select_cb_t *cb, void *obj, select_type_t type, uint32_t flags);
+static uint32_t select_is_ready(const select_member_t *member);
+static void *select_scan(select_cb_t *cb);
+static select_member_t *select_hash_find(const void *obj);
+static void select_hash_remove(select_member_t *member);
+static xf_err_t select_waiter_register(select_cb_t *cb, select_waiter_t *waiter);
+static void select_waiter_unregister(select_cb_t *cb, select_waiter_t *waiter);
+
+/* ==================== [Static Variables] ================================== */
+
+static select_member_t *volatile s_select_hash[XF_CMSIS_SELECT_HASH_SIZE];
+
+/* ==================== [Global Variables] ================================== */
+
+volatile uint32_t xf_cmsis_select_waiting = 0U;
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+xf_osal_select_t xf_osal_select_create(uint32_t max_events, const xf_osal_select_attr_t *attr)
+{
+    select_cb_t *cb = NULL;
+    uint32_t dyn = 0U;
+
+    if (max_events == 0U) {
+        return NULL;
+    }
+
+    if (attr == NULL || (attr->cb_mem == NULL && attr->cb_size == 0U)) {
+        cb = (select_cb_t *)XF_CMSIS_MALLOC(sizeof(select_cb_t));
+        dyn = 1U;
+    } else if (attr->cb_mem != NULL && attr->cb_size >= sizeof(select_cb_t)) {
+        cb = (select_cb_t *)attr->cb_mem;
+    }
+
+    if (cb != NULL) {
+        cb->head    = NULL;
+        cb->waiters = NULL;
+        cb->name = (attr != NULL) ? attr->name : NULL;
+        cb->dyn  = dyn;
+    }
+
+    return (xf_osal_select_t)cb;
+}
+
+#if XF_OSAL_QUEUE_IS_ENABLE
+xf_err_t xf_osal_select_add_queue(xf_osal_select_t select, xf_osal_queue_t queue)
+{
+    return select_add((select_cb_t *)select, (void *)queue, SELECT_TYPE_QUEUE, 0U);
+}
+#endif
+
+#if XF_OSAL_SEMAPHORE_IS_ENABLE
+xf_err_t xf_osal_select_add_semaphore(xf_osal_select_t select, xf_osal_semaphore_t semaphore)
+{
+    return select_add((select_cb_t *)select, (void *)semaphore, SELECT_TYPE_SEMAPHORE, 0U);
+}
+#endif
+
+#if XF_OSAL_EVENT_IS_ENABLE
+xf_err_t xf_osal_select_add_event(xf_osal_select_t select, xf_osal_event_t event, uint32_t flags)
+{
+    if (flags == 0U) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    return select_add((select_cb_t *)select, (void *)event, SELECT_TYPE_EVENT, flags);
+}
+#endif
+
+xf_err_t xf_osal_select_remove(xf_osal_select_t select, void *obj)
+{
+    select_cb_t *cb = (select_cb_t *)select;
+    select_member_t **pp;
+    select_member_t *found = NULL;
+    int32_t lock;
+
+    if ((cb == NULL) || (obj == NULL)) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    lock = osKernelLock();
+    if (lock < 0) {
+        return transform_to_xf_err((osStatus_t)lock);
+    }
+    for (pp = &cb->head; *pp != NULL; pp = &(*pp)->next) {
+        if ((*pp)->obj == obj) {
+            found = *pp;
+            *pp = found->next;
+            select_hash_remove(found);
+            break;
+        }
+    }
+    (void)osKernelRestoreLock(lock);
+
+    if (found == NULL) {
+        return XF_ERR_RESOURCE;
+    }
+
+    XF_CMSIS_FREE(found);
+
+    return XF_OK;
+}
+
+xf_err_t xf_osal_select(xf_osal_select_t select, void **ready, uint32_t timeout)
+{
+    select_cb_t *cb = (select_cb_t *)select;
+    select_waiter_t waiter;
+    uint32_t remaining;
+    xf_err_t err;
+    void *obj;
+
+    if ((cb == NULL) || (ready == NULL)) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    *ready = NULL;
+
+    obj = select_scan(cb);
+    if (obj != NULL) {
+        *ready = obj;
+        return XF_OK;
+    }
+
+    if (timeout == 0U) {
+        return XF_ERR_RESOURCE;
+    }
+
+    err = select_waiter_register(cb, &waiter);
+    if (err != XF_OK) {
+        /* 中断中只能以 timeout 为 0 调用 */
+        return err;
+    }
+
+    remaining = (timeout == XF_OSAL_WAIT_FOREVER) ? osWaitForever : timeout;
+
+    for (;;) {
+        /* 登记后再检查一次，登记前就绪的对象不会被错过 */
+        obj = select_scan(cb);
+        if ((obj != NULL) || (remaining == 0U)) {
+            break;
+        }
+
+        (void)xf_cmsis_wait_wake(&remaining);
+    }
+
+    select_waiter_unregister(cb, &waiter);
+
+    *ready = obj;
+
+    return (obj != NULL) ? XF_OK : XF_ERR_TIMEOUT;
+}
+
+xf_err_t xf_osal_select_delete(xf_osal_select_t select)
+{
+    select_cb_t *cb = (select_cb_t *)select;
+
+    if (cb == NULL) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    if (cb->head != NULL) {
+        return XF_ERR_RESOURCE;
+    }
+
+    if (cb->dyn != 0U) {
+        XF_CMSIS_FREE(cb);
+    }
+
+    return XF_OK;
+}
+
+void xf_cmsis_select_notify(const void *obj)
+{
+    select_member_t *member;
+    select_waiter_t *waiter;
+    int32_t lock;
+
+    lock = osKernelLock();
+
+    /* 不在任何集合中的对象（最常见的情况）只查找一个槽位 */
+    member = select_hash_find(obj);
+    if (member != NULL) {
+        for (waiter = member->cb->waiters; waiter != NULL; waiter = waiter->next) {
+            xf_cmsis_wake(waiter->thread);
+        }
+    }
+
+    if (lock >= 0) {
+        (void)osKernelRestoreLock(lock);
+    }
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static xf_err_t select_add(select_cb_t *cb, void *obj, select_type_t type, uint32_t flags)
+{
+    select_member_t *member;
+    select_member_t **pp;
+    int32_t lock;
+
+    if ((cb == NULL) || (obj == NULL)) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    member = (select_member_t *)XF_CMSIS_MALLOC(sizeof(select_member_t));
+    if (member == NULL) {
+        return XF_ERR_NO_MEM;
+    }
+
+    member->next  = NULL;
+    member->cb    = cb;
+    member->obj   = obj;
+    member->type  = type;
+    member->flags = flags;
+
+    lock = osKernelLock();
+    if (lock < 0) {
+        XF_CMSIS_FREE(member);
+        return transform_to_xf_err((osStatus_t)lock);
+    }
+    if (select_hash_find(obj) == NULL) {
+        for (pp = &cb->head; *pp != NULL; pp = &(*pp)->next) {
+        }
+        *pp = member;
+        /* 先链好再发布到散列表，中断中遍历时看到的总是完整的节点 */
+        member->hnext = s_select_hash[SELECT_HASH(obj)];
+        s_select_hash[SELECT_HASH(obj)] = member;
+        member = NULL;
+    }
+    (void)osKernelRestoreLock(lock);
+
+    if (member != NULL) {
+        /* 已在本集合或其他集合中 */
+        XF_CMSIS_FREE(member);
+        return XF_ERR_RESOURCE;
+    }
+
+    return XF_OK;
+}
+
+static uint32_t select_is_ready(const select_member_t *member)
+{
+    switch (member->type) {
+#if XF_OSAL_QUEUE_IS_ENABLE
+    case SELECT_TYPE_QUEUE:
+        return (osMessageQueueGetCount(XF_CMSIS_QUEUE_ID(member->obj)) != 0U) ? 1U : 0U;
+#endif
+#if XF_OSAL_SEMAPHORE_IS_ENABLE
+    case SELECT_TYPE_SEMAPHORE:
+        return (osSemaphoreGetCount((osSemaphoreId_t)member->obj) != 0U) ? 1U : 0U;
+#endif
+#if XF_OSAL_EVENT_IS_ENABLE
+    case SELECT_TYPE_EVENT: {
+        uint32_t flags = osEventFlagsGet((osEventFlagsId_t)member->obj);
+        return (((flags & osFlagsError) == 0U) && ((flags & member->flags) != 0U)) ? 1U : 0U;
+    }
+#endif
+    default:
+        return 0U;
+    }
+}
+
+static void *select_scan(select_cb_t *cb)
+{
+    select_member_t **pp;
+    select_member_t *member;
+    void *obj = NULL;
+    int32_t lock;
+
+    lock = osKernelLock();
+
+    for (pp = &cb->head; *pp != NULL; pp = &(*pp)->next) {
+        member = *pp;
+        if (select_is_ready(member) != 0U) {
+            obj = member->obj;
+            if ((lock >= 0) && (member->next != NULL)) {
+                /* 移到队尾，避免排在前面的对象一直就绪时饿死后面的对象 */
+                *pp = member->next;
+                while (*pp != NULL) {
+                    pp = &(*pp)->next;
+                }
+                member->next = NULL;
+                *pp = member;
+            }
+            break;
+        }
+    }
+
+    if (lock >= 0) {
+        (void)osKernelRestoreLock(lock);
+    }
+
+    return obj;
+}
+
+static select_member_t *select_hash_find(const void *obj)
+{
+    select_member_t *member;
+
+    for (member = s_select_hash[SELECT_HASH(obj)]; member != NULL; member = member->hnext) {
+        if (member->obj == obj) {
+            break;
+        }
+    }
+
+    return member;
+}
+
+/* 调用者已锁定调度器 */
+static void select_hash_remove(select_member_t *member)
+{
+    select_member_t *volatile *pp;
+
+    for (pp = &s_select_hash[SELECT_HASH(member->obj)]; *pp != NULL; pp = &(*pp)->hnext) {
+        if (*pp == member) {
+            *pp = member->hnext;
+            break;
+        }
+    }
+}
+
+static xf_err_t select_waiter_register(select_cb_t *cb, select_waiter_t *waiter)
+{
+    int32_t lock;
+
+    lock = osKernelLock();
+    if (lock < 0) {
+        return XF_ERR_INVALID_ARG;
+    }
+    waiter->thread = osThreadGetId();
+    waiter->next = cb->waiters;
+    cb->waiters = waiter;
+    xf_cmsis_select_waiting++;
+    (void)osKernelRestoreLock(lock);
+
+    return XF_OK;
+}
+
+static void select_waiter_unregister(select_cb_t *cb, select_waiter_t *waiter)
+{
+    select_waiter_t **pp;
+    int32_t lock;
+
+    lock = osKernelLock();
+    for (pp = &cb->waiters; *pp != NULL; pp = &(*pp)->next) {
+        if (*pp == waiter) {
+            *pp = waiter->next;
+            break;
+        }
+    }
+    xf_cmsis_select_waiting--;
+    (void)osKernelRestoreLock(lock);
+}
+
+#endif
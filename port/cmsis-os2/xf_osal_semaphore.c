@@ -21,6 +21,9 @@
 
 /* ==================== [Static Prototypes] ================================= */
 
+static uint32_t sem_take_n(osSemaphoreId_t id, uint32_t n);
+static uint32_t sem_give_n(osSemaphoreId_t id, uint32_t n);
+
 /* ==================== [Static Variables] ================================== */
 
 /* ==================== [Macros] ============================================ */
@@ -30,23 +33,101 @@
 xf_osal_semaphore_t xf_osal_semaphore_create(uint32_t max_count, uint32_t initial_count,
         const xf_osal_semaphore_attr_t *attr)
 {
-    return (xf_osal_semaphore_t)osSemaphoreNew(max_count, initial_count, (const osSemaphoreAttr_t *)attr);
+    xf_osal_semaphore_t semaphore = (xf_osal_semaphore_t)osSemaphoreNew(
+                                        max_count, initial_count, (const osSemaphoreAttr_t *)attr);
+
+    if ((semaphore != NULL) && ((attr == NULL) || (attr->cb_mem == NULL))) {
+        XF_CMSIS_ALLOC_HOOK(XF_OSAL_ALLOC_OP_ALLOC, XF_OSAL_OBJ_SEMAPHORE, semaphore, (attr != NULL) ? attr->name : NULL);
+    }
+
+    return semaphore;
 }
 
 xf_err_t xf_osal_semaphore_acquire(xf_osal_semaphore_t semaphore, uint32_t timeout)
 {
-    osStatus_t status = osSemaphoreAcquire((osSemaphoreId_t)semaphore, timeout);
-    xf_err_t err = transform_to_xf_err(status);
-
-    return err;
+    return xf_osal_port_semaphore_acquire(semaphore, timeout);
 }
 
 xf_err_t xf_osal_semaphore_release(xf_osal_semaphore_t semaphore)
 {
-    osStatus_t status = osSemaphoreRelease((osSemaphoreId_t)semaphore);
-    xf_err_t err = transform_to_xf_err(status);
+    return xf_osal_port_semaphore_release(semaphore);
+}
 
-    return err;
+xf_err_t xf_osal_semaphore_acquire_from_isr(xf_osal_semaphore_t semaphore)
+{
+    return xf_osal_port_semaphore_acquire_from_isr(semaphore);
+}
+
+xf_err_t xf_osal_semaphore_release_from_isr(xf_osal_semaphore_t semaphore)
+{
+    return xf_osal_port_semaphore_release_from_isr(semaphore);
+}
+
+/*
+ * CMSIS-RTOS2 没有一次取走或释放多个令牌的接口，也无法挂接到释放路径上，
+ * 这里在锁定调度器后逐个进行非阻塞操作，令牌不足时每个 tick 重试一次。
+ */
+xf_err_t xf_osal_semaphore_acquire_n(xf_osal_semaphore_t semaphore, uint32_t n, uint32_t timeout)
+{
+    osSemaphoreId_t id = (osSemaphoreId_t)semaphore;
+    int32_t lock;
+    uint32_t taken;
+
+    if ((id == NULL) || (n == 0U)) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    for (;;) {
+        /* 中断中 osKernelLock() 返回 osErrorISR, 此时不锁定调度器 */
+        lock = osKernelLock();
+        taken = sem_take_n(id, n);
+        if (lock >= 0) {
+            (void)osKernelRestoreLock(lock);
+        } else if (timeout != 0U) {
+            return (taken != 0U) ? XF_OK : XF_ERR_INVALID_ARG;
+        }
+
+        if (taken != 0U) {
+            return XF_OK;
+        }
+
+        if (timeout == 0U) {
+            return XF_ERR_RESOURCE;
+        }
+
+        (void)osDelay(1U);
+        if (timeout != XF_OSAL_WAIT_FOREVER) {
+            timeout--;
+            if (timeout == 0U) {
+                return XF_ERR_TIMEOUT;
+            }
+        }
+    }
+}
+
+xf_err_t xf_osal_semaphore_release_n(xf_osal_semaphore_t semaphore, uint32_t n)
+{
+    osSemaphoreId_t id = (osSemaphoreId_t)semaphore;
+    int32_t lock;
+    uint32_t given;
+
+    if ((id == NULL) || (n == 0U)) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    lock = osKernelLock();
+    given = sem_give_n(id, n);
+    if (lock >= 0) {
+        (void)osKernelRestoreLock(lock);
+    }
+
+    if (given == 0U) {
+        return XF_ERR_RESOURCE;
+    }
+
+    XF_CMSIS_SELECT_NOTIFY(semaphore);
+
+    return XF_OK;
 }
 
 uint32_t xf_osal_semaphore_get_count(xf_osal_semaphore_t semaphore)
@@ -59,9 +140,51 @@ xf_err_t xf_osal_semaphore_delete(xf_osal_semaphore_t semaphore)
     osStatus_t status = osSemaphoreDelete((osSemaphoreId_t)semaphore);
     xf_err_t err = transform_to_xf_err(status);
 
+    if (err == XF_OK) {
+        XF_CMSIS_ALLOC_HOOK(XF_OSAL_ALLOC_OP_FREE, XF_OSAL_OBJ_SEMAPHORE, semaphore, NULL);
+    }
+
     return err;
 }
 
 /* ==================== [Static Functions] ================================== */
 
+static uint32_t sem_take_n(osSemaphoreId_t id, uint32_t n)
+{
+    uint32_t i;
+
+    if (osSemaphoreGetCount(id) < n) {
+        return 0U;
+    }
+
+    for (i = 0U; i < n; i++) {
+        if (osSemaphoreAcquire(id, 0U) != osOK) {
+            /* 被中断抢先取走了令牌，归还已取得的部分 */
+            while (i-- > 0U) {
+                (void)osSemaphoreRelease(id);
+            }
+            return 0U;
+        }
+    }
+
+    return 1U;
+}
+
+static uint32_t sem_give_n(osSemaphoreId_t id, uint32_t n)
+{
+    uint32_t i;
+
+    for (i = 0U; i < n; i++) {
+        if (osSemaphoreRelease(id) != osOK) {
+            /* 已达到最大令牌计数，撤销已释放的部分 */
+            while (i-- > 0U) {
+                (void)osSemaphoreAcquire(id, 0U);
+            }
+            return 0U;
+        }
+    }
+
+    return 1U;
+}
+
 #endif
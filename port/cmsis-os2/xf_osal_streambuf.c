@@ -0,0 +1,112 @@
+/**
+ * @file xf_osal_streambuf.c
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_osal_internal.h"
+
+#if XF_OSAL_STREAMBUF_IS_ENABLE
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Static Prototypes] ================================= */
+
+/* ==================== [Static Variables] ================================== */
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+/* CMSIS-RTOS2 没有流缓冲区，以下接口均返回不支持 */
+
+xf_osal_streambuf_t xf_osal_streambuf_create(uint32_t size, uint32_t trigger_level,
+        const xf_osal_streambuf_attr_t *attr)
+{
+    (void)size;
+    (void)trigger_level;
+    (void)attr;
+    return NULL;
+}
+
+xf_err_t xf_osal_streambuf_send(xf_osal_streambuf_t streambuf, const void *data, uint32_t len,
+                                uint32_t *sent, uint32_t timeout)
+{
+    (void)streambuf;
+    (void)data;
+    (void)len;
+    (void)timeout;
+    if (sent != NULL) {
+        *sent = 0U;
+    }
+    return XF_ERR_NOT_SUPPORTED;
+}
+
+xf_err_t xf_osal_streambuf_receive(xf_osal_streambuf_t streambuf, void *buf, uint32_t buf_size,
+                                   uint32_t *received, uint32_t timeout)
+{
+    (void)streambuf;
+    (void)buf;
+    (void)buf_size;
+    (void)timeout;
+    if (received != NULL) {
+        *received = 0U;
+    }
+    return XF_ERR_NOT_SUPPORTED;
+}
+
+xf_err_t xf_osal_streambuf_send_from_isr(xf_osal_streambuf_t streambuf, const void *data, uint32_t len,
+        uint32_t *sent)
+{
+    return xf_osal_streambuf_send(streambuf, data, len, sent, 0U);
+}
+
+xf_err_t xf_osal_streambuf_receive_from_isr(xf_osal_streambuf_t streambuf, void *buf, uint32_t buf_size,
+        uint32_t *received)
+{
+    return xf_osal_streambuf_receive(streambuf, buf, buf_size, received, 0U);
+}
+
+uint32_t xf_osal_streambuf_get_count(xf_osal_streambuf_t streambuf)
+{
+    (void)streambuf;
+    return 0U;
+}
+
+uint32_t xf_osal_streambuf_get_space(xf_osal_streambuf_t streambuf)
+{
+    (void)streambuf;
+    return 0U;
+}
+
+xf_err_t xf_osal_streambuf_set_trigger_level(xf_osal_streambuf_t streambuf, uint32_t trigger_level)
+{
+    (void)streambuf;
+    (void)trigger_level;
+    return XF_ERR_NOT_SUPPORTED;
+}
+
+xf_err_t xf_osal_streambuf_reset(xf_osal_streambuf_t streambuf)
+{
+    (void)streambuf;
+    return XF_ERR_NOT_SUPPORTED;
+}
+
+xf_err_t xf_osal_streambuf_delete(xf_osal_streambuf_t streambuf)
+{
+    (void)streambuf;
+    return XF_ERR_NOT_SUPPORTED;
+}
+
+/* ==================== [Static Functions] ================================== */
+
+#endif
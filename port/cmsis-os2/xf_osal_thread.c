@@ -11,25 +11,76 @@
 
 /* ==================== [Includes] ========================================== */
 
+#include <string.h>
+
 #include "xf_osal_internal.h"
+#include "xf_osal_atomic.h"
 
 #if XF_OSAL_THREAD_IS_ENABLE
 
 /* ==================== [Defines] =========================================== */
 
+#if (XF_CMSIS_TLS_NUM > 32U)
+#error "XF_CMSIS_TLS_NUM must not exceed 32"
+#endif
+
+/* 线程局部存储槽位状态：空闲（探测到此结束）与已归还（探测时跳过，可再次占用） */
+#define TLS_SLOT_FREE       ((osThreadId_t)NULL)
+#define TLS_SLOT_RELEASED   ((osThreadId_t)(uintptr_t)1U)
+
 /* ==================== [Typedefs] ========================================== */
 
+typedef struct _tls_slot_t {
+    osThreadId_t    thread;
+    void           *values[XF_CMSIS_TLS_NUM];
+} tls_slot_t;
+
 /* ==================== [Static Prototypes] ================================= */
 
+static uint32_t tls_hash(osThreadId_t thread);
+static tls_slot_t *tls_find(osThreadId_t thread);
+static tls_slot_t *tls_claim(osThreadId_t thread);
+static void tls_release(osThreadId_t thread);
+
 /* ==================== [Static Variables] ================================== */
 
+/* 按线程 ID 散列、线性探测的槽位表，只有槽位的所属线程写 values */
+static tls_slot_t s_tls_slots[XF_CMSIS_TLS_THREAD_MAX];
+/* 已分配的键，bit n 对应键 n */
+static uint32_t s_tls_used = 0U;
+static xf_osal_tls_destructor_t s_tls_destructor[XF_CMSIS_TLS_NUM];
+
 /* ==================== [Macros] ============================================ */
 
 /* ==================== [Global Functions] ================================== */
 
 xf_osal_thread_t xf_osal_thread_create(xf_osal_thread_func_t func, void *argument, const xf_osal_thread_attr_t *attr)
 {
-    return (xf_osal_thread_t)osThreadNew((osThreadFunc_t)func, argument, (const osThreadAttr_t *)attr);
+    osThreadAttr_t os_attr;
+    xf_osal_thread_t thread;
+
+    if (attr != NULL) {
+        /* 两者布局不同（osThreadAttr_t 多出 tz_module），不能直接强制转换 */
+        memset(&os_attr, 0, sizeof(os_attr));
+        os_attr.name       = attr->name;
+        os_attr.attr_bits  = attr->attr_bits;
+        os_attr.cb_mem     = attr->cb_mem;
+        os_attr.cb_size    = attr->cb_size;
+        os_attr.stack_mem  = attr->stack_mem;
+        os_attr.stack_size = attr->stack_size;
+        os_attr.priority   = (osPriority_t)attr->priority;
+#if XF_CMSIS_THREAD_AFFINITY_IS_ENABLE
+        os_attr.affinity_mask = attr->affinity_mask;
+#endif
+    }
+
+    thread = (xf_osal_thread_t)osThreadNew((osThreadFunc_t)func, argument, (attr != NULL) ? &os_attr : NULL);
+
+    if ((thread != NULL) && ((attr == NULL) || (attr->cb_mem == NULL))) {
+        XF_CMSIS_ALLOC_HOOK(XF_OSAL_ALLOC_OP_ALLOC, XF_OSAL_OBJ_THREAD, thread, (attr != NULL) ? attr->name : NULL);
+    }
+
+    return thread;
 }
 
 const char *xf_osal_thread_get_name(xf_osal_thread_t thread)
@@ -73,6 +124,43 @@ xf_osal_priority_t xf_osal_thread_get_priority(xf_osal_thread_t thread)
     return (xf_osal_priority_t)osThreadGetPriority((osThreadId_t)thread);
 }
 
+xf_osal_priority_t xf_osal_thread_get_effective_priority(xf_osal_priority_t priority)
+{
+    /* CMSIS-OS2 的优先级与 xf_osal 一一对应 */
+    return priority;
+}
+
+xf_err_t xf_osal_thread_set_affinity(xf_osal_thread_t thread, uint32_t mask)
+{
+#if XF_CMSIS_THREAD_AFFINITY_IS_ENABLE
+    osStatus_t status = osThreadSetAffinityMask((osThreadId_t)thread, mask);
+    xf_err_t err = transform_to_xf_err(status);
+
+    return err;
+#else
+    if ((thread == NULL) || ((mask != 0U) && ((mask & 1U) == 0U))) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    return XF_OK;
+#endif
+}
+
+xf_err_t xf_osal_thread_get_affinity(xf_osal_thread_t thread, uint32_t *mask)
+{
+    if ((thread == NULL) || (mask == NULL)) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+#if XF_CMSIS_THREAD_AFFINITY_IS_ENABLE
+    *mask = osThreadGetAffinityMask((osThreadId_t)thread);
+#else
+    *mask = 1U;
+#endif
+
+    return XF_OK;
+}
+
 xf_err_t xf_osal_thread_yield(void)
 {
 #if XF_CMSIS_THREAD_YIELD_IS_ENABLE
@@ -113,12 +201,19 @@ xf_err_t xf_osal_thread_delete(xf_osal_thread_t thread)
             return XF_FAIL;
         }
 #else
+        tls_release(osThreadGetId());
+        XF_CMSIS_ALLOC_HOOK(XF_OSAL_ALLOC_OP_FREE, XF_OSAL_OBJ_THREAD, osThreadGetId(), NULL);
         osThreadExit();
 #endif
     }
+    tls_release((osThreadId_t)thread);
     status = osThreadTerminate((osThreadId_t)thread);
     err = transform_to_xf_err(status);
 
+    if (err == XF_OK) {
+        XF_CMSIS_ALLOC_HOOK(XF_OSAL_ALLOC_OP_FREE, XF_OSAL_OBJ_THREAD, thread, NULL);
+    }
+
     return err;
 }
 
@@ -155,6 +250,11 @@ xf_err_t xf_osal_thread_notify_set(xf_osal_thread_t thread, uint32_t notify)
 #endif
 }
 
+xf_err_t xf_osal_thread_notify_set_from_isr(xf_osal_thread_t thread, uint32_t notify)
+{
+    return xf_osal_thread_notify_set(thread, notify);
+}
+
 xf_err_t xf_osal_thread_notify_clear(uint32_t notify)
 {
 #if XF_CMSIS_THREAD_NOTIFY_IS_ENABLE
@@ -209,6 +309,178 @@ xf_err_t xf_osal_delay_ms(uint32_t ms)
     return (xf_osal_delay(xf_osal_kernel_ms_to_ticks(ms)));
 }
 
+xf_err_t xf_osal_tls_alloc(xf_osal_tls_key_t *key, xf_osal_tls_destructor_t destructor)
+{
+    xf_err_t err = XF_ERR_NO_MEM;
+    int32_t lock;
+    uint32_t i;
+
+    if (key == NULL) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    lock = osKernelLock();
+    for (i = 0U; i < XF_CMSIS_TLS_NUM; i++) {
+        if ((s_tls_used & (1UL << i)) == 0U) {
+            s_tls_used |= (1UL << i);
+            s_tls_destructor[i] = destructor;
+            *key = i;
+            err = XF_OK;
+            break;
+        }
+    }
+    (void)osKernelRestoreLock(lock);
+
+    return err;
+}
+
+xf_err_t xf_osal_tls_free(xf_osal_tls_key_t key)
+{
+    xf_err_t err = XF_ERR_INVALID_ARG;
+    int32_t lock;
+    uint32_t i;
+
+    if (key >= XF_CMSIS_TLS_NUM) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    lock = osKernelLock();
+    if ((s_tls_used & (1UL << key)) != 0U) {
+        /* 清除各线程中的旧值，以免复用该键后读到旧值或对其调用新的析构函数 */
+        for (i = 0U; i < XF_CMSIS_TLS_THREAD_MAX; i++) {
+            s_tls_slots[i].values[key] = NULL;
+        }
+        s_tls_used &= ~(1UL << key);
+        s_tls_destructor[key] = NULL;
+        err = XF_OK;
+    }
+    (void)osKernelRestoreLock(lock);
+
+    return err;
+}
+
+xf_err_t xf_osal_tls_set(xf_osal_tls_key_t key, void *value)
+{
+    osThreadId_t thread = osThreadGetId();
+    tls_slot_t *slot;
+
+    if ((key >= XF_CMSIS_TLS_NUM) || (thread == NULL)) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    slot = tls_find(thread);
+    if (slot == NULL) {
+        if (value == NULL) {
+            /* 未占用槽位时值本来就是 NULL */
+            return XF_OK;
+        }
+        slot = tls_claim(thread);
+        if (slot == NULL) {
+            return XF_ERR_NO_MEM;
+        }
+    }
+    slot->values[key] = value;
+
+    return XF_OK;
+}
+
+void *xf_osal_tls_get(xf_osal_tls_key_t key)
+{
+    osThreadId_t thread = osThreadGetId();
+    tls_slot_t *slot;
+
+    if ((key >= XF_CMSIS_TLS_NUM) || (thread == NULL)) {
+        return NULL;
+    }
+
+    slot = tls_find(thread);
+
+    return (slot != NULL) ? slot->values[key] : NULL;
+}
+
 /* ==================== [Static Functions] ================================== */
 
+static uint32_t tls_hash(osThreadId_t thread)
+{
+    /* 控制块至少按 8 字节对齐，低位没有区分度 */
+    return (uint32_t)(((uintptr_t)thread >> 3) % XF_CMSIS_TLS_THREAD_MAX);
+}
+
+/**
+ * @brief 查找线程的槽位，不加锁。
+ */
+static tls_slot_t *tls_find(osThreadId_t thread)
+{
+    uint32_t index = tls_hash(thread);
+    osThreadId_t owner;
+    uint32_t i;
+
+    for (i = 0U; i < XF_CMSIS_TLS_THREAD_MAX; i++) {
+        owner = xf_osal_atomic_load(&s_tls_slots[index].thread);
+        if (owner == thread) {
+            return &s_tls_slots[index];
+        }
+        if (owner == TLS_SLOT_FREE) {
+            break;
+        }
+        index = (index + 1U) % XF_CMSIS_TLS_THREAD_MAX;
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief 为当前线程占用一个槽位。只有线程自己会为自己占用槽位，不会重复占用。
+ */
+static tls_slot_t *tls_claim(osThreadId_t thread)
+{
+    uint32_t index = tls_hash(thread);
+    osThreadId_t owner;
+    uint32_t i;
+
+    for (i = 0U; i < XF_CMSIS_TLS_THREAD_MAX; i++) {
+        owner = xf_osal_atomic_load(&s_tls_slots[index].thread);
+        while ((owner == TLS_SLOT_FREE) || (owner == TLS_SLOT_RELEASED)) {
+            /* 失败时 owner 更新为当前值，被其他线程抢走后继续向后探测 */
+            if (xf_osal_atomic_cas(&s_tls_slots[index].thread, &owner, thread)) {
+                return &s_tls_slots[index];
+            }
+        }
+        index = (index + 1U) % XF_CMSIS_TLS_THREAD_MAX;
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief 线程删除前调用析构函数并归还槽位。
+ */
+static void tls_release(osThreadId_t thread)
+{
+    xf_osal_tls_destructor_t destructor;
+    tls_slot_t *slot;
+    void *value;
+    uint32_t i;
+
+    if (thread == NULL) {
+        return;
+    }
+
+    slot = tls_find(thread);
+    if (slot == NULL) {
+        return;
+    }
+
+    for (i = 0U; i < XF_CMSIS_TLS_NUM; i++) {
+        value = slot->values[i];
+        slot->values[i] = NULL;
+        destructor = ((s_tls_used & (1UL << i)) != 0U) ? s_tls_destructor[i] : NULL;
+        if ((value != NULL) && (destructor != NULL)) {
+            destructor(value);
+        }
+    }
+
+    xf_osal_atomic_store(&slot->thread, TLS_SLOT_RELEASED);
+}
+
 #endif
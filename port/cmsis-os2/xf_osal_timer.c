@@ -30,7 +30,13 @@
 xf_osal_timer_t xf_osal_timer_create(xf_osal_timer_func_t func, xf_osal_timer_type_t type, void *argument,
                                      xf_osal_timer_attr_t *attr)
 {
-    return (xf_osal_timer_t)osTimerNew((osTimerFunc_t)func, (osTimerType_t)type, argument, (const osTimerAttr_t *)attr);
+    xf_osal_timer_t timer = (xf_osal_timer_t)osTimerNew((osTimerFunc_t)func, (osTimerType_t)type, argument, (const osTimerAttr_t *)attr);
+
+    if ((timer != NULL) && ((attr == NULL) || (attr->cb_mem == NULL))) {
+        XF_CMSIS_ALLOC_HOOK(XF_OSAL_ALLOC_OP_ALLOC, XF_OSAL_OBJ_TIMER, timer, (attr != NULL) ? attr->name : NULL);
+    }
+
+    return timer;
 }
 
 const char *xf_osal_timer_get_name(xf_osal_timer_t timer)
@@ -68,6 +74,10 @@ xf_err_t xf_osal_timer_delete(xf_osal_timer_t timer)
     osStatus_t status = osTimerDelete((osTimerId_t)timer);
     xf_err_t err = transform_to_xf_err(status);
 
+    if (err == XF_OK) {
+        XF_CMSIS_ALLOC_HOOK(XF_OSAL_ALLOC_OP_FREE, XF_OSAL_OBJ_TIMER, timer, NULL);
+    }
+
     return err;
 }
 
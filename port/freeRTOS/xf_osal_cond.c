@@ -0,0 +1,297 @@
+/**
+ * @file xf_osal_cond.c
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_osal_internal.h"
+
+#if XF_OSAL_COND_IS_ENABLE
+
+/* ==================== [Defines] =========================================== */
+
+/* 广播时每次临界区内最多摘下的等待者数 */
+#define COND_WAKE_BATCH     (8U)
+
+/* ==================== [Typedefs] ========================================== */
+
+/* 等待节点，位于等待线程的栈上 */
+typedef struct _cond_waiter_t {
+    struct _cond_waiter_t  *next;
+    TaskHandle_t            hTask;
+    UBaseType_t             prio;
+    volatile uint32_t       signaled;
+} cond_waiter_t;
+
+/* 条件变量控制块 */
+typedef struct _cond_cb_t {
+    cond_waiter_t  *head;       /* 按优先级从高到低、同优先级先到先得排列 */
+    const char     *name;
+    uint32_t        dyn;        /* 控制块是否动态分配 */
+} cond_cb_t;
+
+/* 控制块不得超过公共头文件声明的大小 */
+typedef char cond_cb_size_check_t[(sizeof(cond_cb_t) <= XF_OSAL_COND_CB_SIZE) ? 1 : -1];
+
+/* ==================== [Static Prototypes] ================================= */
+
+static void cond_waiter_insert(cond_cb_t *cb, cond_waiter_t *waiter);
+static void cond_waiter_remove(cond_cb_t *cb, cond_waiter_t *waiter);
+static uint32_t cond_grant(cond_cb_t *cb, TaskHandle_t *wake, uint32_t max);
+static void cond_notify(const TaskHandle_t *wake, uint32_t count);
+
+/* ==================== [Static Variables] ================================== */
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+xf_osal_cond_t xf_osal_cond_create(const xf_osal_cond_attr_t *attr)
+{
+    cond_cb_t *cb;
+    int32_t mem;
+
+    cb = NULL;
+
+    if (IRQ_Context() == 0U) {
+        mem = -1;
+
+        if (attr != NULL) {
+            if ((attr->cb_mem != NULL) && (attr->cb_size >= sizeof(cond_cb_t))) {
+                /* The memory for control block is provided, use static object */
+                mem = 1;
+            } else {
+                if ((attr->cb_mem == NULL) && (attr->cb_size == 0U)) {
+                    /* Control block will be allocated from the dynamic pool */
+                    mem = 0;
+                }
+            }
+        } else {
+            mem = 0;
+        }
+
+        if (mem == 1) {
+            cb = (cond_cb_t *)attr->cb_mem;
+        } else {
+            if (mem == 0) {
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+                cb = (cond_cb_t *)pvPortMalloc(sizeof(cond_cb_t));
+#endif
+            }
+        }
+
+        if (cb != NULL) {
+            cb->head = NULL;
+            cb->name = (attr != NULL) ? attr->name : NULL;
+            cb->dyn  = (mem == 0) ? 1U : 0U;
+        }
+    }
+
+    /* Return condition variable ID */
+    return ((xf_osal_cond_t)cb);
+}
+
+xf_err_t xf_osal_cond_wait(xf_osal_cond_t cond, xf_osal_mutex_t mutex)
+{
+    return xf_osal_cond_timedwait(cond, mutex, XF_OSAL_WAIT_FOREVER);
+}
+
+xf_err_t xf_osal_cond_timedwait(xf_osal_cond_t cond, xf_osal_mutex_t mutex, uint32_t timeout)
+{
+    cond_cb_t *cb = (cond_cb_t *)cond;
+    cond_waiter_t waiter;
+    TickType_t remaining;
+    xf_err_t stat;
+
+    if (IRQ_Context() != 0U) {
+        return XF_ERR_ISR;
+    }
+
+    if ((cb == NULL) || (mutex == NULL)) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    waiter.next     = NULL;
+    waiter.hTask    = xTaskGetCurrentTaskHandle();
+    waiter.prio     = uxTaskPriorityGet(NULL);
+    waiter.signaled = 0U;
+
+    /* 先入队再释放互斥锁，保证释放后发出的通知不会丢失 */
+    XF_OSAL_ENTER_CRITICAL();
+    cond_waiter_insert(cb, &waiter);
+    XF_OSAL_EXIT_CRITICAL();
+
+    stat = xf_osal_mutex_release(mutex);
+    if (stat != XF_OK) {
+        XF_OSAL_ENTER_CRITICAL();
+        cond_waiter_remove(cb, &waiter);
+        XF_OSAL_EXIT_CRITICAL();
+        return stat;
+    }
+
+    remaining = (timeout == XF_OSAL_WAIT_FOREVER) ? portMAX_DELAY : (TickType_t)timeout;
+
+    while ((waiter.signaled == 0U) && (remaining != 0U)) {
+        if (xf_osal_port_wait_wake(&remaining) == pdFALSE) {
+            break;
+        }
+    }
+
+    XF_OSAL_ENTER_CRITICAL();
+    if (waiter.signaled != 0U) {
+        stat = XF_OK;
+    } else {
+        /* 超时，且在此之前未被通知 */
+        cond_waiter_remove(cb, &waiter);
+        stat = (timeout != 0U) ? XF_ERR_TIMEOUT : XF_ERR_RESOURCE;
+    }
+    XF_OSAL_EXIT_CRITICAL();
+
+    (void)xf_osal_mutex_acquire(mutex, XF_OSAL_WAIT_FOREVER);
+
+    /* Return execution status */
+    return (stat);
+}
+
+xf_err_t xf_osal_cond_signal(xf_osal_cond_t cond)
+{
+    cond_cb_t *cb = (cond_cb_t *)cond;
+    TaskHandle_t wake[1];
+    uint32_t count;
+
+    if (IRQ_Context() != 0U) {
+        return XF_ERR_ISR;
+    }
+
+    if (cb == NULL) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    XF_OSAL_ENTER_CRITICAL();
+    count = cond_grant(cb, wake, 1U);
+    XF_OSAL_EXIT_CRITICAL();
+
+    cond_notify(wake, count);
+
+    return XF_OK;
+}
+
+xf_err_t xf_osal_cond_broadcast(xf_osal_cond_t cond)
+{
+    cond_cb_t *cb = (cond_cb_t *)cond;
+    TaskHandle_t wake[COND_WAKE_BATCH];
+    uint32_t count;
+
+    if (IRQ_Context() != 0U) {
+        return XF_ERR_ISR;
+    }
+
+    if (cb == NULL) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    /* 分批摘下等待者，临界区的长度与等待者数无关 */
+    do {
+        XF_OSAL_ENTER_CRITICAL();
+        count = cond_grant(cb, wake, COND_WAKE_BATCH);
+        XF_OSAL_EXIT_CRITICAL();
+
+        cond_notify(wake, count);
+    } while (count == COND_WAKE_BATCH);
+
+    return XF_OK;
+}
+
+xf_err_t xf_osal_cond_delete(xf_osal_cond_t cond)
+{
+    cond_cb_t *cb = (cond_cb_t *)cond;
+    xf_err_t stat;
+
+    if (IRQ_Context() != 0U) {
+        stat = XF_ERR_ISR;
+    } else if (cb == NULL) {
+        stat = XF_ERR_INVALID_ARG;
+    } else if (cb->head != NULL) {
+        stat = XF_ERR_RESOURCE;
+    } else {
+        stat = XF_OK;
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1) && !defined(USE_FreeRTOS_HEAP_1)
+        if (cb->dyn != 0U) {
+            vPortFree(cb);
+        }
+#endif
+    }
+
+    /* Return execution status */
+    return (stat);
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static void cond_waiter_insert(cond_cb_t *cb, cond_waiter_t *waiter)
+{
+    cond_waiter_t **pp = &cb->head;
+
+    while ((*pp != NULL) && ((*pp)->prio >= waiter->prio)) {
+        pp = &(*pp)->next;
+    }
+
+    waiter->next = *pp;
+    *pp = waiter;
+}
+
+static void cond_waiter_remove(cond_cb_t *cb, cond_waiter_t *waiter)
+{
+    cond_waiter_t **pp = &cb->head;
+
+    while (*pp != NULL) {
+        if (*pp == waiter) {
+            *pp = waiter->next;
+            break;
+        }
+        pp = &(*pp)->next;
+    }
+}
+
+/**
+ * @brief 在临界区内从队首摘下最多 max 个等待者并标记为已通知。
+ *
+ * @param wake 需唤醒的线程。
+ * @return uint32_t 需唤醒的线程数。
+ */
+static uint32_t cond_grant(cond_cb_t *cb, TaskHandle_t *wake, uint32_t max)
+{
+    cond_waiter_t *waiter;
+    uint32_t count = 0U;
+
+    while ((count < max) && ((waiter = cb->head) != NULL)) {
+        cb->head = waiter->next;
+        /* 置位后等待者可能立即返回，之后不得再访问 waiter */
+        wake[count] = waiter->hTask;
+        count++;
+        waiter->signaled = 1U;
+    }
+
+    return count;
+}
+
+/**
+ * @brief 在临界区外唤醒已被通知的线程。
+ */
+static void cond_notify(const TaskHandle_t *wake, uint32_t count)
+{
+    uint32_t i;
+
+    for (i = 0U; i < count; i++) {
+        xf_osal_port_wake(wake[i]);
+    }
+}
+
+#endif
@@ -30,9 +30,11 @@
 xf_osal_event_t xf_osal_event_create(const xf_osal_event_attr_t *attr)
 {
     EventGroupHandle_t hEventGroup;
+    void *cb_mem;
     int32_t mem;
 
     hEventGroup = NULL;
+    cb_mem = NULL;
 
     if (IRQ_Context() == 0U) {
         mem = -1;
@@ -41,6 +43,7 @@ xf_osal_event_t xf_osal_event_create(const xf_osal_event_attr_t *attr)
             if ((attr->cb_mem != NULL) && (attr->cb_size >= sizeof(StaticEventGroup_t))) {
                 /* The memory for control block is provided, use static object */
                 mem = 1;
+                cb_mem = attr->cb_mem;
             } else {
                 if ((attr->cb_mem == NULL) && (attr->cb_size == 0U)) {
                     /* Control block will be allocated from the dynamic pool */
@@ -51,9 +54,17 @@ xf_osal_event_t xf_osal_event_create(const xf_osal_event_attr_t *attr)
             mem = 0;
         }
 
+        if (mem == 0) {
+            /* Prefer the object pool over the heap */
+            cb_mem = xf_osal_port_pool_alloc(XF_OSAL_OBJ_EVENT);
+            if (cb_mem != NULL) {
+                mem = 1;
+            }
+        }
+
         if (mem == 1) {
 #if (configSUPPORT_STATIC_ALLOCATION == 1)
-            hEventGroup = xEventGroupCreateStatic(attr->cb_mem);
+            hEventGroup = xEventGroupCreateStatic(cb_mem);
 #endif
         } else {
             if (mem == 0) {
@@ -62,6 +73,13 @@ xf_osal_event_t xf_osal_event_create(const xf_osal_event_attr_t *attr)
 #endif
             }
         }
+
+        if (hEventGroup == NULL) {
+            xf_osal_port_pool_free(XF_OSAL_OBJ_EVENT, cb_mem);
+        } else if (mem == 0) {
+            XF_OSAL_PORT_ALLOC_HOOK(XF_OSAL_ALLOC_OP_ALLOC, XF_OSAL_OBJ_EVENT, hEventGroup,
+                                    (attr != NULL) ? attr->name : NULL, sizeof(StaticEventGroup_t));
+        }
     }
 
     /* Return event flags ID */
@@ -72,11 +90,28 @@ xf_err_t xf_osal_event_set(xf_osal_event_t event, uint32_t flags)
 {
     EventGroupHandle_t hEventGroup = (EventGroupHandle_t)event;
     xf_err_t err = XF_OK;
-    BaseType_t yield;
 
     if ((hEventGroup == NULL) || ((flags & XF_OSAL_EVENT_FLAGS_INVALID_BITS) != 0U)) {
         err = XF_ERR_INVALID_ARG;
     } else if (IRQ_Context() != 0U) {
+        err = xf_osal_event_set_from_isr(event, flags);
+    } else {
+        xEventGroupSetBits(hEventGroup, (EventBits_t)flags);
+    }
+
+    /* Return event flags after setting */
+    return (err);
+}
+
+xf_err_t xf_osal_event_set_from_isr(xf_osal_event_t event, uint32_t flags)
+{
+    EventGroupHandle_t hEventGroup = (EventGroupHandle_t)event;
+    xf_err_t err = XF_OK;
+    BaseType_t yield;
+
+    if ((hEventGroup == NULL) || ((flags & XF_OSAL_EVENT_FLAGS_INVALID_BITS) != 0U)) {
+        err = XF_ERR_INVALID_ARG;
+    } else {
 #if (configUSE_OS2_EVENTFLAGS_FROM_ISR == 0)
         (void)yield;
         /* Enable timers and xTimerPendFunctionCall function to support osEventFlagsSet from ISR */
@@ -90,11 +125,9 @@ xf_err_t xf_osal_event_set(xf_osal_event_t event, uint32_t flags)
             portYIELD_FROM_ISR(yield);
         }
 #endif
-    } else {
-        xEventGroupSetBits(hEventGroup, (EventBits_t)flags);
     }
 
-    /* Return event flags after setting */
+    /* Return execution status */
     return (err);
 }
 
@@ -211,7 +244,9 @@ xf_err_t xf_osal_event_delete(xf_osal_event_t event)
         stat = XF_ERR_INVALID_ARG;
     } else {
         stat = XF_OK;
+        XF_OSAL_PORT_ALLOC_HOOK(XF_OSAL_ALLOC_OP_FREE, XF_OSAL_OBJ_EVENT, event, NULL, 0U);
         vEventGroupDelete(hEventGroup);
+        xf_osal_port_pool_free(XF_OSAL_OBJ_EVENT, hEventGroup);
     }
 #else
     stat = XF_FAIL;
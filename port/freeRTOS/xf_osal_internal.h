@@ -14,14 +14,11 @@
 
 /* ==================== [Includes] ========================================== */
 
-#include "xf_osal.h"
+/* 对接层源文件：不将公共接口映射为内联实现 */
+#define XF_OSAL_PORT_SOURCE
 
-#include "freertos/FreeRTOS.h"
-#include "freertos/task.h"
-#include "freertos/event_groups.h"
-#include "freertos/semphr.h"
-#include "freertos/timers.h"
-#include "freertos/queue.h"
+#include "xf_osal.h"
+#include "xf_osal_port.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -29,18 +26,6 @@ extern "C" {
 
 /* ==================== [Defines] =========================================== */
 
-#define __STATIC_INLINE static inline
-
-/*是否处于中断上下文中，一般和架构相关*/
-#ifndef IS_IRQ_MODE
-#define IS_IRQ_MODE()  (0U)
-#endif
-
-/*是否禁用了中断宏或函数，一般和架构相关*/
-#ifndef IS_IRQ_MASKED
-#define IS_IRQ_MASKED()  (0U)
-#endif
-
 /*设置系统服务调用（SVC）的优先级，ARM Cortex-M特有*/
 #ifndef SVC_Setup
 #define SVC_Setup()
@@ -56,38 +41,135 @@ extern "C" {
 #define Thread_Priority_Highest (configMAX_PRIORITIES - 1)
 #endif
 
+
+/*
+ * 对接层内部唤醒位，使用线程通知值的保留位 (bit31, 见 THREAD_FLAGS_INVALID_BITS)，
+ * 供条件变量等由对接层自行实现等待队列的对象唤醒线程，不影响用户通知位。
+ */
+#define XF_OSAL_PORT_WAKE_BIT   (1UL << MAX_BITS_TASK_NOTIFY)
+
+/*
+ * xf_osal_tls_alloc() 可使用的第一个线程局部存储指针下标，之前的下标留给其他组件。
+ * ESP-IDF 的 pthread 组件占用下标 0.
+ */
+#ifndef XF_OSAL_PORT_TLS_FIRST_INDEX
+#if defined(ESP_PLATFORM)
+#define XF_OSAL_PORT_TLS_FIRST_INDEX    (1)
+#else
+#define XF_OSAL_PORT_TLS_FIRST_INDEX    (0)
+#endif
+#endif
+
+/* 创建、删除对象时调用分配跟踪钩子，见 xf_osal_kernel_set_alloc_hook() */
+#if XF_OSAL_ALLOC_HOOK_IS_ENABLE
+extern xf_osal_alloc_hook_t volatile xf_osal_port_alloc_hook;
+#define XF_OSAL_PORT_ALLOC_HOOK(op, type, obj, name, size)                          \
+    do {                                                                            \
+        xf_osal_alloc_hook_t _hook = xf_osal_port_alloc_hook;                       \
+        if (_hook != NULL) {                                                        \
+            _hook((op), (type), (void *)(obj), (name), (uint32_t)(size));           \
+        }                                                                           \
+    } while (0)
+#else
+#define XF_OSAL_PORT_ALLOC_HOOK(op, type, obj, name, size)  do { } while (0)
+#endif
+
 /* ==================== [Typedefs] ========================================== */
 
 /* ==================== [Global Prototypes] ================================= */
 
-__STATIC_INLINE uint32_t IRQ_Context(void)
+/**
+ * @brief 从对象池取一个控制块，见 xf_osal_pool.c.
+ *
+ * @param type 对象类型。
+ * @return void* 控制块；该类型未配置对象池或对象池已空时返回 NULL, 调用者改为动态分配。
+ */
+void *xf_osal_port_pool_alloc(xf_osal_obj_type_t type);
+
+/**
+ * @brief 将控制块归还对象池，不是从对象池取出的控制块（包括 NULL）直接忽略。
+ *
+ * @param type  对象类型。
+ * @param block 控制块。
+ */
+void xf_osal_port_pool_free(xf_osal_obj_type_t type, void *block);
+
+#if XF_OSAL_SEMAPHORE_IS_ENABLE && XF_OSAL_SELECT_IS_ENABLE && (configUSE_QUEUE_SETS == 1)
+/**
+ * @brief 将信号量加入或移出等待集合，见 xf_osal_select.c.
+ *
+ * @param add 为 0 时移出，否则加入。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_RESOURCE       信号量令牌数非 0, 加入时已属于其他集合，或移出时不属于该集合
+ */
+xf_err_t xf_osal_port_semaphore_set_select(xf_osal_port_sem_t *sem, QueueSetHandle_t hSet, uint32_t add);
+#endif
+
+/* ==================== [Macros] ============================================ */
+
+/**
+ * @brief 唤醒等待在对接层内部等待队列上的线程。
+ *
+ * @param hTask 线程句柄。
+ */
+__STATIC_INLINE void xf_osal_port_wake(TaskHandle_t hTask)
 {
-    uint32_t irq;
-    BaseType_t state;
-
-    irq = 0U;
-
-    if (IS_IRQ_MODE()) {
-        /* Called from interrupt context */
-        irq = 1U;
-    } else {
-        /* Get FreeRTOS scheduler state */
-        state = xTaskGetSchedulerState();
-
-        if (state != taskSCHEDULER_NOT_STARTED) {
-            /* Scheduler was started */
-            if (IS_IRQ_MASKED()) {
-                /* Interrupts are masked */
-                irq = 1U;
-            }
-        }
-    }
+    (void)xTaskNotify(hTask, XF_OSAL_PORT_WAKE_BIT, eSetBits);
+}
 
-    /* Return context, 0: thread context, 1: IRQ context */
-    return (irq);
+/**
+ * @brief 在中断服务函数中唤醒等待在对接层内部等待队列上的线程。
+ *
+ * @param hTask 线程句柄。
+ * @param yield 需要切换上下文时置为 pdTRUE.
+ */
+__STATIC_INLINE void xf_osal_port_wake_from_isr(TaskHandle_t hTask, BaseType_t *yield)
+{
+    (void)xTaskNotifyFromISR(hTask, XF_OSAL_PORT_WAKE_BIT, eSetBits, yield);
 }
 
-/* ==================== [Macros] ============================================ */
+/**
+ * @brief 阻塞当前线程，直到收到唤醒位或超时。
+ *
+ * 期间收到的用户通知位保留不动，仅唤醒位在返回时被清除。
+ *
+ * @param remaining 剩余等待时间（tick），返回时更新为新的剩余时间。
+ *                  portMAX_DELAY 表示一直等待。
+ * @return BaseType_t
+ *      - pdTRUE    收到唤醒位（可能是此前残留的，调用者需重新检查条件）
+ *      - pdFALSE   超时
+ */
+__STATIC_INLINE BaseType_t xf_osal_port_wait_wake(TickType_t *remaining)
+{
+    TickType_t start;
+    TickType_t elapsed;
+    uint32_t value;
+
+    start = xTaskGetTickCount();
+
+    for (;;) {
+        value = 0U;
+        if (xTaskNotifyWait(0U, XF_OSAL_PORT_WAKE_BIT, &value, *remaining) == pdFALSE) {
+            *remaining = 0U;
+            return pdFALSE;
+        }
+
+        if (*remaining != portMAX_DELAY) {
+            elapsed = xTaskGetTickCount() - start;
+            *remaining = (elapsed < *remaining) ? (*remaining - elapsed) : 0U;
+            start += elapsed;
+        }
+
+        if ((value & XF_OSAL_PORT_WAKE_BIT) != 0U) {
+            return pdTRUE;
+        }
+
+        if (*remaining == 0U) {
+            return pdFALSE;
+        }
+    }
+}
 
 #ifdef __cplusplus
 } /* extern "C" */
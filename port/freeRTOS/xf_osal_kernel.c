@@ -12,6 +12,27 @@
 /* ==================== [Includes] ========================================== */
 
 #include "xf_osal_internal.h"
+#include "xf_osal_atomic.h"
+
+#if defined(ESP_PLATFORM)
+#include "esp_heap_caps.h"
+#include "esp_freertos_hooks.h"
+#endif
+
+/* ==================== [Global Variables] ================================== */
+
+/* IRQ_Context() 使用，与内核模块是否开启无关 */
+volatile uint32_t xf_osal_port_sched_started = 0U;
+
+#if defined(ESP_PLATFORM)
+/* 对接层内部临界区使用的自旋锁，见 XF_OSAL_ENTER_CRITICAL() */
+portMUX_TYPE xf_osal_port_lock = portMUX_INITIALIZER_UNLOCKED;
+#endif
+
+#if XF_OSAL_ALLOC_HOOK_IS_ENABLE
+/* 分配跟踪钩子，见 XF_OSAL_PORT_ALLOC_HOOK() */
+xf_osal_alloc_hook_t volatile xf_osal_port_alloc_hook = NULL;
+#endif
 
 #if XF_OSAL_KERNEL_IS_ENABLE
 
@@ -23,12 +44,38 @@
 
 #define KERNEL_ID                 ("FreeRTOS " tskKERNEL_VERSION_NUMBER)
 
+#if XF_OSAL_IDLE_HOOK_IS_ENABLE && !defined(ESP_PLATFORM) && (configUSE_IDLE_HOOK != 1)
+#error "XF_OSAL_IDLE_HOOK_ENABLE requires configUSE_IDLE_HOOK == 1"
+#endif
+
+/* 延迟执行复用定时器服务线程 */
+#if (configUSE_TIMERS == 1) && (INCLUDE_xTimerPendFunctionCall == 1)
+#define DEFER_IS_SUPPORTED        (1)
+#else
+#define DEFER_IS_SUPPORTED        (0)
+#endif
+
 /* ==================== [Typedefs] ========================================== */
 
 /* ==================== [Static Prototypes] ================================= */
 
+#if XF_OSAL_IDLE_HOOK_IS_ENABLE && defined(ESP_PLATFORM)
+static bool idle_hook_trampoline(void);
+#endif
+
 /* ==================== [Static Variables] ================================== */
 
+/* 延迟执行提交失败次数 */
+static volatile uint32_t s_defer_overflow = 0U;
+
+#if XF_OSAL_IDLE_HOOK_IS_ENABLE
+static xf_osal_idle_hook_t volatile s_idle_hook = NULL;
+static xf_osal_sleep_hooks_t s_sleep_hooks = {NULL, NULL};
+/* 最近一次准备睡眠时计算的唤醒时刻，见 xf_osal_port_pre_sleep() */
+static volatile uint32_t s_wakeup_tick = 0U;
+static volatile uint32_t s_wakeup_valid = 0U;
+#endif
+
 /* ==================== [Macros] ============================================ */
 
 /* ==================== [Global Functions] ================================== */
@@ -131,6 +178,243 @@ xf_err_t xf_osal_kernel_unlock(void)
     return (lock);
 }
 
+xf_err_t xf_osal_kernel_get_heap_stats(xf_osal_heap_stats_t *stats)
+{
+    if (IRQ_Context() != 0U) {
+        return XF_ERR_ISR;
+    }
+
+    if (stats == NULL) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    memset(stats, 0, sizeof(*stats));
+
+#if defined(ESP_PLATFORM)
+    /* ESP-IDF 的 pvPortMalloc() 由 heap_caps 实现 */
+    multi_heap_info_t info;
+
+    heap_caps_get_info(&info, MALLOC_CAP_DEFAULT);
+    stats->free_size          = (uint32_t)info.total_free_bytes;
+    stats->min_free_size      = (uint32_t)info.minimum_free_bytes;
+    stats->largest_free_block = (uint32_t)info.largest_free_block;
+    stats->alloc_count        = (uint32_t)info.allocated_blocks;
+#elif defined(USE_FreeRTOS_HEAP_3)
+    /* heap_3 直接使用 C 库 malloc, 没有统计信息 */
+    return XF_ERR_NOT_SUPPORTED;
+#elif defined(USE_FreeRTOS_HEAP_1) || defined(USE_FreeRTOS_HEAP_2)
+    /* heap_1/heap_2 只提供当前空闲字节数 */
+    stats->free_size = (uint32_t)xPortGetFreeHeapSize();
+#else
+    /* heap_4/heap_5 */
+    HeapStats_t heap;
+
+    vPortGetHeapStats(&heap);
+    stats->free_size          = (uint32_t)heap.xAvailableHeapSpaceInBytes;
+    stats->min_free_size      = (uint32_t)heap.xMinimumEverFreeBytesRemaining;
+    stats->largest_free_block = (uint32_t)heap.xSizeOfLargestFreeBlockInBytes;
+    stats->alloc_count        = (uint32_t)heap.xNumberOfSuccessfulAllocations;
+    stats->free_count         = (uint32_t)heap.xNumberOfSuccessfulFrees;
+#endif
+
+    /* Return execution status */
+    return (XF_OK);
+}
+
+#if XF_OSAL_ALLOC_HOOK_IS_ENABLE
+xf_err_t xf_osal_kernel_set_alloc_hook(xf_osal_alloc_hook_t hook)
+{
+    if (IRQ_Context() != 0U) {
+        return XF_ERR_ISR;
+    }
+
+    xf_osal_port_alloc_hook = hook;
+
+    /* Return execution status */
+    return (XF_OK);
+}
+#endif
+
+#if XF_OSAL_IDLE_HOOK_IS_ENABLE
+xf_err_t xf_osal_kernel_set_idle_hook(xf_osal_idle_hook_t hook)
+{
+#if defined(ESP_PLATFORM)
+    static bool registered = false;
+#endif
+
+    if (IRQ_Context() != 0U) {
+        return XF_ERR_ISR;
+    }
+
+    s_idle_hook = hook;
+
+#if defined(ESP_PLATFORM)
+    /* ESP-IDF 自己实现了 vApplicationIdleHook(), 通过其钩子接口注册 */
+    if (!registered) {
+        if (esp_register_freertos_idle_hook(idle_hook_trampoline) != ESP_OK) {
+            return XF_FAIL;
+        }
+        registered = true;
+    }
+#endif
+
+    /* Return execution status */
+    return (XF_OK);
+}
+
+xf_err_t xf_osal_kernel_set_sleep_hooks(const xf_osal_sleep_hooks_t *hooks)
+{
+    if (IRQ_Context() != 0U) {
+        return XF_ERR_ISR;
+    }
+
+    /* 睡眠钩子在关中断状态下读取 */
+    XF_OSAL_ENTER_CRITICAL();
+    if (hooks != NULL) {
+        s_sleep_hooks = *hooks;
+    } else {
+        s_sleep_hooks.pre_sleep = NULL;
+        s_sleep_hooks.post_sleep = NULL;
+    }
+    XF_OSAL_EXIT_CRITICAL();
+
+    /* Return execution status */
+    return (XF_OK);
+}
+
+uint32_t xf_osal_kernel_get_next_wakeup(void)
+{
+    int32_t remain;
+
+    if (s_wakeup_valid == 0U) {
+        return XF_OSAL_WAIT_FOREVER;
+    }
+
+    remain = (int32_t)(s_wakeup_tick - xf_osal_kernel_get_tick_count());
+
+    /* Return remaining ticks */
+    return (remain > 0) ? (uint32_t)remain : 0U;
+}
+
+uint32_t xf_osal_port_pre_sleep(uint32_t expected_ticks)
+{
+    uint32_t ticks = expected_ticks;
+
+    /* 此时调度器已暂停，滴答计数不会变化 */
+    s_wakeup_tick = (uint32_t)xTaskGetTickCount() + expected_ticks;
+    s_wakeup_valid = 1U;
+
+    if (s_sleep_hooks.pre_sleep != NULL) {
+        s_sleep_hooks.pre_sleep(&ticks);
+        if (ticks > expected_ticks) {
+            ticks = expected_ticks;
+        }
+    }
+
+    return ticks;
+}
+
+void xf_osal_port_post_sleep(uint32_t expected_ticks)
+{
+    if (s_sleep_hooks.post_sleep != NULL) {
+        s_sleep_hooks.post_sleep(expected_ticks);
+    }
+
+    /* 离开睡眠窗口后记录的唤醒时刻不再代表下一次超时 */
+    s_wakeup_valid = 0U;
+}
+
+#if !defined(ESP_PLATFORM)
+void vApplicationIdleHook(void)
+{
+    xf_osal_idle_hook_t hook = s_idle_hook;
+
+    if (hook != NULL) {
+        hook();
+    }
+}
+#endif
+#endif /* XF_OSAL_IDLE_HOOK_IS_ENABLE */
+
+xf_err_t xf_osal_kernel_suspend(uint32_t *sleep_ticks)
+{
+    if (sleep_ticks == NULL) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    /* FreeRTOS 没有公开下一次唤醒时间，无滴答睡眠由 portSUPPRESS_TICKS_AND_SLEEP() 完成 */
+    *sleep_ticks = 0U;
+    return (XF_ERR_NOT_SUPPORTED);
+}
+
+xf_err_t xf_osal_kernel_resume(uint32_t sleep_ticks)
+{
+    (void)sleep_ticks;
+    return (XF_ERR_NOT_SUPPORTED);
+}
+
+xf_err_t xf_osal_kernel_defer_init(void)
+{
+    if (IRQ_Context() != 0U) {
+        return XF_ERR_ISR;
+    }
+
+    /* 定时器服务线程由 vTaskStartScheduler() 创建 */
+    return (XF_OK);
+}
+
+xf_err_t xf_osal_kernel_defer(xf_osal_defer_func_t func, void *arg1, uint32_t arg2)
+{
+#if DEFER_IS_SUPPORTED
+    BaseType_t yield;
+    BaseType_t ret;
+
+    if (func == NULL) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    if (IRQ_Context() != 0U) {
+        yield = pdFALSE;
+        ret = xTimerPendFunctionCallFromISR(func, arg1, arg2, &yield);
+        portYIELD_FROM_ISR(yield);
+    } else {
+        /* 不等待，与中断中的行为一致 */
+        ret = xTimerPendFunctionCall(func, arg1, arg2, 0U);
+    }
+
+    if (ret != pdPASS) {
+        (void)xf_osal_atomic_fetch_add(&s_defer_overflow, 1U);
+        return XF_ERR_RESOURCE;
+    }
+
+    /* Return execution status */
+    return (XF_OK);
+#else
+    (void)func;
+    (void)arg1;
+    (void)arg2;
+    return (XF_ERR_NOT_SUPPORTED);
+#endif
+}
+
+xf_err_t xf_osal_kernel_get_defer_stats(xf_osal_defer_stats_t *stats)
+{
+    if (stats == NULL) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+#if DEFER_IS_SUPPORTED
+    /* 命令队列与软件定时器共用 */
+    stats->capacity = (uint32_t)configTIMER_QUEUE_LENGTH;
+#else
+    stats->capacity = 0U;
+#endif
+    stats->overflow = xf_osal_atomic_load(&s_defer_overflow);
+
+    /* Return execution status */
+    return (XF_OK);
+}
+
 uint32_t xf_osal_kernel_get_tick_count(void)
 {
     TickType_t ticks;
@@ -145,6 +429,12 @@ uint32_t xf_osal_kernel_get_tick_count(void)
     return (ticks);
 }
 
+uint32_t xf_osal_kernel_get_tick_count_from_isr(void)
+{
+    /* Return kernel tick count */
+    return ((uint32_t)xTaskGetTickCountFromISR());
+}
+
 uint32_t xf_osal_kernel_get_tick_freq(void)
 {
     /* Return frequency in hertz */
@@ -163,4 +453,18 @@ uint32_t xf_osal_kernel_ms_to_ticks(uint32_t ms)
 
 /* ==================== [Static Functions] ================================== */
 
+#if XF_OSAL_IDLE_HOOK_IS_ENABLE && defined(ESP_PLATFORM)
+static bool idle_hook_trampoline(void)
+{
+    xf_osal_idle_hook_t hook = s_idle_hook;
+
+    if (hook != NULL) {
+        hook();
+    }
+
+    /* 返回 true 表示本轮空闲结束后可进入 WAITI */
+    return true;
+}
+#endif
+
 #endif
@@ -0,0 +1,253 @@
+/**
+ * @file xf_osal_msgbuf.c
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_osal_internal.h"
+
+#if XF_OSAL_MSGBUF_IS_ENABLE
+
+#include "freertos/message_buffer.h"
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Static Prototypes] ================================= */
+
+/* ==================== [Static Variables] ================================== */
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+xf_osal_msgbuf_t xf_osal_msgbuf_create(uint32_t size, const xf_osal_msgbuf_attr_t *attr)
+{
+    MessageBufferHandle_t hMsgBuf;
+    int32_t mem;
+
+    hMsgBuf = NULL;
+
+    if ((IRQ_Context() == 0U) && (size > sizeof(size_t))) {
+        mem = -1;
+
+        if (attr != NULL) {
+            if ((attr->cb_mem != NULL) && (attr->cb_size >= sizeof(StaticMessageBuffer_t)) &&
+                    (attr->buf_mem != NULL) && (attr->buf_size >= (size + 1U))) {
+                /* The memory for control block and buffer storage is provided, use static object */
+                mem = 1;
+            } else {
+                if ((attr->cb_mem == NULL) && (attr->cb_size == 0U) &&
+                        (attr->buf_mem == NULL) && (attr->buf_size == 0U)) {
+                    /* Control block will be allocated from the dynamic pool */
+                    mem = 0;
+                }
+            }
+        } else {
+            mem = 0;
+        }
+
+        if (mem == 1) {
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+            hMsgBuf = xMessageBufferCreateStatic(size, attr->buf_mem, attr->cb_mem);
+#endif
+        } else {
+            if (mem == 0) {
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+                hMsgBuf = xMessageBufferCreate(size);
+#endif
+            }
+        }
+    }
+
+    /* Return message buffer ID */
+    return ((xf_osal_msgbuf_t)hMsgBuf);
+}
+
+xf_err_t xf_osal_msgbuf_send(xf_osal_msgbuf_t msgbuf, const void *msg_ptr, uint32_t msg_len, uint32_t timeout)
+{
+    MessageBufferHandle_t hMsgBuf = (MessageBufferHandle_t)msgbuf;
+    xf_err_t stat;
+
+    if ((hMsgBuf == NULL) || (msg_ptr == NULL) || (msg_len == 0U)) {
+        return (XF_ERR_INVALID_ARG);
+    }
+
+    stat = XF_OK;
+
+    if (IRQ_Context() != 0U) {
+        if (timeout != 0U) {
+            stat = XF_ERR_INVALID_ARG;
+        } else {
+            stat = xf_osal_msgbuf_send_from_isr(msgbuf, msg_ptr, msg_len);
+        }
+    } else {
+        if (xMessageBufferSend(hMsgBuf, msg_ptr, msg_len, (TickType_t)timeout) != msg_len) {
+            if (timeout != 0U) {
+                stat = XF_ERR_TIMEOUT;
+            } else {
+                stat = XF_ERR_RESOURCE;
+            }
+        }
+    }
+
+    /* Return execution status */
+    return (stat);
+}
+
+xf_err_t xf_osal_msgbuf_receive(xf_osal_msgbuf_t msgbuf, void *buf, uint32_t buf_size,
+                                uint32_t *msg_len, uint32_t timeout)
+{
+    MessageBufferHandle_t hMsgBuf = (MessageBufferHandle_t)msgbuf;
+    size_t len;
+    xf_err_t stat;
+
+    if ((hMsgBuf == NULL) || (buf == NULL) || (buf_size == 0U)) {
+        return (XF_ERR_INVALID_ARG);
+    }
+
+    if (IRQ_Context() != 0U) {
+        if (timeout != 0U) {
+            return (XF_ERR_INVALID_ARG);
+        }
+        return xf_osal_msgbuf_receive_from_isr(msgbuf, buf, buf_size, msg_len);
+    }
+
+    stat = XF_OK;
+
+    len = xMessageBufferReceive(hMsgBuf, buf, buf_size, (TickType_t)timeout);
+    if (len == 0U) {
+        if (xMessageBufferNextLengthBytes(hMsgBuf) > buf_size) {
+            /* 下一条消息比接收缓冲区大，消息保留在缓冲区中 */
+            stat = XF_ERR_NO_MEM;
+        } else if (timeout != 0U) {
+            stat = XF_ERR_TIMEOUT;
+        } else {
+            stat = XF_ERR_RESOURCE;
+        }
+    }
+
+    if (msg_len != NULL) {
+        *msg_len = (uint32_t)len;
+    }
+
+    /* Return execution status */
+    return (stat);
+}
+
+xf_err_t xf_osal_msgbuf_send_from_isr(xf_osal_msgbuf_t msgbuf, const void *msg_ptr, uint32_t msg_len)
+{
+    MessageBufferHandle_t hMsgBuf = (MessageBufferHandle_t)msgbuf;
+    xf_err_t stat;
+    BaseType_t yield;
+
+    if ((hMsgBuf == NULL) || (msg_ptr == NULL) || (msg_len == 0U)) {
+        return (XF_ERR_INVALID_ARG);
+    }
+
+    stat = XF_OK;
+    yield = pdFALSE;
+
+    if (xMessageBufferSendFromISR(hMsgBuf, msg_ptr, msg_len, &yield) != msg_len) {
+        stat = XF_ERR_RESOURCE;
+    } else {
+        portYIELD_FROM_ISR(yield);
+    }
+
+    /* Return execution status */
+    return (stat);
+}
+
+xf_err_t xf_osal_msgbuf_receive_from_isr(xf_osal_msgbuf_t msgbuf, void *buf, uint32_t buf_size, uint32_t *msg_len)
+{
+    MessageBufferHandle_t hMsgBuf = (MessageBufferHandle_t)msgbuf;
+    size_t len;
+    xf_err_t stat;
+    BaseType_t yield;
+
+    if ((hMsgBuf == NULL) || (buf == NULL) || (buf_size == 0U)) {
+        return (XF_ERR_INVALID_ARG);
+    }
+
+    stat = XF_OK;
+    yield = pdFALSE;
+
+    len = xMessageBufferReceiveFromISR(hMsgBuf, buf, buf_size, &yield);
+    if (len == 0U) {
+        stat = XF_ERR_RESOURCE;
+    } else {
+        portYIELD_FROM_ISR(yield);
+    }
+
+    if (msg_len != NULL) {
+        *msg_len = (uint32_t)len;
+    }
+
+    /* Return execution status */
+    return (stat);
+}
+
+uint32_t xf_osal_msgbuf_get_space(xf_osal_msgbuf_t msgbuf)
+{
+    MessageBufferHandle_t hMsgBuf = (MessageBufferHandle_t)msgbuf;
+
+    if (hMsgBuf == NULL) {
+        return 0U;
+    }
+
+    /* 只读取索引，可在中断中调用 */
+    return (uint32_t)xMessageBufferSpacesAvailable(hMsgBuf);
+}
+
+xf_err_t xf_osal_msgbuf_reset(xf_osal_msgbuf_t msgbuf)
+{
+    MessageBufferHandle_t hMsgBuf = (MessageBufferHandle_t)msgbuf;
+    xf_err_t stat;
+
+    if (IRQ_Context() != 0U) {
+        stat = XF_ERR_ISR;
+    } else if (hMsgBuf == NULL) {
+        stat = XF_ERR_INVALID_ARG;
+    } else if (xMessageBufferReset(hMsgBuf) != pdPASS) {
+        stat = XF_ERR_RESOURCE;
+    } else {
+        stat = XF_OK;
+    }
+
+    /* Return execution status */
+    return (stat);
+}
+
+xf_err_t xf_osal_msgbuf_delete(xf_osal_msgbuf_t msgbuf)
+{
+    MessageBufferHandle_t hMsgBuf = (MessageBufferHandle_t)msgbuf;
+    xf_err_t stat;
+
+#ifndef USE_FreeRTOS_HEAP_1
+    if (IRQ_Context() != 0U) {
+        stat = XF_ERR_ISR;
+    } else if (hMsgBuf == NULL) {
+        stat = XF_ERR_INVALID_ARG;
+    } else {
+        stat = XF_OK;
+        vMessageBufferDelete(hMsgBuf);
+    }
+#else
+    stat = XF_FAIL;
+#endif
+
+    /* Return execution status */
+    return (stat);
+}
+
+/* ==================== [Static Functions] ================================== */
+
+#endif
@@ -29,11 +29,13 @@
 xf_osal_mutex_t xf_osal_mutex_create(const xf_osal_mutex_attr_t *attr)
 {
     SemaphoreHandle_t hMutex;
+    void *cb_mem;
     uint32_t type;
     uint32_t rmtx;
     int32_t  mem;
 
     hMutex = NULL;
+    cb_mem = NULL;
 
     if (IRQ_Context() == 0U) {
         if (attr != NULL) {
@@ -55,6 +57,7 @@ xf_osal_mutex_t xf_osal_mutex_create(const xf_osal_mutex_attr_t *attr)
                 if ((attr->cb_mem != NULL) && (attr->cb_size >= sizeof(StaticSemaphore_t))) {
                     /* The memory for control block is provided, use static object */
                     mem = 1;
+                    cb_mem = attr->cb_mem;
                 } else {
                     if ((attr->cb_mem == NULL) && (attr->cb_size == 0U)) {
                         /* Control block will be allocated from the dynamic pool */
@@ -65,14 +68,22 @@ xf_osal_mutex_t xf_osal_mutex_create(const xf_osal_mutex_attr_t *attr)
                 mem = 0;
             }
 
+            if (mem == 0) {
+                /* Prefer the object pool over the heap */
+                cb_mem = xf_osal_port_pool_alloc(XF_OSAL_OBJ_MUTEX);
+                if (cb_mem != NULL) {
+                    mem = 1;
+                }
+            }
+
             if (mem == 1) {
 #if (configSUPPORT_STATIC_ALLOCATION == 1)
                 if (rmtx != 0U) {
 #if (configUSE_RECURSIVE_MUTEXES == 1)
-                    hMutex = xSemaphoreCreateRecursiveMutexStatic(attr->cb_mem);
+                    hMutex = xSemaphoreCreateRecursiveMutexStatic(cb_mem);
 #endif
                 } else {
-                    hMutex = xSemaphoreCreateMutexStatic(attr->cb_mem);
+                    hMutex = xSemaphoreCreateMutexStatic(cb_mem);
                 }
 #endif
             } else {
@@ -89,6 +100,10 @@ xf_osal_mutex_t xf_osal_mutex_create(const xf_osal_mutex_attr_t *attr)
                 }
             }
 
+            if (hMutex == NULL) {
+                xf_osal_port_pool_free(XF_OSAL_OBJ_MUTEX, cb_mem);
+            }
+
 #if (configQUEUE_REGISTRY_SIZE > 0)
             if (hMutex != NULL) {
                 if ((attr != NULL) && (attr->name != NULL)) {
@@ -100,7 +115,12 @@ xf_osal_mutex_t xf_osal_mutex_create(const xf_osal_mutex_attr_t *attr)
 
             if ((hMutex != NULL) && (rmtx != 0U)) {
                 /* Set LSB as 'recursive mutex flag' */
-                hMutex = (SemaphoreHandle_t)((uint32_t)hMutex | 1U);
+                hMutex = (SemaphoreHandle_t)((uintptr_t)hMutex | 1U);
+            }
+
+            if ((hMutex != NULL) && (mem == 0)) {
+                XF_OSAL_PORT_ALLOC_HOOK(XF_OSAL_ALLOC_OP_ALLOC, XF_OSAL_OBJ_MUTEX, hMutex,
+                                        (attr != NULL) ? attr->name : NULL, sizeof(StaticSemaphore_t));
             }
         }
     }
@@ -111,80 +131,12 @@ xf_osal_mutex_t xf_osal_mutex_create(const xf_osal_mutex_attr_t *attr)
 
 xf_err_t xf_osal_mutex_acquire(xf_osal_mutex_t mutex, uint32_t timeout)
 {
-    SemaphoreHandle_t hMutex;
-    xf_err_t stat;
-    uint32_t rmtx;
-
-    hMutex = (SemaphoreHandle_t)((uint32_t)mutex & ~1U);
-
-    /* Extract recursive mutex flag */
-    rmtx = (uint32_t)mutex & 1U;
-
-    stat = XF_OK;
-
-    if (IRQ_Context() != 0U) {
-        stat = XF_ERR_ISR;
-    } else if (hMutex == NULL) {
-        stat = XF_ERR_INVALID_ARG;
-    } else {
-        if (rmtx != 0U) {
-#if (configUSE_RECURSIVE_MUTEXES == 1)
-            if (xSemaphoreTakeRecursive(hMutex, timeout) != pdPASS) {
-                if (timeout != 0U) {
-                    stat = XF_ERR_TIMEOUT;
-                } else {
-                    stat = XF_ERR_RESOURCE;
-                }
-            }
-#endif
-        } else {
-            if (xSemaphoreTake(hMutex, timeout) != pdPASS) {
-                if (timeout != 0U) {
-                    stat = XF_ERR_TIMEOUT;
-                } else {
-                    stat = XF_ERR_RESOURCE;
-                }
-            }
-        }
-    }
-
-    /* Return execution status */
-    return (stat);
+    return xf_osal_port_mutex_acquire(mutex, timeout);
 }
 
 xf_err_t xf_osal_mutex_release(xf_osal_mutex_t mutex)
 {
-    SemaphoreHandle_t hMutex;
-    xf_err_t stat;
-    uint32_t rmtx;
-
-    hMutex = (SemaphoreHandle_t)((uint32_t)mutex & ~1U);
-
-    /* Extract recursive mutex flag */
-    rmtx = (uint32_t)mutex & 1U;
-
-    stat = XF_OK;
-
-    if (IRQ_Context() != 0U) {
-        stat = XF_ERR_ISR;
-    } else if (hMutex == NULL) {
-        stat = XF_ERR_INVALID_ARG;
-    } else {
-        if (rmtx != 0U) {
-#if (configUSE_RECURSIVE_MUTEXES == 1)
-            if (xSemaphoreGiveRecursive(hMutex) != pdPASS) {
-                stat = XF_ERR_RESOURCE;
-            }
-#endif
-        } else {
-            if (xSemaphoreGive(hMutex) != pdPASS) {
-                stat = XF_ERR_RESOURCE;
-            }
-        }
-    }
-
-    /* Return execution status */
-    return (stat);
+    return xf_osal_port_mutex_release(mutex);
 }
 
 xf_osal_thread_t xf_osal_mutex_get_owner(xf_osal_mutex_t mutex)
@@ -192,7 +144,7 @@ xf_osal_thread_t xf_osal_mutex_get_owner(xf_osal_mutex_t mutex)
     SemaphoreHandle_t hMutex;
     xf_osal_thread_t owner;
 
-    hMutex = (SemaphoreHandle_t)((uint32_t)mutex & ~1U);
+    hMutex = (SemaphoreHandle_t)((uintptr_t)mutex & ~(uintptr_t)1U);
 
     if ((IRQ_Context() != 0U) || (hMutex == NULL)) {
         owner = NULL;
@@ -210,7 +162,7 @@ xf_err_t xf_osal_mutex_delete(xf_osal_mutex_t mutex)
 #ifndef USE_FreeRTOS_HEAP_1
     SemaphoreHandle_t hMutex;
 
-    hMutex = (SemaphoreHandle_t)((uint32_t)mutex & ~1U);
+    hMutex = (SemaphoreHandle_t)((uintptr_t)mutex & ~(uintptr_t)1U);
 
     if (IRQ_Context() != 0U) {
         stat = XF_ERR_ISR;
@@ -221,7 +173,9 @@ xf_err_t xf_osal_mutex_delete(xf_osal_mutex_t mutex)
         vQueueUnregisterQueue(hMutex);
 #endif
         stat = XF_OK;
+        XF_OSAL_PORT_ALLOC_HOOK(XF_OSAL_ALLOC_OP_FREE, XF_OSAL_OBJ_MUTEX, mutex, NULL, 0U);
         vSemaphoreDelete(hMutex);
+        xf_osal_port_pool_free(XF_OSAL_OBJ_MUTEX, hMutex);
     }
 #else
     stat = XF_FAIL;
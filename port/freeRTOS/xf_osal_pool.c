@@ -0,0 +1,192 @@
+/**
+ * @file xf_osal_pool.c
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief 控制块对象池。
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * 对象池中的控制块以 xxxCreateStatic() 创建对象（信号量的控制块由对接层自行维护），
+ * 删除对象后归还对象池，因此只适用于删除时立即释放控制块的对象（信号量、互斥锁、事件）。
+ * 软件定时器由定时器服务线程异步删除，线程和消息队列还需要栈或数据内存，不使用对象池。
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_osal_internal.h"
+
+/* ==================== [Defines] =========================================== */
+
+/* 信号量控制块由对接层自行维护，不需要静态创建接口 */
+#define POOL_SEMAPHORE_SIZE     (XF_OSAL_SEMAPHORE_IS_ENABLE ? XF_OSAL_SEMAPHORE_POOL_SIZE : 0)
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+#define POOL_MUTEX_SIZE         (XF_OSAL_MUTEX_IS_ENABLE ? XF_OSAL_MUTEX_POOL_SIZE : 0)
+#define POOL_EVENT_SIZE         (XF_OSAL_EVENT_IS_ENABLE ? XF_OSAL_EVENT_POOL_SIZE : 0)
+#else
+#define POOL_MUTEX_SIZE         (0)
+#define POOL_EVENT_SIZE         (0)
+#endif
+
+/* ==================== [Typedefs] ========================================== */
+
+typedef struct _pool_t {
+    uint8_t        *mem;        /* 控制块数组 */
+    uint32_t        block_size; /* 控制块大小 */
+    uint32_t        capacity;   /* 控制块个数 */
+    uint32_t        unused;     /* mem 中从未分配过的第一个控制块下标 */
+    void           *free_list;  /* 已归还的控制块，块首存放下一块的地址 */
+    uint32_t        used;
+    uint32_t        peak;
+    uint32_t        fallback;
+} pool_t;
+
+/* ==================== [Static Prototypes] ================================= */
+
+static pool_t *pool_get(xf_osal_obj_type_t type);
+#if XF_OSAL_KERNEL_IS_ENABLE
+static void pool_read_stats(const pool_t *pool, xf_osal_pool_stats_t *stats);
+#endif
+
+/* ==================== [Static Variables] ================================== */
+
+#if (POOL_SEMAPHORE_SIZE > 0)
+static xf_osal_port_sem_t s_semaphore_blocks[POOL_SEMAPHORE_SIZE];
+static pool_t s_semaphore_pool = {
+    (uint8_t *)s_semaphore_blocks, sizeof(xf_osal_port_sem_t), POOL_SEMAPHORE_SIZE, 0U, NULL, 0U, 0U, 0U
+};
+#endif
+
+#if (POOL_MUTEX_SIZE > 0)
+static StaticSemaphore_t s_mutex_blocks[POOL_MUTEX_SIZE];
+static pool_t s_mutex_pool = {
+    (uint8_t *)s_mutex_blocks, sizeof(StaticSemaphore_t), POOL_MUTEX_SIZE, 0U, NULL, 0U, 0U, 0U
+};
+#endif
+
+#if (POOL_EVENT_SIZE > 0)
+static StaticEventGroup_t s_event_blocks[POOL_EVENT_SIZE];
+static pool_t s_event_pool = {
+    (uint8_t *)s_event_blocks, sizeof(StaticEventGroup_t), POOL_EVENT_SIZE, 0U, NULL, 0U, 0U, 0U
+};
+#endif
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+void *xf_osal_port_pool_alloc(xf_osal_obj_type_t type)
+{
+    pool_t *pool = pool_get(type);
+    void *block = NULL;
+
+    if (pool == NULL) {
+        return NULL;
+    }
+
+    XF_OSAL_ENTER_CRITICAL();
+    if (pool->free_list != NULL) {
+        block = pool->free_list;
+        pool->free_list = *(void **)block;
+    } else if (pool->unused < pool->capacity) {
+        block = &pool->mem[pool->unused * pool->block_size];
+        pool->unused++;
+    }
+
+    if (block != NULL) {
+        pool->used++;
+        if (pool->used > pool->peak) {
+            pool->peak = pool->used;
+        }
+    } else {
+        pool->fallback++;
+    }
+    XF_OSAL_EXIT_CRITICAL();
+
+    return block;
+}
+
+void xf_osal_port_pool_free(xf_osal_obj_type_t type, void *block)
+{
+    pool_t *pool = pool_get(type);
+    uint8_t *p = (uint8_t *)block;
+
+    if ((pool == NULL) || (p < pool->mem) || (p >= &pool->mem[pool->capacity * pool->block_size])) {
+        /* 不是从对象池取出的控制块 */
+        return;
+    }
+
+    XF_OSAL_ENTER_CRITICAL();
+    *(void **)block = pool->free_list;
+    pool->free_list = block;
+    pool->used--;
+    XF_OSAL_EXIT_CRITICAL();
+}
+
+#if XF_OSAL_KERNEL_IS_ENABLE
+xf_err_t xf_osal_kernel_get_pool_stats(xf_osal_obj_type_t type, xf_osal_pool_stats_t *stats)
+{
+    pool_t *pool;
+    UBaseType_t isr_state;
+
+    if (stats == NULL) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    if ((type != XF_OSAL_OBJ_SEMAPHORE) && (type != XF_OSAL_OBJ_MUTEX) && (type != XF_OSAL_OBJ_EVENT)) {
+        return XF_ERR_NOT_SUPPORTED;
+    }
+
+    pool = pool_get(type);
+    if (pool == NULL) {
+        /* 未配置对象池 */
+        memset(stats, 0, sizeof(*stats));
+        return XF_OK;
+    }
+
+    if (IRQ_Context() != 0U) {
+        XF_OSAL_ENTER_CRITICAL_FROM_ISR(isr_state);
+        pool_read_stats(pool, stats);
+        XF_OSAL_EXIT_CRITICAL_FROM_ISR(isr_state);
+    } else {
+        XF_OSAL_ENTER_CRITICAL();
+        pool_read_stats(pool, stats);
+        XF_OSAL_EXIT_CRITICAL();
+    }
+
+    return XF_OK;
+}
+#endif
+
+/* ==================== [Static Functions] ================================== */
+
+static pool_t *pool_get(xf_osal_obj_type_t type)
+{
+    switch (type) {
+#if (POOL_SEMAPHORE_SIZE > 0)
+    case XF_OSAL_OBJ_SEMAPHORE:
+        return &s_semaphore_pool;
+#endif
+#if (POOL_MUTEX_SIZE > 0)
+    case XF_OSAL_OBJ_MUTEX:
+        return &s_mutex_pool;
+#endif
+#if (POOL_EVENT_SIZE > 0)
+    case XF_OSAL_OBJ_EVENT:
+        return &s_event_pool;
+#endif
+    default:
+        return NULL;
+    }
+}
+
+#if XF_OSAL_KERNEL_IS_ENABLE
+static void pool_read_stats(const pool_t *pool, xf_osal_pool_stats_t *stats)
+{
+    stats->capacity = pool->capacity;
+    stats->used = pool->used;
+    stats->peak = pool->peak;
+    stats->fallback = pool->fallback;
+}
+#endif
@@ -0,0 +1,611 @@
+/**
+ * @file xf_osal_port.h
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief FreeRTOS 对接层公共头文件，提供中断上下文判断与热点接口的内联实现。
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * 开启 XF_OSAL_INLINE_ENABLE 后，xf_osal.h 会包含本文件，
+ * 用户代码对热点接口的调用直接展开为此处的 static inline 函数；
+ * 未开启时，对接层的 .c 文件同样调用这些函数，两者共用一份实现。
+ */
+
+#ifndef __XF_OSAL_PORT_H__
+#define __XF_OSAL_PORT_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_osal.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/event_groups.h"
+#include "freertos/semphr.h"
+#include "freertos/timers.h"
+#include "freertos/queue.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+#define __STATIC_INLINE static inline
+
+/*
+ * 是否处于中断上下文中、是否禁用了中断，一般和架构相关。
+ * 未定义时按已知架构直接读寄存器，只需一两条指令；其他架构请自行定义。
+ */
+#if !defined(IS_IRQ_MODE) && defined(ESP_PLATFORM)
+#define IS_IRQ_MODE()  (xPortInIsrContext() != 0)
+#endif
+
+#if defined(__GNUC__) && defined(__ARM_ARCH_PROFILE) && (__ARM_ARCH_PROFILE == 'M')
+
+__STATIC_INLINE uint32_t xf_osal_port_get_ipsr(void)
+{
+    uint32_t result;
+    __asm volatile("MRS %0, ipsr" : "=r"(result));
+    return (result);
+}
+
+__STATIC_INLINE uint32_t xf_osal_port_get_irq_mask(void)
+{
+    uint32_t result;
+    __asm volatile("MRS %0, primask" : "=r"(result));
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__) \
+        || defined(__ARM_ARCH_8_1M_MAIN__)
+    uint32_t basepri;
+    __asm volatile("MRS %0, basepri" : "=r"(basepri));
+    result |= basepri;
+#endif
+    return (result);
+}
+
+#ifndef IS_IRQ_MODE
+#define IS_IRQ_MODE()  (xf_osal_port_get_ipsr() != 0U)
+#endif
+
+#ifndef IS_IRQ_MASKED
+#define IS_IRQ_MASKED()  (xf_osal_port_get_irq_mask() != 0U)
+#endif
+
+#endif /* Cortex-M */
+
+/*是否处于中断上下文中，一般和架构相关*/
+#ifndef IS_IRQ_MODE
+#define IS_IRQ_MODE()  (0U)
+#endif
+
+/*是否禁用了中断宏或函数，一般和架构相关*/
+#ifndef IS_IRQ_MASKED
+#define IS_IRQ_MASKED()  (0U)
+#endif
+
+/*
+ * 对接层内部临界区，保护对接层自行维护的等待队列等数据，可在中断中使用。
+ * ESP-IDF 等 SMP 移植的临界区需要自旋锁，使用 xf_osal_port_lock.
+ */
+#ifndef XF_OSAL_ENTER_CRITICAL
+#if defined(ESP_PLATFORM)
+extern portMUX_TYPE xf_osal_port_lock;
+#define XF_OSAL_ENTER_CRITICAL()            taskENTER_CRITICAL(&xf_osal_port_lock)
+#define XF_OSAL_EXIT_CRITICAL()             taskEXIT_CRITICAL(&xf_osal_port_lock)
+#define XF_OSAL_ENTER_CRITICAL_FROM_ISR(s)  do { (s) = 0U; taskENTER_CRITICAL_ISR(&xf_osal_port_lock); } while (0)
+#define XF_OSAL_EXIT_CRITICAL_FROM_ISR(s)   do { (void)(s); taskEXIT_CRITICAL_ISR(&xf_osal_port_lock); } while (0)
+#else
+#define XF_OSAL_ENTER_CRITICAL()            taskENTER_CRITICAL()
+#define XF_OSAL_EXIT_CRITICAL()             taskEXIT_CRITICAL()
+#define XF_OSAL_ENTER_CRITICAL_FROM_ISR(s)  do { (s) = taskENTER_CRITICAL_FROM_ISR(); } while (0)
+#define XF_OSAL_EXIT_CRITICAL_FROM_ISR(s)   taskEXIT_CRITICAL_FROM_ISR(s)
+#endif
+#endif
+
+/* 静态分配所需的控制块与消息内存大小（单位字节），供 xf_osal.hpp 预留静态内存 */
+#define XF_OSAL_PORT_THREAD_CB_SIZE                 (sizeof(StaticTask_t))
+#define XF_OSAL_PORT_MUTEX_CB_SIZE                  (sizeof(StaticSemaphore_t))
+#define XF_OSAL_PORT_QUEUE_CB_SIZE                  (sizeof(StaticQueue_t))
+#define XF_OSAL_PORT_QUEUE_MEM_SIZE(count, size)    ((count) * (size))
+
+#if XF_OSAL_SEMAPHORE_IS_ENABLE
+/* 信号量句柄带标记位 bit0, 等待集合据此区分信号量与消息队列 */
+#define XF_OSAL_PORT_SEM_TAG                        ((uintptr_t)1U)
+#define XF_OSAL_PORT_SEM(handle)                    ((xf_osal_port_sem_t *)((uintptr_t)(handle) & ~XF_OSAL_PORT_SEM_TAG))
+#endif
+
+/* ==================== [Typedefs] ========================================== */
+
+#if XF_OSAL_SEMAPHORE_IS_ENABLE
+/**
+ * @brief 信号量控制块。
+ *
+ * FreeRTOS 没有一次获取、释放多个令牌的接口，令牌计数与等待队列由对接层维护：
+ * 获取或释放 n 个令牌只是临界区内的一次计数更新，唤醒等待者在退出临界区后进行。
+ */
+typedef struct _xf_osal_port_sem_t {
+    uint32_t            count;      /* 可用令牌数 */
+    uint32_t            max_count;  /* 最大令牌数 */
+    void               *head;       /* 等待队列，按优先级从高到低、同优先级先到先得排列 */
+#if (configUSE_QUEUE_SETS == 1)
+    QueueSetHandle_t    set;        /* 所属等待集合，每个可用令牌对应集合中的一项 */
+#endif
+    const char         *name;
+    uint32_t            dyn;        /* 控制块是否动态分配 */
+} xf_osal_port_sem_t;
+#endif
+
+/* ==================== [Global Prototypes] ================================= */
+
+#if XF_OSAL_IDLE_HOOK_IS_ENABLE
+/**
+ * @brief 睡眠前处理，供 FreeRTOSConfig.h 中的 configPRE_SLEEP_PROCESSING 使用：
+ *
+ * @code
+ * extern uint32_t xf_osal_port_pre_sleep(uint32_t expected_ticks);
+ * extern void xf_osal_port_post_sleep(uint32_t expected_ticks);
+ * #define configPRE_SLEEP_PROCESSING(x)   (x) = xf_osal_port_pre_sleep(x)
+ * #define configPOST_SLEEP_PROCESSING(x)  xf_osal_port_post_sleep(x)
+ * @endcode
+ *
+ * 记录下一次唤醒时刻并调用 xf_osal_sleep_hooks_t::pre_sleep, 返回修改后的预计睡眠滴答数。
+ */
+uint32_t xf_osal_port_pre_sleep(uint32_t expected_ticks);
+
+/**
+ * @brief 唤醒后处理，调用 xf_osal_sleep_hooks_t::post_sleep.
+ */
+void xf_osal_port_post_sleep(uint32_t expected_ticks);
+#endif
+
+/**
+ * @brief 调度器是否已启动，由 IRQ_Context() 首次观察到调度器启动后置位。
+ *
+ * 调度器启动后不会再回到未启动状态，缓存后无需每次调用 xTaskGetSchedulerState().
+ */
+extern volatile uint32_t xf_osal_port_sched_started;
+
+__STATIC_INLINE uint32_t IRQ_Context(void)
+{
+    uint32_t irq;
+
+    irq = 0U;
+
+    if (IS_IRQ_MODE()) {
+        /* Called from interrupt context */
+        irq = 1U;
+    } else if (IS_IRQ_MASKED()) {
+        /* Interrupts are masked, only counts as IRQ context once the scheduler was started */
+        if (xf_osal_port_sched_started != 0U) {
+            irq = 1U;
+        } else if (xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED) {
+            xf_osal_port_sched_started = 1U;
+            irq = 1U;
+        }
+    }
+
+    /* Return context, 0: thread context, 1: IRQ context */
+    return (irq);
+}
+
+#if XF_OSAL_SEMAPHORE_IS_ENABLE
+
+/**
+ * @brief 获取令牌的慢速路径：有线程在等待或令牌不足时排队等待。
+ */
+xf_err_t xf_osal_port_semaphore_acquire_slow(xf_osal_port_sem_t *sem, uint32_t n, uint32_t timeout);
+
+/**
+ * @brief 释放令牌的慢速路径：把令牌按顺序交给等待者并唤醒，剩余令牌投递到所属等待集合。
+ *
+ * @param yield 中断中调用时传入，需要切换上下文时置为 pdTRUE; 线程中调用时为 NULL.
+ */
+xf_err_t xf_osal_port_semaphore_release_slow(xf_osal_port_sem_t *sem, uint32_t n, BaseType_t *yield);
+
+/**
+ * @brief 无人等待且有令牌时取走一个，不会插队到等待者之前。
+ */
+__STATIC_INLINE uint32_t xf_osal_port_semaphore_try_take(xf_osal_port_sem_t *sem)
+{
+    uint32_t taken = 0U;
+
+    if ((sem->head == NULL) && (sem->count != 0U)) {
+        sem->count--;
+        taken = 1U;
+    }
+
+    return taken;
+}
+
+/**
+ * @brief 无人等待且不属于等待集合时释放一个令牌；返回 0 表示需走慢速路径。
+ */
+__STATIC_INLINE uint32_t xf_osal_port_semaphore_try_give(xf_osal_port_sem_t *sem, xf_err_t *stat)
+{
+#if (configUSE_QUEUE_SETS == 1)
+    if (sem->set != NULL) {
+        return 0U;
+    }
+#endif
+
+    if (sem->head != NULL) {
+        return 0U;
+    }
+
+    if (sem->count < sem->max_count) {
+        sem->count++;
+        *stat = XF_OK;
+    } else {
+        *stat = XF_ERR_RESOURCE;
+    }
+
+    return 1U;
+}
+
+__STATIC_INLINE xf_err_t xf_osal_port_semaphore_acquire_from_isr(xf_osal_semaphore_t semaphore)
+{
+    xf_osal_port_sem_t *sem = XF_OSAL_PORT_SEM(semaphore);
+    UBaseType_t isr_state;
+    uint32_t taken;
+
+#if XF_OSAL_CHECK_ARGS_IS_ENABLE
+    if (sem == NULL) {
+        return (XF_ERR_INVALID_ARG);
+    }
+#endif
+
+    XF_OSAL_ENTER_CRITICAL_FROM_ISR(isr_state);
+    taken = xf_osal_port_semaphore_try_take(sem);
+    XF_OSAL_EXIT_CRITICAL_FROM_ISR(isr_state);
+
+    /* Return execution status */
+    return ((taken != 0U) ? XF_OK : XF_ERR_RESOURCE);
+}
+
+__STATIC_INLINE xf_err_t xf_osal_port_semaphore_release_from_isr(xf_osal_semaphore_t semaphore)
+{
+    xf_osal_port_sem_t *sem = XF_OSAL_PORT_SEM(semaphore);
+    UBaseType_t isr_state;
+    BaseType_t yield;
+    uint32_t done;
+    xf_err_t stat;
+
+#if XF_OSAL_CHECK_ARGS_IS_ENABLE
+    if (sem == NULL) {
+        return (XF_ERR_INVALID_ARG);
+    }
+#endif
+
+    stat = XF_OK;
+
+    XF_OSAL_ENTER_CRITICAL_FROM_ISR(isr_state);
+    done = xf_osal_port_semaphore_try_give(sem, &stat);
+    XF_OSAL_EXIT_CRITICAL_FROM_ISR(isr_state);
+
+    if (done == 0U) {
+        yield = pdFALSE;
+        stat = xf_osal_port_semaphore_release_slow(sem, 1U, &yield);
+        portYIELD_FROM_ISR(yield);
+    }
+
+    /* Return execution status */
+    return (stat);
+}
+
+__STATIC_INLINE xf_err_t xf_osal_port_semaphore_acquire(xf_osal_semaphore_t semaphore, uint32_t timeout)
+{
+    xf_osal_port_sem_t *sem = XF_OSAL_PORT_SEM(semaphore);
+    uint32_t taken;
+    xf_err_t stat;
+
+#if XF_OSAL_CHECK_ARGS_IS_ENABLE
+    if (sem == NULL) {
+        return (XF_ERR_INVALID_ARG);
+    }
+#endif
+
+    if (IRQ_Context() != 0U) {
+        if (timeout != 0U) {
+            stat = XF_ERR_INVALID_ARG;
+        } else {
+            stat = xf_osal_port_semaphore_acquire_from_isr(semaphore);
+        }
+    } else {
+        XF_OSAL_ENTER_CRITICAL();
+        taken = xf_osal_port_semaphore_try_take(sem);
+        XF_OSAL_EXIT_CRITICAL();
+
+        if (taken != 0U) {
+            stat = XF_OK;
+        } else if (timeout == 0U) {
+            stat = XF_ERR_RESOURCE;
+        } else {
+            stat = xf_osal_port_semaphore_acquire_slow(sem, 1U, timeout);
+        }
+    }
+
+    /* Return execution status */
+    return (stat);
+}
+
+__STATIC_INLINE xf_err_t xf_osal_port_semaphore_release(xf_osal_semaphore_t semaphore)
+{
+    xf_osal_port_sem_t *sem = XF_OSAL_PORT_SEM(semaphore);
+    uint32_t done;
+    xf_err_t stat;
+
+#if XF_OSAL_CHECK_ARGS_IS_ENABLE
+    if (sem == NULL) {
+        return (XF_ERR_INVALID_ARG);
+    }
+#endif
+
+    if (IRQ_Context() != 0U) {
+        stat = xf_osal_port_semaphore_release_from_isr(semaphore);
+    } else {
+        stat = XF_OK;
+
+        XF_OSAL_ENTER_CRITICAL();
+        done = xf_osal_port_semaphore_try_give(sem, &stat);
+        XF_OSAL_EXIT_CRITICAL();
+
+        if (done == 0U) {
+            stat = xf_osal_port_semaphore_release_slow(sem, 1U, NULL);
+        }
+    }
+
+    /* Return execution status */
+    return (stat);
+}
+
+#endif /* XF_OSAL_SEMAPHORE_IS_ENABLE */
+
+#if XF_OSAL_MUTEX_IS_ENABLE
+
+__STATIC_INLINE xf_err_t xf_osal_port_mutex_acquire(xf_osal_mutex_t mutex, uint32_t timeout)
+{
+    SemaphoreHandle_t hMutex;
+    xf_err_t stat;
+    uint32_t rmtx;
+
+    hMutex = (SemaphoreHandle_t)((uintptr_t)mutex & ~(uintptr_t)1U);
+
+    /* Extract recursive mutex flag */
+    rmtx = (uint32_t)((uintptr_t)mutex & 1U);
+
+    stat = XF_OK;
+
+#if XF_OSAL_CHECK_ARGS_IS_ENABLE
+    if (hMutex == NULL) {
+        return (XF_ERR_INVALID_ARG);
+    }
+#endif
+
+    if (IRQ_Context() != 0U) {
+        stat = XF_ERR_ISR;
+    } else {
+        if (rmtx != 0U) {
+#if (configUSE_RECURSIVE_MUTEXES == 1)
+            if (xSemaphoreTakeRecursive(hMutex, timeout) != pdPASS) {
+                if (timeout != 0U) {
+                    stat = XF_ERR_TIMEOUT;
+                } else {
+                    stat = XF_ERR_RESOURCE;
+                }
+            }
+#endif
+        } else {
+            if (xSemaphoreTake(hMutex, timeout) != pdPASS) {
+                if (timeout != 0U) {
+                    stat = XF_ERR_TIMEOUT;
+                } else {
+                    stat = XF_ERR_RESOURCE;
+                }
+            }
+        }
+    }
+
+    /* Return execution status */
+    return (stat);
+}
+
+__STATIC_INLINE xf_err_t xf_osal_port_mutex_release(xf_osal_mutex_t mutex)
+{
+    SemaphoreHandle_t hMutex;
+    xf_err_t stat;
+    uint32_t rmtx;
+
+    hMutex = (SemaphoreHandle_t)((uintptr_t)mutex & ~(uintptr_t)1U);
+
+    /* Extract recursive mutex flag */
+    rmtx = (uint32_t)((uintptr_t)mutex & 1U);
+
+    stat = XF_OK;
+
+#if XF_OSAL_CHECK_ARGS_IS_ENABLE
+    if (hMutex == NULL) {
+        return (XF_ERR_INVALID_ARG);
+    }
+#endif
+
+    if (IRQ_Context() != 0U) {
+        stat = XF_ERR_ISR;
+    } else {
+        if (rmtx != 0U) {
+#if (configUSE_RECURSIVE_MUTEXES == 1)
+            if (xSemaphoreGiveRecursive(hMutex) != pdPASS) {
+                stat = XF_ERR_RESOURCE;
+            }
+#endif
+        } else {
+            if (xSemaphoreGive(hMutex) != pdPASS) {
+                stat = XF_ERR_RESOURCE;
+            }
+        }
+    }
+
+    /* Return execution status */
+    return (stat);
+}
+
+#endif /* XF_OSAL_MUTEX_IS_ENABLE */
+
+#if XF_OSAL_QUEUE_IS_ENABLE
+
+__STATIC_INLINE xf_err_t xf_osal_port_queue_put_from_isr(
+    xf_osal_queue_t queue, const void *msg_ptr, uint8_t msg_prio)
+{
+    QueueHandle_t hQueue;
+    uint32_t overwrite;
+    xf_err_t stat;
+    BaseType_t yield;
+
+    /* Extract overwrite flag and queue handle */
+    hQueue = (QueueHandle_t)((uintptr_t)queue & ~(uintptr_t)1U);
+
+    /* Extract overwrite type */
+    overwrite = (uint32_t)((uintptr_t)queue & 1U);
+
+    (void)msg_prio; /* Message priority is ignored */
+
+    stat = XF_OK;
+
+#if XF_OSAL_CHECK_ARGS_IS_ENABLE
+    if ((hQueue == NULL) || (msg_ptr == NULL)) {
+        return (XF_ERR_INVALID_ARG);
+    }
+#endif
+
+    yield = pdFALSE;
+
+    if (overwrite != 0U) {
+        /* Mailbox always accepts the newest message */
+        (void)xQueueOverwriteFromISR(hQueue, msg_ptr, &yield);
+        portYIELD_FROM_ISR(yield);
+    } else if (xQueueSendToBackFromISR(hQueue, msg_ptr, &yield) != pdTRUE) {
+        stat = XF_ERR_RESOURCE;
+    } else {
+        portYIELD_FROM_ISR(yield);
+    }
+
+    /* Return execution status */
+    return (stat);
+}
+
+__STATIC_INLINE xf_err_t xf_osal_port_queue_get_from_isr(
+    xf_osal_queue_t queue, void *msg_ptr, uint8_t *msg_prio)
+{
+    QueueHandle_t hQueue = (QueueHandle_t)((uintptr_t)queue & ~(uintptr_t)1U);
+    xf_err_t stat;
+    BaseType_t yield;
+
+    (void)msg_prio; /* Message priority is ignored */
+
+    stat = XF_OK;
+
+#if XF_OSAL_CHECK_ARGS_IS_ENABLE
+    if ((hQueue == NULL) || (msg_ptr == NULL)) {
+        return (XF_ERR_INVALID_ARG);
+    }
+#endif
+
+    yield = pdFALSE;
+
+    if (xQueueReceiveFromISR(hQueue, msg_ptr, &yield) != pdPASS) {
+        stat = XF_ERR_RESOURCE;
+    } else {
+        portYIELD_FROM_ISR(yield);
+    }
+
+    /* Return execution status */
+    return (stat);
+}
+
+__STATIC_INLINE xf_err_t xf_osal_port_queue_put(
+    xf_osal_queue_t queue, const void *msg_ptr, uint8_t msg_prio, uint32_t timeout)
+{
+    QueueHandle_t hQueue;
+    uint32_t overwrite;
+    xf_err_t stat;
+
+    /* Extract overwrite flag and queue handle */
+    hQueue = (QueueHandle_t)((uintptr_t)queue & ~(uintptr_t)1U);
+
+    /* Extract overwrite type */
+    overwrite = (uint32_t)((uintptr_t)queue & 1U);
+
+    stat = XF_OK;
+
+#if XF_OSAL_CHECK_ARGS_IS_ENABLE
+    if ((hQueue == NULL) || (msg_ptr == NULL)) {
+        return (XF_ERR_INVALID_ARG);
+    }
+#endif
+
+    if (IRQ_Context() != 0U) {
+        if (timeout != 0U) {
+            stat = XF_ERR_INVALID_ARG;
+        } else {
+            stat = xf_osal_port_queue_put_from_isr(queue, msg_ptr, msg_prio);
+        }
+    } else if (overwrite != 0U) {
+        /* Mailbox never blocks, timeout is ignored */
+        (void)xQueueOverwrite(hQueue, msg_ptr);
+    } else {
+        if (xQueueSendToBack(hQueue, msg_ptr, (TickType_t)timeout) != pdPASS) {
+            if (timeout != 0U) {
+                stat = XF_ERR_TIMEOUT;
+            } else {
+                stat = XF_ERR_RESOURCE;
+            }
+        }
+    }
+
+    /* Return execution status */
+    return (stat);
+}
+
+__STATIC_INLINE xf_err_t xf_osal_port_queue_get(
+    xf_osal_queue_t queue, void *msg_ptr, uint8_t *msg_prio, uint32_t timeout)
+{
+    QueueHandle_t hQueue = (QueueHandle_t)((uintptr_t)queue & ~(uintptr_t)1U);
+    xf_err_t stat;
+
+    stat = XF_OK;
+
+#if XF_OSAL_CHECK_ARGS_IS_ENABLE
+    if ((hQueue == NULL) || (msg_ptr == NULL)) {
+        return (XF_ERR_INVALID_ARG);
+    }
+#endif
+
+    if (IRQ_Context() != 0U) {
+        if (timeout != 0U) {
+            stat = XF_ERR_INVALID_ARG;
+        } else {
+            stat = xf_osal_port_queue_get_from_isr(queue, msg_ptr, msg_prio);
+        }
+    } else {
+        if (xQueueReceive(hQueue, msg_ptr, (TickType_t)timeout) != pdPASS) {
+            if (timeout != 0U) {
+                stat = XF_ERR_TIMEOUT;
+            } else {
+                stat = XF_ERR_RESOURCE;
+            }
+        }
+    }
+
+    /* Return execution status */
+    return (stat);
+}
+
+#endif /* XF_OSAL_QUEUE_IS_ENABLE */
+
+/* ==================== [Macros] ============================================ */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif // __XF_OSAL_PORT_H__
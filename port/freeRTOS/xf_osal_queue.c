@@ -30,11 +30,18 @@
 xf_osal_queue_t xf_osal_queue_create(uint32_t msg_count, uint32_t msg_size, const xf_osal_queue_attr_t *attr)
 {
     QueueHandle_t hQueue;
+    uint32_t overwrite;
     int32_t mem;
 
     hQueue = NULL;
 
-    if ((IRQ_Context() == 0U) && (msg_count > 0U) && (msg_size > 0U)) {
+    overwrite = 0U;
+    if ((attr != NULL) && ((attr->attr_bits & XF_OSAL_QUEUE_OVERWRITE) == XF_OSAL_QUEUE_OVERWRITE)) {
+        overwrite = 1U;
+    }
+
+    if ((IRQ_Context() == 0U) && (msg_count > 0U) && (msg_size > 0U)
+            && ((overwrite == 0U) || (msg_count == 1U))) {
         mem = -1;
 
         if (attr != NULL) {
@@ -74,6 +81,15 @@ xf_osal_queue_t xf_osal_queue_create(uint32_t msg_count, uint32_t msg_size, cons
         }
 #endif
 
+        if ((hQueue != NULL) && (overwrite != 0U)) {
+            /* Set LSB as overwrite flag */
+            hQueue = (QueueHandle_t)((uintptr_t)hQueue | 1U);
+        }
+
+        if ((hQueue != NULL) && (mem == 0)) {
+            XF_OSAL_PORT_ALLOC_HOOK(XF_OSAL_ALLOC_OP_ALLOC, XF_OSAL_OBJ_QUEUE, hQueue,
+                                    (attr != NULL) ? attr->name : NULL, sizeof(StaticQueue_t) + (msg_count * msg_size));
+        }
     }
 
     /* Return message queue ID */
@@ -82,76 +98,45 @@ xf_osal_queue_t xf_osal_queue_create(uint32_t msg_count, uint32_t msg_size, cons
 
 xf_err_t xf_osal_queue_put(xf_osal_queue_t queue, const void *msg_ptr, uint8_t msg_prio, uint32_t timeout)
 {
-    QueueHandle_t hQueue = (QueueHandle_t)queue;
-    xf_err_t stat;
-    BaseType_t yield;
-
-    (void)msg_prio; /* Message priority is ignored */
-
-    stat = XF_OK;
+    return xf_osal_port_queue_put(queue, msg_ptr, msg_prio, timeout);
+}
 
-    if (IRQ_Context() != 0U) {
-        if ((hQueue == NULL) || (msg_ptr == NULL) || (timeout != 0U)) {
-            stat = XF_ERR_INVALID_ARG;
-        } else {
-            yield = pdFALSE;
+xf_err_t xf_osal_queue_get(xf_osal_queue_t queue, void *msg_ptr, uint8_t *msg_prio, uint32_t timeout)
+{
+    return xf_osal_port_queue_get(queue, msg_ptr, msg_prio, timeout);
+}
 
-            if (xQueueSendToBackFromISR(hQueue, msg_ptr, &yield) != pdTRUE) {
-                stat = XF_ERR_RESOURCE;
-            } else {
-                portYIELD_FROM_ISR(yield);
-            }
-        }
-    } else {
-        if ((hQueue == NULL) || (msg_ptr == NULL)) {
-            stat = XF_ERR_INVALID_ARG;
-        } else {
-            if (xQueueSendToBack(hQueue, msg_ptr, (TickType_t)timeout) != pdPASS) {
-                if (timeout != 0U) {
-                    stat = XF_ERR_TIMEOUT;
-                } else {
-                    stat = XF_ERR_RESOURCE;
-                }
-            }
-        }
-    }
+xf_err_t xf_osal_queue_put_from_isr(xf_osal_queue_t queue, const void *msg_ptr, uint8_t msg_prio)
+{
+    return xf_osal_port_queue_put_from_isr(queue, msg_ptr, msg_prio);
+}
 
-    /* Return execution status */
-    return (stat);
+xf_err_t xf_osal_queue_get_from_isr(xf_osal_queue_t queue, void *msg_ptr, uint8_t *msg_prio)
+{
+    return xf_osal_port_queue_get_from_isr(queue, msg_ptr, msg_prio);
 }
 
-xf_err_t xf_osal_queue_get(xf_osal_queue_t queue, void *msg_ptr, uint8_t *msg_prio, uint32_t timeout)
+xf_err_t xf_osal_queue_peek(xf_osal_queue_t queue, void *msg_ptr, uint32_t timeout)
 {
-    QueueHandle_t hQueue = (QueueHandle_t)queue;
+    QueueHandle_t hQueue = (QueueHandle_t)((uintptr_t)queue & ~(uintptr_t)1U);
     xf_err_t stat;
-    BaseType_t yield;
-
-    (void)msg_prio; /* Message priority is ignored */
 
     stat = XF_OK;
 
-    if (IRQ_Context() != 0U) {
-        if ((hQueue == NULL) || (msg_ptr == NULL) || (timeout != 0U)) {
+    if ((hQueue == NULL) || (msg_ptr == NULL)) {
+        stat = XF_ERR_INVALID_ARG;
+    } else if (IRQ_Context() != 0U) {
+        if (timeout != 0U) {
             stat = XF_ERR_INVALID_ARG;
-        } else {
-            yield = pdFALSE;
-
-            if (xQueueReceiveFromISR(hQueue, msg_ptr, &yield) != pdPASS) {
-                stat = XF_ERR_RESOURCE;
-            } else {
-                portYIELD_FROM_ISR(yield);
-            }
+        } else if (xQueuePeekFromISR(hQueue, msg_ptr) != pdPASS) {
+            stat = XF_ERR_RESOURCE;
         }
     } else {
-        if ((hQueue == NULL) || (msg_ptr == NULL)) {
-            stat = XF_ERR_INVALID_ARG;
-        } else {
-            if (xQueueReceive(hQueue, msg_ptr, (TickType_t)timeout) != pdPASS) {
-                if (timeout != 0U) {
-                    stat = XF_ERR_TIMEOUT;
-                } else {
-                    stat = XF_ERR_RESOURCE;
-                }
+        if (xQueuePeek(hQueue, msg_ptr, (TickType_t)timeout) != pdPASS) {
+            if (timeout != 0U) {
+                stat = XF_ERR_TIMEOUT;
+            } else {
+                stat = XF_ERR_RESOURCE;
             }
         }
     }
@@ -162,7 +147,7 @@ xf_err_t xf_osal_queue_get(xf_osal_queue_t queue, void *msg_ptr, uint8_t *msg_pr
 
 uint32_t xf_osal_queue_get_count(xf_osal_queue_t queue)
 {
-    QueueHandle_t hQueue = (QueueHandle_t)queue;
+    QueueHandle_t hQueue = (QueueHandle_t)((uintptr_t)queue & ~(uintptr_t)1U);
     UBaseType_t count;
 
     if (hQueue == NULL) {
@@ -179,7 +164,7 @@ uint32_t xf_osal_queue_get_count(xf_osal_queue_t queue)
 
 xf_err_t xf_osal_queue_reset(xf_osal_queue_t queue)
 {
-    QueueHandle_t hQueue = (QueueHandle_t)queue;
+    QueueHandle_t hQueue = (QueueHandle_t)((uintptr_t)queue & ~(uintptr_t)1U);
     xf_err_t stat;
 
     if (IRQ_Context() != 0U) {
@@ -197,7 +182,7 @@ xf_err_t xf_osal_queue_reset(xf_osal_queue_t queue)
 
 xf_err_t xf_osal_queue_delete(xf_osal_queue_t queue)
 {
-    QueueHandle_t hQueue = (QueueHandle_t)queue;
+    QueueHandle_t hQueue = (QueueHandle_t)((uintptr_t)queue & ~(uintptr_t)1U);
     xf_err_t stat;
 
 #ifndef USE_FreeRTOS_HEAP_1
@@ -211,6 +196,7 @@ xf_err_t xf_osal_queue_delete(xf_osal_queue_t queue)
 #endif
 
         stat = XF_OK;
+        XF_OSAL_PORT_ALLOC_HOOK(XF_OSAL_ALLOC_OP_FREE, XF_OSAL_OBJ_QUEUE, queue, NULL, 0U);
         vQueueDelete(hQueue);
     }
 #else
@@ -0,0 +1,286 @@
+/**
+ * @file xf_osal_select.c
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_osal_internal.h"
+
+#if XF_OSAL_SELECT_IS_ENABLE
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/* 等待集合控制块：队列集无法查询成员，删除前据成员数拒绝，避免成员仍指向已释放的队列集 */
+typedef struct _select_cb_t {
+    QueueSetHandle_t    hSet;
+    uint32_t            members;
+} select_cb_t;
+
+/* ==================== [Static Prototypes] ================================= */
+
+#if (configUSE_QUEUE_SETS == 1)
+static xf_err_t select_add(select_cb_t *cb, void *obj);
+static void select_count(select_cb_t *cb, uint32_t add);
+#endif
+
+/* ==================== [Static Variables] ================================== */
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+/*
+ * 基于 FreeRTOS 队列集实现，需要 configUSE_QUEUE_SETS 为 1.
+ * 队列集只能包含队列与信号量，无法等待事件组。
+ */
+
+xf_osal_select_t xf_osal_select_create(uint32_t max_events, const xf_osal_select_attr_t *attr)
+{
+    select_cb_t *cb;
+
+    cb = NULL;
+
+#if (configUSE_QUEUE_SETS == 1) && (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+    if ((IRQ_Context() == 0U) && (max_events > 0U)) {
+        cb = (select_cb_t *)pvPortMalloc(sizeof(select_cb_t));
+        if (cb != NULL) {
+            cb->members = 0U;
+            cb->hSet = xQueueCreateSet((UBaseType_t)max_events);
+            if (cb->hSet == NULL) {
+#if !defined(USE_FreeRTOS_HEAP_1)
+                vPortFree(cb);
+#endif
+                cb = NULL;
+            }
+        }
+
+#if (configQUEUE_REGISTRY_SIZE > 0)
+        if (cb != NULL) {
+            if ((attr != NULL) && (attr->name != NULL)) {
+                /* Only non-NULL name objects are added to the Queue Registry */
+                vQueueAddToRegistry(cb->hSet, attr->name);
+            }
+        }
+#endif
+    }
+#else
+    (void)max_events;
+    (void)attr;
+#endif
+
+    /* Return select set ID */
+    return ((xf_osal_select_t)cb);
+}
+
+#if XF_OSAL_QUEUE_IS_ENABLE
+xf_err_t xf_osal_select_add_queue(xf_osal_select_t select, xf_osal_queue_t queue)
+{
+#if (configUSE_QUEUE_SETS == 1)
+    if (((uintptr_t)queue & 1U) != 0U) {
+        /* 队列集返回的是原始句柄，无法还原邮箱标记，故不支持邮箱模式的队列 */
+        return XF_ERR_NOT_SUPPORTED;
+    }
+    return select_add((select_cb_t *)select, (void *)queue);
+#else
+    return XF_ERR_NOT_SUPPORTED;
+#endif
+}
+#endif
+
+#if XF_OSAL_SEMAPHORE_IS_ENABLE
+xf_err_t xf_osal_select_add_semaphore(xf_osal_select_t select, xf_osal_semaphore_t semaphore)
+{
+#if (configUSE_QUEUE_SETS == 1)
+    select_cb_t *cb = (select_cb_t *)select;
+    xf_err_t stat;
+
+    if (IRQ_Context() != 0U) {
+        stat = XF_ERR_ISR;
+    } else if ((cb == NULL) || (semaphore == NULL)) {
+        stat = XF_ERR_INVALID_ARG;
+    } else {
+        /* 信号量的令牌计数由对接层维护，释放时由对接层向集合投递 */
+        stat = xf_osal_port_semaphore_set_select(XF_OSAL_PORT_SEM(semaphore), cb->hSet, 1U);
+        if (stat == XF_OK) {
+            select_count(cb, 1U);
+        }
+    }
+
+    /* Return execution status */
+    return (stat);
+#else
+    return XF_ERR_NOT_SUPPORTED;
+#endif
+}
+#endif
+
+#if XF_OSAL_EVENT_IS_ENABLE
+xf_err_t xf_osal_select_add_event(xf_osal_select_t select, xf_osal_event_t event, uint32_t flags)
+{
+    (void)select;
+    (void)event;
+    (void)flags;
+
+    /* 队列集无法包含事件组 */
+    return XF_ERR_NOT_SUPPORTED;
+}
+#endif
+
+xf_err_t xf_osal_select_remove(xf_osal_select_t select, void *obj)
+{
+#if (configUSE_QUEUE_SETS == 1)
+    select_cb_t *cb = (select_cb_t *)select;
+    xf_err_t stat;
+
+    if (IRQ_Context() != 0U) {
+        stat = XF_ERR_ISR;
+    } else if ((cb == NULL) || (obj == NULL)) {
+        stat = XF_ERR_INVALID_ARG;
+#if XF_OSAL_SEMAPHORE_IS_ENABLE
+    } else if (((uintptr_t)obj & XF_OSAL_PORT_SEM_TAG) != 0U) {
+        /* 带标记位的是信号量（邮箱模式的队列不能加入集合） */
+        stat = xf_osal_port_semaphore_set_select(XF_OSAL_PORT_SEM(obj), cb->hSet, 0U);
+#endif
+    } else if (xQueueRemoveFromSet((QueueSetMemberHandle_t)obj, cb->hSet) != pdPASS) {
+        stat = XF_ERR_RESOURCE;
+    } else {
+        stat = XF_OK;
+    }
+
+    if (stat == XF_OK) {
+        select_count(cb, 0U);
+    }
+
+    /* Return execution status */
+    return (stat);
+#else
+    (void)select;
+    (void)obj;
+    return XF_ERR_NOT_SUPPORTED;
+#endif
+}
+
+xf_err_t xf_osal_select(xf_osal_select_t select, void **ready, uint32_t timeout)
+{
+#if (configUSE_QUEUE_SETS == 1)
+    select_cb_t *cb = (select_cb_t *)select;
+    QueueSetHandle_t hSet;
+    QueueSetMemberHandle_t hMember;
+    xf_err_t stat;
+
+    if ((cb == NULL) || (ready == NULL)) {
+        return (XF_ERR_INVALID_ARG);
+    }
+
+    hSet = cb->hSet;
+
+    stat = XF_OK;
+
+    if (IRQ_Context() != 0U) {
+        if (timeout != 0U) {
+            stat = XF_ERR_INVALID_ARG;
+            hMember = NULL;
+        } else {
+            hMember = xQueueSelectFromSetFromISR(hSet);
+            if (hMember == NULL) {
+                stat = XF_ERR_RESOURCE;
+            }
+        }
+    } else {
+        hMember = xQueueSelectFromSet(hSet, (TickType_t)timeout);
+        if (hMember == NULL) {
+            if (timeout != 0U) {
+                stat = XF_ERR_TIMEOUT;
+            } else {
+                stat = XF_ERR_RESOURCE;
+            }
+        }
+    }
+
+    *ready = (void *)hMember;
+
+    /* Return execution status */
+    return (stat);
+#else
+    (void)select;
+    (void)ready;
+    (void)timeout;
+    return XF_ERR_NOT_SUPPORTED;
+#endif
+}
+
+xf_err_t xf_osal_select_delete(xf_osal_select_t select)
+{
+    select_cb_t *cb = (select_cb_t *)select;
+    xf_err_t stat;
+
+#if (configUSE_QUEUE_SETS == 1) && !defined(USE_FreeRTOS_HEAP_1)
+    if (IRQ_Context() != 0U) {
+        stat = XF_ERR_ISR;
+    } else if (cb == NULL) {
+        stat = XF_ERR_INVALID_ARG;
+    } else if (cb->members != 0U) {
+        /* 成员仍会向队列集投递，不能释放 */
+        stat = XF_ERR_RESOURCE;
+    } else {
+#if (configQUEUE_REGISTRY_SIZE > 0)
+        vQueueUnregisterQueue(cb->hSet);
+#endif
+        stat = XF_OK;
+        vQueueDelete(cb->hSet);
+        vPortFree(cb);
+    }
+#else
+    (void)cb;
+    stat = XF_FAIL;
+#endif
+
+    /* Return execution status */
+    return (stat);
+}
+
+/* ==================== [Static Functions] ================================== */
+
+#if (configUSE_QUEUE_SETS == 1)
+static xf_err_t select_add(select_cb_t *cb, void *obj)
+{
+    xf_err_t stat;
+
+    if (IRQ_Context() != 0U) {
+        stat = XF_ERR_ISR;
+    } else if ((cb == NULL) || (obj == NULL)) {
+        stat = XF_ERR_INVALID_ARG;
+    } else if (xQueueAddToSet((QueueSetMemberHandle_t)obj, cb->hSet) != pdPASS) {
+        /* 对象非空或已属于其他队列集 */
+        stat = XF_ERR_RESOURCE;
+    } else {
+        stat = XF_OK;
+        select_count(cb, 1U);
+    }
+
+    /* Return execution status */
+    return (stat);
+}
+
+static void select_count(select_cb_t *cb, uint32_t add)
+{
+    XF_OSAL_ENTER_CRITICAL();
+    if (add != 0U) {
+        cb->members++;
+    } else {
+        cb->members--;
+    }
+    XF_OSAL_EXIT_CRITICAL();
+}
+#endif
+
+#endif
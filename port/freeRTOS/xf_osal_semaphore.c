@@ -17,10 +17,30 @@
 
 /* ==================== [Defines] =========================================== */
 
+/* 一次临界区内最多交出令牌的等待者数，超过时分批进行，限制关中断时间 */
+#define SEM_WAKE_BATCH      (8U)
+
 /* ==================== [Typedefs] ========================================== */
 
+/* 等待节点，位于等待线程的栈上 */
+typedef struct _sem_waiter_t {
+    struct _sem_waiter_t   *next;
+    TaskHandle_t            hTask;
+    UBaseType_t             prio;
+    uint32_t                n;
+    volatile uint32_t       granted;    /* 令牌已由释放者直接交给本线程 */
+} sem_waiter_t;
+
 /* ==================== [Static Prototypes] ================================= */
 
+static UBaseType_t sem_lock(BaseType_t *yield);
+static void sem_unlock(BaseType_t *yield, UBaseType_t isr_state);
+static uint32_t sem_grant(xf_osal_port_sem_t *sem, TaskHandle_t *wake, uint32_t *more);
+static void sem_notify(const TaskHandle_t *wake, uint32_t count, BaseType_t *yield);
+static void sem_dispatch(xf_osal_port_sem_t *sem, BaseType_t *yield);
+static void sem_waiter_insert(xf_osal_port_sem_t *sem, sem_waiter_t *waiter);
+static void sem_waiter_remove(xf_osal_port_sem_t *sem, sem_waiter_t *waiter);
+
 /* ==================== [Static Variables] ================================== */
 
 /* ==================== [Macros] ============================================ */
@@ -30,16 +50,17 @@
 xf_osal_semaphore_t xf_osal_semaphore_create(uint32_t max_count, uint32_t initial_count,
         const xf_osal_semaphore_attr_t *attr)
 {
-    SemaphoreHandle_t hSemaphore;
+    xf_osal_port_sem_t *sem;
+    uint32_t dyn;
     int32_t mem;
 
-    hSemaphore = NULL;
+    sem = NULL;
 
     if ((IRQ_Context() == 0U) && (max_count > 0U) && (initial_count <= max_count)) {
         mem = -1;
 
         if (attr != NULL) {
-            if ((attr->cb_mem != NULL) && (attr->cb_size >= sizeof(StaticSemaphore_t))) {
+            if ((attr->cb_mem != NULL) && (attr->cb_size >= sizeof(xf_osal_port_sem_t))) {
                 /* The memory for control block is provided, use static object */
                 mem = 1;
             } else {
@@ -52,126 +73,220 @@ xf_osal_semaphore_t xf_osal_semaphore_create(uint32_t max_count, uint32_t initia
             mem = 0;
         }
 
-        if (mem != -1) {
-            if (max_count == 1U) {
-                if (mem == 1) {
-#if (configSUPPORT_STATIC_ALLOCATION == 1)
-                    hSemaphore = xSemaphoreCreateBinaryStatic((StaticSemaphore_t *)attr->cb_mem);
-#endif
-                } else {
-#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
-                    hSemaphore = xSemaphoreCreateBinary();
-#endif
-                }
-
-                if ((hSemaphore != NULL) && (initial_count != 0U)) {
-                    if (xSemaphoreGive(hSemaphore) != pdPASS) {
-                        vSemaphoreDelete(hSemaphore);
-                        hSemaphore = NULL;
-                    }
-                }
-            } else {
-                if (mem == 1) {
-#if (configSUPPORT_STATIC_ALLOCATION == 1)
-                    hSemaphore = xSemaphoreCreateCountingStatic(max_count, initial_count, (StaticSemaphore_t *)attr->cb_mem);
-#endif
-                } else {
+        dyn = 0U;
+        if (mem == 1) {
+            sem = (xf_osal_port_sem_t *)attr->cb_mem;
+        } else if (mem == 0) {
+            /* Prefer the object pool over the heap */
+            sem = (xf_osal_port_sem_t *)xf_osal_port_pool_alloc(XF_OSAL_OBJ_SEMAPHORE);
 #if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
-                    hSemaphore = xSemaphoreCreateCounting(max_count, initial_count);
-#endif
+            if (sem == NULL) {
+                sem = (xf_osal_port_sem_t *)pvPortMalloc(sizeof(xf_osal_port_sem_t));
+                if (sem != NULL) {
+                    dyn = 1U;
+                    XF_OSAL_PORT_ALLOC_HOOK(XF_OSAL_ALLOC_OP_ALLOC, XF_OSAL_OBJ_SEMAPHORE,
+                                            (uintptr_t)sem | XF_OSAL_PORT_SEM_TAG,
+                                            (attr != NULL) ? attr->name : NULL, sizeof(xf_osal_port_sem_t));
                 }
             }
+#endif
+        }
 
-#if (configQUEUE_REGISTRY_SIZE > 0)
-            if (hSemaphore != NULL) {
-                if ((attr != NULL) && (attr->name != NULL)) {
-                    /* Only non-NULL name objects are added to the Queue Registry */
-                    vQueueAddToRegistry(hSemaphore, attr->name);
-                }
-            }
+        if (sem != NULL) {
+            sem->count     = initial_count;
+            sem->max_count = max_count;
+            sem->head      = NULL;
+#if (configUSE_QUEUE_SETS == 1)
+            sem->set       = NULL;
 #endif
+            sem->name      = (attr != NULL) ? attr->name : NULL;
+            sem->dyn       = dyn;
         }
     }
 
     /* Return semaphore ID */
-    return ((xf_osal_semaphore_t)hSemaphore);
+    return ((sem != NULL) ? (xf_osal_semaphore_t)((uintptr_t)sem | XF_OSAL_PORT_SEM_TAG) : NULL);
 }
 
 xf_err_t xf_osal_semaphore_acquire(xf_osal_semaphore_t semaphore, uint32_t timeout)
 {
-    SemaphoreHandle_t hSemaphore = (SemaphoreHandle_t)semaphore;
-    xf_err_t stat;
-    BaseType_t yield;
+    return xf_osal_port_semaphore_acquire(semaphore, timeout);
+}
 
-    stat = XF_OK;
+xf_err_t xf_osal_semaphore_release(xf_osal_semaphore_t semaphore)
+{
+    return xf_osal_port_semaphore_release(semaphore);
+}
 
-    if (hSemaphore == NULL) {
-        stat = XF_ERR_INVALID_ARG;
-    } else if (IRQ_Context() != 0U) {
+xf_err_t xf_osal_semaphore_acquire_from_isr(xf_osal_semaphore_t semaphore)
+{
+    return xf_osal_port_semaphore_acquire_from_isr(semaphore);
+}
+
+xf_err_t xf_osal_semaphore_release_from_isr(xf_osal_semaphore_t semaphore)
+{
+    return xf_osal_port_semaphore_release_from_isr(semaphore);
+}
+
+xf_err_t xf_osal_semaphore_acquire_n(xf_osal_semaphore_t semaphore, uint32_t n, uint32_t timeout)
+{
+    xf_osal_port_sem_t *sem = XF_OSAL_PORT_SEM(semaphore);
+    UBaseType_t isr_state;
+    uint32_t taken;
+
+    if ((sem == NULL) || (n == 0U) || (n > sem->max_count)) {
+        return (XF_ERR_INVALID_ARG);
+    }
+
+    if (IRQ_Context() != 0U) {
         if (timeout != 0U) {
-            stat = XF_ERR_INVALID_ARG;
-        } else {
-            yield = pdFALSE;
+            return (XF_ERR_INVALID_ARG);
+        }
 
-            if (xSemaphoreTakeFromISR(hSemaphore, &yield) != pdPASS) {
-                stat = XF_ERR_RESOURCE;
-            } else {
-                portYIELD_FROM_ISR(yield);
-            }
+        taken = 0U;
+        XF_OSAL_ENTER_CRITICAL_FROM_ISR(isr_state);
+        if ((sem->head == NULL) && (sem->count >= n)) {
+            sem->count -= n;
+            taken = 1U;
         }
+        XF_OSAL_EXIT_CRITICAL_FROM_ISR(isr_state);
+
+        return ((taken != 0U) ? XF_OK : XF_ERR_RESOURCE);
+    }
+
+    return xf_osal_port_semaphore_acquire_slow(sem, n, timeout);
+}
+
+xf_err_t xf_osal_semaphore_release_n(xf_osal_semaphore_t semaphore, uint32_t n)
+{
+    xf_osal_port_sem_t *sem = XF_OSAL_PORT_SEM(semaphore);
+    BaseType_t yield;
+    xf_err_t stat;
+
+    if ((sem == NULL) || (n == 0U)) {
+        return (XF_ERR_INVALID_ARG);
+    }
+
+    if (IRQ_Context() != 0U) {
+        yield = pdFALSE;
+        stat = xf_osal_port_semaphore_release_slow(sem, n, &yield);
+        portYIELD_FROM_ISR(yield);
     } else {
-        if (xSemaphoreTake(hSemaphore, (TickType_t)timeout) != pdPASS) {
-            if (timeout != 0U) {
-                stat = XF_ERR_TIMEOUT;
-            } else {
-                stat = XF_ERR_RESOURCE;
-            }
-        }
+        stat = xf_osal_port_semaphore_release_slow(sem, n, NULL);
     }
 
     /* Return execution status */
     return (stat);
 }
 
-xf_err_t xf_osal_semaphore_release(xf_osal_semaphore_t semaphore)
+xf_err_t xf_osal_port_semaphore_acquire_slow(xf_osal_port_sem_t *sem, uint32_t n, uint32_t timeout)
 {
-    SemaphoreHandle_t hSemaphore = (SemaphoreHandle_t)semaphore;
+    sem_waiter_t waiter;
+    TickType_t remaining;
     xf_err_t stat;
-    BaseType_t yield;
 
-    stat = XF_OK;
+    XF_OSAL_ENTER_CRITICAL();
+    if ((sem->head == NULL) && (sem->count >= n)) {
+        sem->count -= n;
+        XF_OSAL_EXIT_CRITICAL();
+        return (XF_OK);
+    }
+    if (timeout == 0U) {
+        XF_OSAL_EXIT_CRITICAL();
+        return (XF_ERR_RESOURCE);
+    }
 
-    if (hSemaphore == NULL) {
-        stat = XF_ERR_INVALID_ARG;
-    } else if (IRQ_Context() != 0U) {
-        yield = pdFALSE;
+    waiter.hTask   = xTaskGetCurrentTaskHandle();
+    waiter.prio    = uxTaskPriorityGet(NULL);
+    waiter.n       = n;
+    waiter.granted = 0U;
+    sem_waiter_insert(sem, &waiter);
+    XF_OSAL_EXIT_CRITICAL();
 
-        if (xSemaphoreGiveFromISR(hSemaphore, &yield) != pdTRUE) {
-            stat = XF_ERR_RESOURCE;
-        } else {
-            portYIELD_FROM_ISR(yield);
+    /* 优先级更高的等待者排到队首后，现有令牌可能已经足够 */
+    sem_dispatch(sem, NULL);
+
+    remaining = (timeout == XF_OSAL_WAIT_FOREVER) ? portMAX_DELAY : (TickType_t)timeout;
+
+    while ((waiter.granted == 0U) && (remaining != 0U)) {
+        if (xf_osal_port_wait_wake(&remaining) == pdFALSE) {
+            break;
         }
+    }
+
+    XF_OSAL_ENTER_CRITICAL();
+    if (waiter.granted != 0U) {
+        stat = XF_OK;
     } else {
-        if (xSemaphoreGive(hSemaphore) != pdPASS) {
-            stat = XF_ERR_RESOURCE;
-        }
+        sem_waiter_remove(sem, &waiter);
+        stat = XF_ERR_TIMEOUT;
+    }
+    XF_OSAL_EXIT_CRITICAL();
+
+    if (stat != XF_OK) {
+        /* 本线程不再挡在队首，后面的等待者可能已经可以满足 */
+        sem_dispatch(sem, NULL);
     }
 
     /* Return execution status */
     return (stat);
 }
 
+xf_err_t xf_osal_port_semaphore_release_slow(xf_osal_port_sem_t *sem, uint32_t n, BaseType_t *yield)
+{
+    TaskHandle_t wake[SEM_WAKE_BATCH];
+    UBaseType_t isr_state;
+    uint32_t count;
+    uint32_t more;
+#if (configUSE_QUEUE_SETS == 1)
+    QueueSetHandle_t hSet;
+    void *member;
+    uint32_t post;
+#endif
+
+    isr_state = sem_lock(yield);
+    if ((sem->max_count - sem->count) < n) {
+        sem_unlock(yield, isr_state);
+        return (XF_ERR_RESOURCE);
+    }
+    sem->count += n;
+    count = sem_grant(sem, wake, &more);
+#if (configUSE_QUEUE_SETS == 1)
+    /* 等待者取走后仍剩余的新令牌，每个对应等待集合中的一项 */
+    hSet = sem->set;
+    post = (hSet != NULL) ? ((sem->count < n) ? sem->count : n) : 0U;
+#endif
+    sem_unlock(yield, isr_state);
+
+    sem_notify(wake, count, yield);
+    if (more != 0U) {
+        sem_dispatch(sem, yield);
+    }
+
+#if (configUSE_QUEUE_SETS == 1)
+    member = (void *)((uintptr_t)sem | XF_OSAL_PORT_SEM_TAG);
+    while (post-- > 0U) {
+        if (yield == NULL) {
+            (void)xQueueSendToBack((QueueHandle_t)hSet, &member, 0U);
+        } else {
+            (void)xQueueSendToBackFromISR((QueueHandle_t)hSet, &member, yield);
+        }
+    }
+#endif
+
+    /* Return execution status */
+    return (XF_OK);
+}
+
 uint32_t xf_osal_semaphore_get_count(xf_osal_semaphore_t semaphore)
 {
-    SemaphoreHandle_t hSemaphore = (SemaphoreHandle_t)semaphore;
+    xf_osal_port_sem_t *sem = XF_OSAL_PORT_SEM(semaphore);
     uint32_t count;
 
-    if (hSemaphore == NULL) {
-        count = 0U;
-    } else if (IRQ_Context() != 0U) {
+    if (sem == NULL) {
         count = 0U;
     } else {
-        count = (uint32_t)uxSemaphoreGetCount(hSemaphore);
+        count = sem->count;
     }
 
     /* Return number of tokens */
@@ -180,30 +295,172 @@ uint32_t xf_osal_semaphore_get_count(xf_osal_semaphore_t semaphore)
 
 xf_err_t xf_osal_semaphore_delete(xf_osal_semaphore_t semaphore)
 {
-    SemaphoreHandle_t hSemaphore = (SemaphoreHandle_t)semaphore;
+    xf_osal_port_sem_t *sem = XF_OSAL_PORT_SEM(semaphore);
     xf_err_t stat;
 
-#ifndef USE_FreeRTOS_HEAP_1
     if (IRQ_Context() != 0U) {
         stat = XF_ERR_ISR;
-    } else if (hSemaphore == NULL) {
+    } else if (sem == NULL) {
         stat = XF_ERR_INVALID_ARG;
+    } else if (sem->head != NULL) {
+        stat = XF_ERR_RESOURCE;
     } else {
-#if (configQUEUE_REGISTRY_SIZE > 0)
-        vQueueUnregisterQueue(hSemaphore);
+        stat = XF_OK;
+        if (sem->dyn != 0U) {
+            XF_OSAL_PORT_ALLOC_HOOK(XF_OSAL_ALLOC_OP_FREE, XF_OSAL_OBJ_SEMAPHORE, semaphore, NULL, 0U);
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1) && !defined(USE_FreeRTOS_HEAP_1)
+            vPortFree(sem);
 #endif
+        } else {
+            xf_osal_port_pool_free(XF_OSAL_OBJ_SEMAPHORE, sem);
+        }
+    }
 
-        stat = XF_OK;
-        vSemaphoreDelete(hSemaphore);
+    /* Return execution status */
+    return (stat);
+}
+
+#if XF_OSAL_SELECT_IS_ENABLE && (configUSE_QUEUE_SETS == 1)
+xf_err_t xf_osal_port_semaphore_set_select(xf_osal_port_sem_t *sem, QueueSetHandle_t hSet, uint32_t add)
+{
+    xf_err_t stat;
+
+    /* 与 FreeRTOS 队列集相同：加入或移出时不得有可用令牌 */
+    XF_OSAL_ENTER_CRITICAL();
+    if (sem->count != 0U) {
+        stat = XF_ERR_RESOURCE;
+    } else if (add != 0U) {
+        stat = (sem->set == NULL) ? XF_OK : XF_ERR_RESOURCE;
+        if (stat == XF_OK) {
+            sem->set = hSet;
+        }
+    } else {
+        stat = (sem->set == hSet) ? XF_OK : XF_ERR_RESOURCE;
+        if (stat == XF_OK) {
+            sem->set = NULL;
+        }
     }
-#else
-    stat = XF_FAIL;
-#endif
+    XF_OSAL_EXIT_CRITICAL();
 
     /* Return execution status */
     return (stat);
 }
+#endif
 
 /* ==================== [Static Functions] ================================== */
 
+/*
+ * 以下函数中 yield 为 NULL 表示线程上下文，否则为中断上下文。
+ */
+
+static UBaseType_t sem_lock(BaseType_t *yield)
+{
+    UBaseType_t isr_state = 0U;
+
+    if (yield == NULL) {
+        XF_OSAL_ENTER_CRITICAL();
+    } else {
+        XF_OSAL_ENTER_CRITICAL_FROM_ISR(isr_state);
+    }
+
+    return isr_state;
+}
+
+static void sem_unlock(BaseType_t *yield, UBaseType_t isr_state)
+{
+    if (yield == NULL) {
+        XF_OSAL_EXIT_CRITICAL();
+    } else {
+        XF_OSAL_EXIT_CRITICAL_FROM_ISR(isr_state);
+    }
+}
+
+/**
+ * @brief 在临界区内按队列顺序把令牌直接交给等待者，队首不满足时停止，
+ *        保证 acquire_n 的大额请求不会被后来的小额请求饿死。
+ *
+ * @param wake 需唤醒的线程，最多 SEM_WAKE_BATCH 个。
+ * @param more 达到批次上限而仍可能有等待者可满足时置 1.
+ * @return uint32_t 需唤醒的线程数。
+ */
+static uint32_t sem_grant(xf_osal_port_sem_t *sem, TaskHandle_t *wake, uint32_t *more)
+{
+    sem_waiter_t *waiter;
+    uint32_t count = 0U;
+
+    *more = 0U;
+
+    while (((waiter = (sem_waiter_t *)sem->head) != NULL) && (waiter->n <= sem->count)) {
+        if (count == SEM_WAKE_BATCH) {
+            *more = 1U;
+            break;
+        }
+        sem->count -= waiter->n;
+        sem->head = waiter->next;
+        /* 置位后等待者可能立即返回，之后不得再访问 waiter */
+        wake[count] = waiter->hTask;
+        count++;
+        waiter->granted = 1U;
+    }
+
+    return count;
+}
+
+/**
+ * @brief 在临界区外唤醒已取得令牌的线程。
+ */
+static void sem_notify(const TaskHandle_t *wake, uint32_t count, BaseType_t *yield)
+{
+    uint32_t i;
+
+    for (i = 0U; i < count; i++) {
+        if (yield != NULL) {
+            xf_osal_port_wake_from_isr(wake[i], yield);
+        } else if (wake[i] != xTaskGetCurrentTaskHandle()) {
+            xf_osal_port_wake(wake[i]);
+        }
+    }
+}
+
+static void sem_dispatch(xf_osal_port_sem_t *sem, BaseType_t *yield)
+{
+    TaskHandle_t wake[SEM_WAKE_BATCH];
+    UBaseType_t isr_state;
+    uint32_t count;
+    uint32_t more;
+
+    do {
+        isr_state = sem_lock(yield);
+        count = sem_grant(sem, wake, &more);
+        sem_unlock(yield, isr_state);
+
+        sem_notify(wake, count, yield);
+    } while (more != 0U);
+}
+
+static void sem_waiter_insert(xf_osal_port_sem_t *sem, sem_waiter_t *waiter)
+{
+    sem_waiter_t **pp = (sem_waiter_t **)&sem->head;
+
+    while ((*pp != NULL) && ((*pp)->prio >= waiter->prio)) {
+        pp = &(*pp)->next;
+    }
+
+    waiter->next = *pp;
+    *pp = waiter;
+}
+
+static void sem_waiter_remove(xf_osal_port_sem_t *sem, sem_waiter_t *waiter)
+{
+    sem_waiter_t **pp = (sem_waiter_t **)&sem->head;
+
+    while (*pp != NULL) {
+        if (*pp == waiter) {
+            *pp = waiter->next;
+            break;
+        }
+        pp = &(*pp)->next;
+    }
+}
+
 #endif
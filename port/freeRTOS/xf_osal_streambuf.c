@@ -0,0 +1,300 @@
+/**
+ * @file xf_osal_streambuf.c
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_osal_internal.h"
+
+#if XF_OSAL_STREAMBUF_IS_ENABLE
+
+#include "freertos/stream_buffer.h"
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Static Prototypes] ================================= */
+
+/* ==================== [Static Variables] ================================== */
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+xf_osal_streambuf_t xf_osal_streambuf_create(uint32_t size, uint32_t trigger_level,
+        const xf_osal_streambuf_attr_t *attr)
+{
+    StreamBufferHandle_t hStreamBuf;
+    int32_t mem;
+
+    hStreamBuf = NULL;
+
+    if (trigger_level == 0U) {
+        trigger_level = 1U;
+    }
+
+    if ((IRQ_Context() == 0U) && (size > 0U) && (trigger_level <= size)) {
+        mem = -1;
+
+        if (attr != NULL) {
+            if ((attr->cb_mem != NULL) && (attr->cb_size >= sizeof(StaticStreamBuffer_t)) &&
+                    (attr->buf_mem != NULL) && (attr->buf_size >= (size + 1U))) {
+                /* The memory for control block and buffer storage is provided, use static object */
+                mem = 1;
+            } else {
+                if ((attr->cb_mem == NULL) && (attr->cb_size == 0U) &&
+                        (attr->buf_mem == NULL) && (attr->buf_size == 0U)) {
+                    /* Control block will be allocated from the dynamic pool */
+                    mem = 0;
+                }
+            }
+        } else {
+            mem = 0;
+        }
+
+        if (mem == 1) {
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+            hStreamBuf = xStreamBufferCreateStatic(size, trigger_level, attr->buf_mem, attr->cb_mem);
+#endif
+        } else {
+            if (mem == 0) {
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+                hStreamBuf = xStreamBufferCreate(size, trigger_level);
+#endif
+            }
+        }
+    }
+
+    /* Return stream buffer ID */
+    return ((xf_osal_streambuf_t)hStreamBuf);
+}
+
+xf_err_t xf_osal_streambuf_send(xf_osal_streambuf_t streambuf, const void *data, uint32_t len,
+                                uint32_t *sent, uint32_t timeout)
+{
+    StreamBufferHandle_t hStreamBuf = (StreamBufferHandle_t)streambuf;
+    size_t count;
+    xf_err_t stat;
+
+    if ((hStreamBuf == NULL) || ((data == NULL) && (len != 0U))) {
+        return (XF_ERR_INVALID_ARG);
+    }
+
+    if (IRQ_Context() != 0U) {
+        if (timeout != 0U) {
+            return (XF_ERR_INVALID_ARG);
+        }
+        return xf_osal_streambuf_send_from_isr(streambuf, data, len, sent);
+    }
+
+    stat = XF_OK;
+
+    count = xStreamBufferSend(hStreamBuf, data, len, (TickType_t)timeout);
+    if (count != len) {
+        if (timeout != 0U) {
+            stat = XF_ERR_TIMEOUT;
+        } else {
+            stat = XF_ERR_RESOURCE;
+        }
+    }
+
+    if (sent != NULL) {
+        *sent = (uint32_t)count;
+    }
+
+    /* Return execution status */
+    return (stat);
+}
+
+xf_err_t xf_osal_streambuf_receive(xf_osal_streambuf_t streambuf, void *buf, uint32_t buf_size,
+                                   uint32_t *received, uint32_t timeout)
+{
+    StreamBufferHandle_t hStreamBuf = (StreamBufferHandle_t)streambuf;
+    size_t count;
+    xf_err_t stat;
+
+    if ((hStreamBuf == NULL) || (buf == NULL) || (buf_size == 0U)) {
+        return (XF_ERR_INVALID_ARG);
+    }
+
+    if (IRQ_Context() != 0U) {
+        if (timeout != 0U) {
+            return (XF_ERR_INVALID_ARG);
+        }
+        return xf_osal_streambuf_receive_from_isr(streambuf, buf, buf_size, received);
+    }
+
+    stat = XF_OK;
+
+    count = xStreamBufferReceive(hStreamBuf, buf, buf_size, (TickType_t)timeout);
+    if (count == 0U) {
+        if (timeout != 0U) {
+            stat = XF_ERR_TIMEOUT;
+        } else {
+            stat = XF_ERR_RESOURCE;
+        }
+    }
+
+    if (received != NULL) {
+        *received = (uint32_t)count;
+    }
+
+    /* Return execution status */
+    return (stat);
+}
+
+xf_err_t xf_osal_streambuf_send_from_isr(xf_osal_streambuf_t streambuf, const void *data, uint32_t len,
+        uint32_t *sent)
+{
+    StreamBufferHandle_t hStreamBuf = (StreamBufferHandle_t)streambuf;
+    size_t count;
+    xf_err_t stat;
+    BaseType_t yield;
+
+    if ((hStreamBuf == NULL) || ((data == NULL) && (len != 0U))) {
+        return (XF_ERR_INVALID_ARG);
+    }
+
+    stat = XF_OK;
+    yield = pdFALSE;
+
+    count = xStreamBufferSendFromISR(hStreamBuf, data, len, &yield);
+    if (count != len) {
+        stat = XF_ERR_RESOURCE;
+    }
+    portYIELD_FROM_ISR(yield);
+
+    if (sent != NULL) {
+        *sent = (uint32_t)count;
+    }
+
+    /* Return execution status */
+    return (stat);
+}
+
+xf_err_t xf_osal_streambuf_receive_from_isr(xf_osal_streambuf_t streambuf, void *buf, uint32_t buf_size,
+        uint32_t *received)
+{
+    StreamBufferHandle_t hStreamBuf = (StreamBufferHandle_t)streambuf;
+    size_t count;
+    xf_err_t stat;
+    BaseType_t yield;
+
+    if ((hStreamBuf == NULL) || (buf == NULL) || (buf_size == 0U)) {
+        return (XF_ERR_INVALID_ARG);
+    }
+
+    stat = XF_OK;
+    yield = pdFALSE;
+
+    count = xStreamBufferReceiveFromISR(hStreamBuf, buf, buf_size, &yield);
+    if (count == 0U) {
+        stat = XF_ERR_RESOURCE;
+    } else {
+        portYIELD_FROM_ISR(yield);
+    }
+
+    if (received != NULL) {
+        *received = (uint32_t)count;
+    }
+
+    /* Return execution status */
+    return (stat);
+}
+
+uint32_t xf_osal_streambuf_get_count(xf_osal_streambuf_t streambuf)
+{
+    StreamBufferHandle_t hStreamBuf = (StreamBufferHandle_t)streambuf;
+
+    if (hStreamBuf == NULL) {
+        return 0U;
+    }
+
+    /* 只读取索引，可在中断中调用 */
+    return (uint32_t)xStreamBufferBytesAvailable(hStreamBuf);
+}
+
+uint32_t xf_osal_streambuf_get_space(xf_osal_streambuf_t streambuf)
+{
+    StreamBufferHandle_t hStreamBuf = (StreamBufferHandle_t)streambuf;
+
+    if (hStreamBuf == NULL) {
+        return 0U;
+    }
+
+    /* 只读取索引，可在中断中调用 */
+    return (uint32_t)xStreamBufferSpacesAvailable(hStreamBuf);
+}
+
+xf_err_t xf_osal_streambuf_set_trigger_level(xf_osal_streambuf_t streambuf, uint32_t trigger_level)
+{
+    StreamBufferHandle_t hStreamBuf = (StreamBufferHandle_t)streambuf;
+    xf_err_t stat;
+
+    if (IRQ_Context() != 0U) {
+        stat = XF_ERR_ISR;
+    } else if (hStreamBuf == NULL) {
+        stat = XF_ERR_INVALID_ARG;
+    } else if (xStreamBufferSetTriggerLevel(hStreamBuf, trigger_level) != pdPASS) {
+        /* 触发水平大于缓冲区大小 */
+        stat = XF_ERR_INVALID_ARG;
+    } else {
+        stat = XF_OK;
+    }
+
+    /* Return execution status */
+    return (stat);
+}
+
+xf_err_t xf_osal_streambuf_reset(xf_osal_streambuf_t streambuf)
+{
+    StreamBufferHandle_t hStreamBuf = (StreamBufferHandle_t)streambuf;
+    xf_err_t stat;
+
+    if (IRQ_Context() != 0U) {
+        stat = XF_ERR_ISR;
+    } else if (hStreamBuf == NULL) {
+        stat = XF_ERR_INVALID_ARG;
+    } else if (xStreamBufferReset(hStreamBuf) != pdPASS) {
+        stat = XF_ERR_RESOURCE;
+    } else {
+        stat = XF_OK;
+    }
+
+    /* Return execution status */
+    return (stat);
+}
+
+xf_err_t xf_osal_streambuf_delete(xf_osal_streambuf_t streambuf)
+{
+    StreamBufferHandle_t hStreamBuf = (StreamBufferHandle_t)streambuf;
+    xf_err_t stat;
+
+#ifndef USE_FreeRTOS_HEAP_1
+    if (IRQ_Context() != 0U) {
+        stat = XF_ERR_ISR;
+    } else if (hStreamBuf == NULL) {
+        stat = XF_ERR_INVALID_ARG;
+    } else {
+        stat = XF_OK;
+        vStreamBufferDelete(hStreamBuf);
+    }
+#else
+    stat = XF_FAIL;
+#endif
+
+    /* Return execution status */
+    return (stat);
+}
+
+/* ==================== [Static Functions] ================================== */
+
+#endif
@@ -13,6 +13,10 @@
 
 #include "xf_osal_internal.h"
 
+#if defined(ESP_PLATFORM)
+#include "esp_idf_version.h"
+#endif
+
 #if XF_OSAL_THREAD_IS_ENABLE
 
 /* ==================== [Defines] =========================================== */
@@ -21,12 +25,59 @@
 #define uxSemaphoreGetCountFromISR( xSemaphore ) uxQueueMessagesWaitingFromISR( ( QueueHandle_t ) ( xSemaphore ) )
 #endif
 
+/* 处理器核数，FreeRTOS V11 为 configNUMBER_OF_CORES, 此前的 SMP 分支为 configNUM_CORES */
+#if defined(ESP_PLATFORM)
+#define PORT_NUM_CORES              portNUM_PROCESSORS
+#elif defined(configNUMBER_OF_CORES)
+#define PORT_NUM_CORES              configNUMBER_OF_CORES
+#elif defined(configNUM_CORES)
+#define PORT_NUM_CORES              configNUM_CORES
+#else
+#define PORT_NUM_CORES              1
+#endif
+
+#define CORE_MASK_ALL               ((uint32_t)((1ULL << (PORT_NUM_CORES)) - 1U))
+
+/* FreeRTOS SMP 可在创建时与创建后设置核掩码；ESP-IDF 只能在创建时固定到单个核 */
+#if !defined(ESP_PLATFORM) && (PORT_NUM_CORES > 1) && defined(configUSE_CORE_AFFINITY) && (configUSE_CORE_AFFINITY == 1)
+#define AFFINITY_IS_SUPPORTED       (1)
+#else
+#define AFFINITY_IS_SUPPORTED       (0)
+#endif
+
+/* 可分配的线程局部存储键数量，最多 32 个 */
+#if defined(configNUM_THREAD_LOCAL_STORAGE_POINTERS) \
+        && (configNUM_THREAD_LOCAL_STORAGE_POINTERS > XF_OSAL_PORT_TLS_FIRST_INDEX)
+#define TLS_NUM                     (configNUM_THREAD_LOCAL_STORAGE_POINTERS - XF_OSAL_PORT_TLS_FIRST_INDEX)
+#else
+#define TLS_NUM                     (0)
+#endif
+
+#if (TLS_NUM > 32)
+#undef TLS_NUM
+#define TLS_NUM                     (32)
+#endif
+
 /* ==================== [Typedefs] ========================================== */
 
 /* ==================== [Static Prototypes] ================================= */
 
+static void thread_notify_clear_bits(uint32_t bits);
+#if (TLS_NUM > 0)
+static void thread_tls_destruct(TaskHandle_t hTask);
+static xf_err_t thread_tls_clear_key(uint32_t key);
+#endif
+
 /* ==================== [Static Variables] ================================== */
 
+#if (TLS_NUM > 0)
+/* 已分配的键，bit n 对应键 n */
+static uint32_t s_tls_used = 0U;
+/* 无法遍历线程清除旧值时，已释放的键不再复用 */
+static uint32_t s_tls_retired = 0U;
+static xf_osal_tls_destructor_t s_tls_destructor[TLS_NUM];
+#endif
+
 /* ==================== [Macros] ============================================ */
 
 #define _MAP_VALUE(oldValue, a, b, c, d) ({ \
@@ -38,7 +89,31 @@
 })
 
 #define UNMAP_PRIORITY(oldValue) (_MAP_VALUE((oldValue), Thread_Priority_Lowest, Thread_Priority_Highest, XF_OSAL_PRIORITY_LOW, XF_OSAL_PRIORITY_ISR - 1))
-#define MAP_PRIORITY(oldValue) (_MAP_VALUE((oldValue), XF_OSAL_PRIORITY_LOW, XF_OSAL_PRIORITY_ISR - 1, Thread_Priority_Lowest, Thread_Priority_Highest))
+/* IDLE 与 ISR 不在线性映射区间内，分别映射到最低与最高优先级 */
+#define MAP_PRIORITY(oldValue) (((oldValue) < XF_OSAL_PRIORITY_LOW) ? Thread_Priority_Lowest : \
+                                ((oldValue) > XF_OSAL_PRIORITY_ISR - 1) ? Thread_Priority_Highest : \
+                                _MAP_VALUE((oldValue), XF_OSAL_PRIORITY_LOW, XF_OSAL_PRIORITY_ISR - 1, Thread_Priority_Lowest, Thread_Priority_Highest))
+
+#if AFFINITY_IS_SUPPORTED
+#define AFFINITY_TO_CORES(mask)     (((mask) == 0U) ? tskNO_AFFINITY : (UBaseType_t)(mask))
+#define TASK_CREATE(func, name, stack, arg, prio, task, mask) \
+    xTaskCreateAffinitySet((func), (name), (stack), (arg), (prio), AFFINITY_TO_CORES(mask), (task))
+#define TASK_CREATE_STATIC(func, name, stack, arg, prio, stack_mem, cb_mem, mask) \
+    xTaskCreateStaticAffinitySet((func), (name), (stack), (arg), (prio), (stack_mem), (cb_mem), AFFINITY_TO_CORES(mask))
+#elif defined(ESP_PLATFORM)
+/* 掩码只有一位时固定到该核，否则不限制 */
+#define AFFINITY_TO_CORE(mask)      ((((mask) != 0U) && (((mask) & ((mask) - 1U)) == 0U)) ? \
+                                     (BaseType_t)__builtin_ctz(mask) : (BaseType_t)tskNO_AFFINITY)
+#define TASK_CREATE(func, name, stack, arg, prio, task, mask) \
+    xTaskCreatePinnedToCore((func), (name), (stack), (arg), (prio), (task), AFFINITY_TO_CORE(mask))
+#define TASK_CREATE_STATIC(func, name, stack, arg, prio, stack_mem, cb_mem, mask) \
+    xTaskCreateStaticPinnedToCore((func), (name), (stack), (arg), (prio), (stack_mem), (cb_mem), AFFINITY_TO_CORE(mask))
+#else
+#define TASK_CREATE(func, name, stack, arg, prio, task, mask) \
+    ((void)(mask), xTaskCreate((func), (name), (stack), (arg), (prio), (task)))
+#define TASK_CREATE_STATIC(func, name, stack, arg, prio, stack_mem, cb_mem, mask) \
+    ((void)(mask), xTaskCreateStatic((func), (name), (stack), (arg), (prio), (stack_mem), (cb_mem)))
+#endif
 
 /* ==================== [Global Functions] ================================== */
 
@@ -48,6 +123,7 @@ xf_osal_thread_t xf_osal_thread_create(xf_osal_thread_func_t func, void *argumen
     uint32_t stack;
     TaskHandle_t hTask;
     UBaseType_t prio;
+    uint32_t affinity;
     int32_t mem;
 
     hTask = NULL;
@@ -58,6 +134,7 @@ xf_osal_thread_t xf_osal_thread_create(xf_osal_thread_func_t func, void *argumen
 
         name = NULL;
         mem  = -1;
+        affinity = 0U;
 
         if (attr != NULL) {
             if (attr->name != NULL) {
@@ -73,6 +150,14 @@ xf_osal_thread_t xf_osal_thread_create(xf_osal_thread_func_t func, void *argumen
                 return (NULL);
             }
 
+#if (PORT_NUM_CORES > 1)
+            affinity = attr->affinity_mask & CORE_MASK_ALL;
+            if ((attr->affinity_mask != 0U) && (affinity == 0U)) {
+                /* No existing core in affinity mask */
+                return (NULL);
+            }
+#endif
+
             if (attr->stack_size > 0U) {
                 /* In FreeRTOS stack is not in bytes, but in sizeof(StackType_t) which is 4 on ARM ports.       */
                 /* Stack size should be therefore 4 byte aligned in order to avoid division caused side effects */
@@ -95,18 +180,24 @@ xf_osal_thread_t xf_osal_thread_create(xf_osal_thread_func_t func, void *argumen
         prio = MAP_PRIORITY(prio);
         if (mem == 1) {
 #if (configSUPPORT_STATIC_ALLOCATION == 1)
-            hTask = xTaskCreateStatic((TaskFunction_t)func, name, stack, argument, prio, (StackType_t *)attr->stack_mem,
-                                      (StaticTask_t *)attr->cb_mem);
+            hTask = TASK_CREATE_STATIC((TaskFunction_t)func, name, stack, argument, prio, (StackType_t *)attr->stack_mem,
+                                       (StaticTask_t *)attr->cb_mem, affinity);
 #endif
         } else {
             if (mem == 0) {
 #if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
-                if (xTaskCreate((TaskFunction_t)func, name, (configSTACK_DEPTH_TYPE)stack, argument, prio, &hTask) != pdPASS) {
+                if (TASK_CREATE((TaskFunction_t)func, name, (configSTACK_DEPTH_TYPE)stack, argument, prio, &hTask,
+                                affinity) != pdPASS) {
                     hTask = NULL;
                 }
 #endif
             }
         }
+
+        if ((hTask != NULL) && (mem == 0)) {
+            XF_OSAL_PORT_ALLOC_HOOK(XF_OSAL_ALLOC_OP_ALLOC, XF_OSAL_OBJ_THREAD, hTask, name,
+                                    sizeof(StaticTask_t) + (stack * sizeof(StackType_t)));
+        }
     }
     /* Return thread ID */
     return ((xf_osal_thread_t)hTask);
@@ -208,6 +299,71 @@ xf_osal_priority_t xf_osal_thread_get_priority(xf_osal_thread_t thread)
     return (prio);
 }
 
+xf_osal_priority_t xf_osal_thread_get_effective_priority(xf_osal_priority_t priority)
+{
+    int32_t native = MAP_PRIORITY((int32_t)priority);
+
+    /* Return priority after a round trip through the native level */
+    return ((xf_osal_priority_t)UNMAP_PRIORITY(native));
+}
+
+xf_err_t xf_osal_thread_set_affinity(xf_osal_thread_t thread, uint32_t mask)
+{
+    TaskHandle_t hTask = (TaskHandle_t)thread;
+    xf_err_t stat;
+
+    if (IRQ_Context() != 0U) {
+        stat = XF_ERR_ISR;
+    } else if ((hTask == NULL) || ((mask != 0U) && ((mask & CORE_MASK_ALL) == 0U))) {
+        stat = XF_ERR_INVALID_ARG;
+    } else {
+#if AFFINITY_IS_SUPPORTED
+        stat = XF_OK;
+        vTaskCoreAffinitySet(hTask, AFFINITY_TO_CORES(mask & CORE_MASK_ALL));
+#elif (PORT_NUM_CORES > 1)
+        /* Affinity can only be set on creation */
+        stat = XF_ERR_NOT_SUPPORTED;
+#else
+        stat = XF_OK;
+#endif
+    }
+
+    /* Return execution status */
+    return (stat);
+}
+
+xf_err_t xf_osal_thread_get_affinity(xf_osal_thread_t thread, uint32_t *mask)
+{
+    TaskHandle_t hTask = (TaskHandle_t)thread;
+#if !AFFINITY_IS_SUPPORTED && defined(ESP_PLATFORM) && (PORT_NUM_CORES > 1)
+    BaseType_t core;
+#endif
+    xf_err_t stat;
+
+    if (IRQ_Context() != 0U) {
+        stat = XF_ERR_ISR;
+    } else if ((hTask == NULL) || (mask == NULL)) {
+        stat = XF_ERR_INVALID_ARG;
+    } else {
+        stat = XF_OK;
+#if AFFINITY_IS_SUPPORTED
+        *mask = (uint32_t)vTaskCoreAffinityGet(hTask) & CORE_MASK_ALL;
+#elif defined(ESP_PLATFORM) && (PORT_NUM_CORES > 1)
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 1, 0)
+        core = xTaskGetCoreID(hTask);
+#else
+        core = xTaskGetAffinity(hTask);
+#endif
+        *mask = (core == (BaseType_t)tskNO_AFFINITY) ? CORE_MASK_ALL : (1UL << core);
+#else
+        *mask = CORE_MASK_ALL;
+#endif
+    }
+
+    /* Return execution status */
+    return (stat);
+}
+
 xf_err_t xf_osal_thread_yield(void)
 {
     xf_err_t stat;
@@ -285,12 +441,20 @@ xf_err_t xf_osal_thread_delete(xf_osal_thread_t thread)
         stat = XF_ERR_ISR;
     } else if (hTask == NULL) {
         stat = XF_OK;
+#if (TLS_NUM > 0)
+        thread_tls_destruct(xTaskGetCurrentTaskHandle());
+#endif
+        XF_OSAL_PORT_ALLOC_HOOK(XF_OSAL_ALLOC_OP_FREE, XF_OSAL_OBJ_THREAD, xTaskGetCurrentTaskHandle(), NULL, 0U);
         vTaskDelete(hTask);
     } else {
         tstate = eTaskGetState(hTask);
 
         if (tstate != eDeleted) {
             stat = XF_OK;
+#if (TLS_NUM > 0)
+            thread_tls_destruct(hTask);
+#endif
+            XF_OSAL_PORT_ALLOC_HOOK(XF_OSAL_ALLOC_OP_FREE, XF_OSAL_OBJ_THREAD, hTask, NULL, 0U);
             vTaskDelete(hTask);
         } else {
             stat = XF_ERR_RESOURCE;
@@ -361,50 +525,52 @@ xf_err_t xf_osal_thread_notify_set(xf_osal_thread_t thread, uint32_t flags)
 {
     TaskHandle_t hTask = (TaskHandle_t)thread;
     xf_err_t err;
-    BaseType_t yield;
 
     if ((hTask == NULL) || ((flags & THREAD_FLAGS_INVALID_BITS) != 0U)) {
         err = XF_ERR_INVALID_ARG;
+    } else if (IRQ_Context() != 0U) {
+        err = xf_osal_thread_notify_set_from_isr(thread, flags);
     } else {
         err = XF_OK;
+        (void)xTaskNotify(hTask, flags, eSetBits);
+    }
+    /* Return flags after setting */
+    return (err);
+}
 
-        if (IRQ_Context() != 0U) {
-            yield = pdFALSE;
+xf_err_t xf_osal_thread_notify_set_from_isr(xf_osal_thread_t thread, uint32_t flags)
+{
+    TaskHandle_t hTask = (TaskHandle_t)thread;
+    xf_err_t err;
+    BaseType_t yield;
 
-            (void)xTaskNotifyFromISR(hTask, flags, eSetBits, &yield);
+    if ((hTask == NULL) || ((flags & THREAD_FLAGS_INVALID_BITS) != 0U)) {
+        err = XF_ERR_INVALID_ARG;
+    } else {
+        err = XF_OK;
+        yield = pdFALSE;
 
-            portYIELD_FROM_ISR(yield);
-        } else {
-            (void)xTaskNotify(hTask, flags, eSetBits);
-        }
+        (void)xTaskNotifyFromISR(hTask, flags, eSetBits, &yield);
+
+        portYIELD_FROM_ISR(yield);
     }
-    /* Return flags after setting */
+    /* Return execution status */
     return (err);
 }
 
 xf_err_t xf_osal_thread_notify_clear(uint32_t flags)
 {
-    TaskHandle_t hTask;
     xf_err_t err = XF_OK;
-    uint32_t rflags;
 
     if (IRQ_Context() != 0U) {
         err = XF_ERR_ISR;
     } else if ((flags & THREAD_FLAGS_INVALID_BITS) != 0U) {
         err = XF_ERR_INVALID_ARG;
     } else {
-        hTask = xTaskGetCurrentTaskHandle();
-
-        if (xTaskNotifyAndQuery(hTask, 0, eNoAction, &rflags) == pdPASS) {
-            flags &= ~rflags;
-            if (xTaskNotify(hTask, flags, eSetValueWithOverwrite) != pdPASS) {
-                err = XF_FAIL;
-            }
-        } else {
-            err = XF_FAIL;
-        }
+        thread_notify_clear_bits(flags);
     }
 
+    /* Return execution status */
     return (err);
 }
 
@@ -421,6 +587,8 @@ uint32_t xf_osal_thread_notify_get(void)
         if (xTaskNotifyAndQuery(hTask, 0, eNoAction, &flag) != pdPASS) {
             flag = 0U;
         }
+        /* 屏蔽对接层内部使用的保留位 */
+        flag &= ~XF_OSAL_PORT_WAKE_BIT;
     }
 
     /* Return current flags */
@@ -429,59 +597,69 @@ uint32_t xf_osal_thread_notify_get(void)
 
 xf_err_t xf_osal_thread_notify_wait(uint32_t flags, uint32_t options, uint32_t timeout)
 {
-    uint32_t ulNotificationValue = 0;
-    uint32_t ulBitsToClearOnExit = 0;
-    TickType_t xStartTime, xElapsedTime = 0;
-    TickType_t xRemainingTime;
-    BaseType_t xResult;
-
-    // 参数检查
-    if (flags == 0 || (options & ~(XF_OSAL_NO_CLEAR | XF_OSAL_WAIT_ANY | XF_OSAL_WAIT_ALL))) {
-        return XF_ERR_INVALID_ARG;
+    TickType_t t0, td, tout;
+    TickType_t wait;
+    uint32_t value;
+    uint32_t rflags;
+    xf_err_t stat;
+
+    if (IRQ_Context() != 0U) {
+        return (XF_ERR_ISR);
     }
 
-    // 如果不使用 XF_OSAL_NO_CLEAR，收到通知后应清除 flags 中的位
-    if (!(options & XF_OSAL_NO_CLEAR)) {
-        ulBitsToClearOnExit = flags;
+    if ((flags == 0U) || ((flags & THREAD_FLAGS_INVALID_BITS) != 0U)
+            || ((options & ~(XF_OSAL_NO_CLEAR | XF_OSAL_WAIT_ALL)) != 0U)) {
+        return (XF_ERR_INVALID_ARG);
     }
 
-    // 获取当前时间用于超时计算
-    xStartTime = xTaskGetTickCount();
-    xRemainingTime = (timeout == 0) ? portMAX_DELAY : pdMS_TO_TICKS(timeout);
+    stat = XF_ERR_RESOURCE;
+    tout = timeout;
+    t0   = xTaskGetTickCount();
+    /* 第一次不阻塞，先检查已经置位的标志 */
+    wait = 0U;
 
-    // 循环等待，直到条件满足或超时
-    while (xRemainingTime > 0) {
-        // 等待通知
-        xResult = xTaskNotifyWait(0x00, ulBitsToClearOnExit, &ulNotificationValue, xRemainingTime);
+    for (;;) {
+        /* 不在退出时清除任何位，由满足条件后按实际收到的位清除，避免丢失部分满足的位 */
+        value = 0U;
+        (void)xTaskNotifyWait(0U, 0U, &value, wait);
+        rflags = value & flags;
 
-        if (xResult == pdFALSE) {
-            return XF_ERR_TIMEOUT;  // 超时返回
-        }
-        // 根据 options 参数处理
-        if (options & XF_OSAL_WAIT_ALL) {
-            // 如果已经满足所有 flags
-            if ((ulNotificationValue & flags) == flags) {
-                return XF_OK;
+        if ((options & XF_OSAL_WAIT_ALL) != 0U) {
+            if (rflags == flags) {
+                stat = XF_OK;
             }
         } else {
-            // 等待任何一个 flag 被设置
-            if (ulNotificationValue & flags) {
-                return XF_OK;
+            if (rflags != 0U) {
+                stat = XF_OK;
             }
         }
 
-        // 计算已经过去的时间
-        xElapsedTime = xTaskGetTickCount() - xStartTime;
+        if (stat == XF_OK) {
+            if ((options & XF_OSAL_NO_CLEAR) == 0U) {
+                thread_notify_clear_bits(rflags);
+            }
+            break;
+        }
 
-        // 计算剩余时间
-        if (xElapsedTime >= pdMS_TO_TICKS(timeout)) {
-            return XF_ERR_TIMEOUT;  // 超时
+        if (timeout == 0U) {
+            /* 不等待 */
+            break;
         }
 
-        xRemainingTime = pdMS_TO_TICKS(timeout) - xElapsedTime;
+        if (timeout == XF_OSAL_WAIT_FOREVER) {
+            wait = portMAX_DELAY;
+        } else {
+            td = xTaskGetTickCount() - t0;
+            if (td >= tout) {
+                stat = XF_ERR_TIMEOUT;
+                break;
+            }
+            wait = tout - td;
+        }
     }
 
-    return XF_ERR_TIMEOUT;
+    /* Return execution status */
+    return (stat);
 }
 
 xf_err_t xf_osal_delay(uint32_t ticks)
@@ -537,6 +715,208 @@ xf_err_t xf_osal_delay_ms(uint32_t ms)
     return (xf_osal_delay(xf_osal_kernel_ms_to_ticks(ms)));
 }
 
+xf_err_t xf_osal_tls_alloc(xf_osal_tls_key_t *key, xf_osal_tls_destructor_t destructor)
+{
+#if (TLS_NUM > 0)
+    xf_err_t stat;
+    uint32_t i;
+
+    if (IRQ_Context() != 0U) {
+        return XF_ERR_ISR;
+    }
+
+    if (key == NULL) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    stat = XF_ERR_NO_MEM;
+    XF_OSAL_ENTER_CRITICAL();
+    for (i = 0U; i < TLS_NUM; i++) {
+        if (((s_tls_used | s_tls_retired) & (1UL << i)) == 0U) {
+            s_tls_used |= (1UL << i);
+            s_tls_destructor[i] = destructor;
+            *key = i;
+            stat = XF_OK;
+            break;
+        }
+    }
+    XF_OSAL_EXIT_CRITICAL();
+
+    /* Return execution status */
+    return (stat);
+#else
+    (void)key;
+    (void)destructor;
+    return (XF_ERR_NOT_SUPPORTED);
+#endif
+}
+
+xf_err_t xf_osal_tls_free(xf_osal_tls_key_t key)
+{
+#if (TLS_NUM > 0)
+    xf_err_t stat;
+
+    if (IRQ_Context() != 0U) {
+        return XF_ERR_ISR;
+    }
+
+    if ((key >= TLS_NUM) || ((s_tls_used & (1UL << key)) == 0U)) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    /* 先清除各线程中的旧值，以免复用该键后读到旧值或对其调用新的析构函数 */
+    stat = thread_tls_clear_key(key);
+    if (stat != XF_OK) {
+        return stat;
+    }
+
+    XF_OSAL_ENTER_CRITICAL();
+    if ((s_tls_used & (1UL << key)) != 0U) {
+        s_tls_used &= ~(1UL << key);
+        s_tls_destructor[key] = NULL;
+#if !configUSE_TRACE_FACILITY
+        s_tls_retired |= (1UL << key);
+#endif
+        stat = XF_OK;
+    } else {
+        stat = XF_ERR_INVALID_ARG;
+    }
+    XF_OSAL_EXIT_CRITICAL();
+
+    /* Return execution status */
+    return (stat);
+#else
+    (void)key;
+    return (XF_ERR_NOT_SUPPORTED);
+#endif
+}
+
+xf_err_t xf_osal_tls_set(xf_osal_tls_key_t key, void *value)
+{
+#if (TLS_NUM > 0)
+    if (IRQ_Context() != 0U) {
+        return XF_ERR_ISR;
+    }
+
+    if (key >= TLS_NUM) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    vTaskSetThreadLocalStoragePointer(NULL, (BaseType_t)(XF_OSAL_PORT_TLS_FIRST_INDEX + key), value);
+
+    /* Return execution status */
+    return (XF_OK);
+#else
+    (void)key;
+    (void)value;
+    return (XF_ERR_NOT_SUPPORTED);
+#endif
+}
+
+void *xf_osal_tls_get(xf_osal_tls_key_t key)
+{
+#if (TLS_NUM > 0)
+    if ((key >= TLS_NUM) || (IRQ_Context() != 0U)) {
+        return NULL;
+    }
+
+    /* 直接读取当前任务控制块中的指针，不加锁 */
+    return pvTaskGetThreadLocalStoragePointer(NULL, (BaseType_t)(XF_OSAL_PORT_TLS_FIRST_INDEX + key));
+#else
+    (void)key;
+    return NULL;
+#endif
+}
+
 /* ==================== [Static Functions] ================================== */
 
+/**
+ * @brief 清除当前线程通知值中的指定位，其余位保持不变。
+ *
+ * 不使用 xTaskNotifyWait() 的退出清除参数，它在超时返回时不清除，
+ * 在 WAIT_ALL 部分满足时又会清掉已收到的位。
+ */
+static void thread_notify_clear_bits(uint32_t bits)
+{
+#if (tskKERNEL_VERSION_MAJOR > 10) || ((tskKERNEL_VERSION_MAJOR == 10) && (tskKERNEL_VERSION_MINOR >= 4))
+    (void)ulTaskNotifyValueClear(NULL, bits);
+#else
+    TaskHandle_t hTask = xTaskGetCurrentTaskHandle();
+    uint32_t rflags = 0U;
+
+    /* 读取与写回之间不能被中断或其他线程置位打断 */
+    XF_OSAL_ENTER_CRITICAL();
+    (void)xTaskNotifyAndQuery(hTask, 0U, eNoAction, &rflags);
+    (void)xTaskNotify(hTask, rflags & ~bits, eSetValueWithOverwrite);
+    XF_OSAL_EXIT_CRITICAL();
+#endif
+}
+
+#if (TLS_NUM > 0)
+/**
+ * @brief 删除线程前，对其线程局部存储中不为 NULL 的值调用析构函数。
+ */
+static void thread_tls_destruct(TaskHandle_t hTask)
+{
+    xf_osal_tls_destructor_t destructor;
+    BaseType_t index;
+    void *value;
+    uint32_t i;
+
+    for (i = 0U; i < TLS_NUM; i++) {
+        destructor = ((s_tls_used & (1UL << i)) != 0U) ? s_tls_destructor[i] : NULL;
+        if (destructor == NULL) {
+            continue;
+        }
+
+        index = (BaseType_t)(XF_OSAL_PORT_TLS_FIRST_INDEX + i);
+        value = pvTaskGetThreadLocalStoragePointer(hTask, index);
+        if (value != NULL) {
+            vTaskSetThreadLocalStoragePointer(hTask, index, NULL);
+            destructor(value);
+        }
+    }
+}
+
+/**
+ * @brief 清除所有线程中指定键的值，不调用析构函数。
+ *
+ * 需要 configUSE_TRACE_FACILITY 遍历线程；未开启时不清除，由调用者将该键退役。
+ */
+static xf_err_t thread_tls_clear_key(uint32_t key)
+{
+#if configUSE_TRACE_FACILITY
+    BaseType_t index = (BaseType_t)(XF_OSAL_PORT_TLS_FIRST_INDEX + key);
+    TaskStatus_t *task;
+    UBaseType_t count;
+    UBaseType_t i;
+    xf_err_t stat;
+
+    vTaskSuspendAll();
+
+    count = uxTaskGetNumberOfTasks();
+    task  = pvPortMalloc(count * sizeof(TaskStatus_t));
+
+    if (task != NULL) {
+        count = uxTaskGetSystemState(task, count, NULL);
+        for (i = 0U; i < count; i++) {
+            vTaskSetThreadLocalStoragePointer(task[i].xHandle, index, NULL);
+        }
+        stat = XF_OK;
+    } else {
+        stat = XF_ERR_NO_MEM;
+    }
+    (void)xTaskResumeAll();
+
+    vPortFree(task);
+
+    /* Return execution status */
+    return (stat);
+#else
+    (void)key;
+    return (XF_OK);
+#endif
+}
+#endif
+
 #endif
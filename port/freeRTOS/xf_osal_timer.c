@@ -55,7 +55,7 @@ xf_osal_timer_t xf_osal_timer_create(xf_osal_timer_func_t func, xf_osal_timer_ty
         /* is provided and if it also contains space for callback and its argument  */
         if ((attr != NULL) && (attr->cb_mem != NULL)) {
             if (attr->cb_size >= (sizeof(StaticTimer_t) + sizeof(timer_callback_t))) {
-                callb = (timer_callback_t *)((uint32_t)attr->cb_mem + sizeof(StaticTimer_t));
+                callb = (timer_callback_t *)((uintptr_t)attr->cb_mem + sizeof(StaticTimer_t));
             }
         }
 #endif
@@ -104,7 +104,7 @@ xf_osal_timer_t xf_osal_timer_create(xf_osal_timer_func_t func, xf_osal_timer_ty
                 mem = 0;
             }
             /* Store callback memory dynamic allocation flag */
-            callb = (timer_callback_t *)((uint32_t)callb | callb_dyn);
+            callb = (timer_callback_t *)((uintptr_t)callb | callb_dyn);
             /*
               timer_callback function is always provided as a callback and is used to call application
               specified function with its argument both stored in structure callb.
@@ -124,11 +124,17 @@ xf_osal_timer_t xf_osal_timer_create(xf_osal_timer_func_t func, xf_osal_timer_ty
 #if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
             if ((hTimer == NULL) && (callb != NULL) && (callb_dyn == 1U)) {
                 /* Failed to create a timer, release allocated resources */
-                callb = (timer_callback_t *)((uint32_t)callb & ~1U);
+                callb = (timer_callback_t *)((uintptr_t)callb & ~(uintptr_t)1U);
 
                 vPortFree(callb);
             }
 #endif
+
+            if ((hTimer != NULL) && ((mem == 0) || (callb_dyn != 0U))) {
+                XF_OSAL_PORT_ALLOC_HOOK(XF_OSAL_ALLOC_OP_ALLOC, XF_OSAL_OBJ_TIMER, hTimer, name,
+                                        ((mem == 0) ? sizeof(StaticTimer_t) : 0U)
+                                        + ((callb_dyn != 0U) ? sizeof(timer_callback_t) : 0U));
+            }
         }
     }
 
@@ -236,10 +242,11 @@ xf_err_t xf_osal_timer_delete(xf_osal_timer_t timer)
 #endif
 
         if (xTimerDelete(hTimer, 0) == pdPASS) {
+            XF_OSAL_PORT_ALLOC_HOOK(XF_OSAL_ALLOC_OP_FREE, XF_OSAL_OBJ_TIMER, hTimer, NULL, 0U);
 #if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
-            if ((uint32_t)callb & 1U) {
+            if (((uintptr_t)callb & 1U) != 0U) {
                 /* Callback memory was allocated from dynamic pool, clear flag */
-                callb = (timer_callback_t *)((uint32_t)callb & ~1U);
+                callb = (timer_callback_t *)((uintptr_t)callb & ~(uintptr_t)1U);
 
                 /* Return allocated memory to dynamic pool */
                 vPortFree(callb);
@@ -269,7 +276,7 @@ static void timer_callback(TimerHandle_t hTimer)
     callb = (timer_callback_t *)pvTimerGetTimerID(hTimer);
 
     /* Remove dynamic allocation flag */
-    callb = (timer_callback_t *)((uint32_t)callb & ~1U);
+    callb = (timer_callback_t *)((uintptr_t)callb & ~(uintptr_t)1U);
 
     if (callb != NULL) {
         callb->func(callb->arg);
@@ -0,0 +1,6 @@
+# 从基准测试的输出中取出 JSON 行：cmake -DIN=<输出> -DOUT=<结果> -P bench_filter.cmake
+
+file(STRINGS "${IN}" lines REGEX "^{")
+list(JOIN lines "\n" content)
+file(WRITE "${OUT}" "${content}\n")
+message(STATUS "${content}")
@@ -0,0 +1,34 @@
+/**
+ * @file bench_main.c
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief 在模拟器上运行 bench/xf_osal_bench.c, 结果以 JSON 行输出到标准输出。
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "sim.h"
+#include "xf_osal_bench.h"
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Static Prototypes] ================================= */
+
+/* ==================== [Static Variables] ================================== */
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+int sim_main(void)
+{
+    return (xf_osal_bench_run(printf) == XF_OK) ? 0 : 1;
+}
+
+/* ==================== [Static Functions] ================================== */
@@ -0,0 +1,105 @@
+/**
+ * @file FreeRTOSConfig.h
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief FreeRTOS POSIX 模拟器配置，开启 xf_osal FreeRTOS 对接层用到的全部功能。
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+#include <stdint.h>
+
+/* ==================== [Kernel] ============================================ */
+
+#define configUSE_PREEMPTION                        1
+#define configUSE_PORT_OPTIMISED_TASK_SELECTION     0
+#define configUSE_TIME_SLICING                      1
+/* 不取 1000, 使 tick 与 ms 数值不同，测试能发现把 tick 当作 ms 的错误 */
+#define configTICK_RATE_HZ                          (250)
+#define configMAX_PRIORITIES                        (32)
+#define configMINIMAL_STACK_SIZE                    ((unsigned short)4096)
+#define configSTACK_DEPTH_TYPE                      uint32_t
+#define configMAX_TASK_NAME_LEN                     (16)
+#define configUSE_16_BIT_TICKS                      0
+#define configIDLE_SHOULD_YIELD                     1
+#define configUSE_TASK_NOTIFICATIONS                1
+#define configTASK_NOTIFICATION_ARRAY_ENTRIES       1
+#define configNUM_THREAD_LOCAL_STORAGE_POINTERS     5
+#define configUSE_NEWLIB_REENTRANT                  0
+#define configENABLE_BACKWARD_COMPATIBILITY         1
+
+/* ==================== [Memory] ============================================ */
+
+#define configSUPPORT_STATIC_ALLOCATION             1
+#define configSUPPORT_DYNAMIC_ALLOCATION            1
+#define configTOTAL_HEAP_SIZE                       ((size_t)(4 * 1024 * 1024))
+#define configKERNEL_PROVIDED_STATIC_MEMORY         1
+
+/* ==================== [Objects] =========================================== */
+
+#define configUSE_MUTEXES                           1
+#define configUSE_RECURSIVE_MUTEXES                 1
+#define configUSE_COUNTING_SEMAPHORES               1
+#define configUSE_QUEUE_SETS                        1
+#define configQUEUE_REGISTRY_SIZE                   (32)
+#define configUSE_TRACE_FACILITY                    1
+#define configUSE_STATS_FORMATTING_FUNCTIONS        0
+
+#define configUSE_TIMERS                            1
+#define configTIMER_TASK_PRIORITY                   (configMAX_PRIORITIES - 1)
+#define configTIMER_QUEUE_LENGTH                    (32)
+#define configTIMER_TASK_STACK_DEPTH                (configMINIMAL_STACK_SIZE)
+
+/* ==================== [Hooks] ============================================= */
+
+/* 由 xf_osal 对接层实现（XF_OSAL_IDLE_HOOK_ENABLE） */
+#define configUSE_IDLE_HOOK                         1
+#define configUSE_TICK_HOOK                         0
+#define configUSE_MALLOC_FAILED_HOOK                0
+#define configCHECK_FOR_STACK_OVERFLOW              0
+
+/*
+ * 无滴答睡眠由 sim.c 模拟：POSIX 移植的滴答信号无法停止，睡眠期间到达的滴答在调度器恢复时补上，
+ * sim_suppress_ticks_and_sleep() 按真实时间睡眠并记录真实对接层可以省去的滴答中断数。
+ */
+#define configUSE_TICKLESS_IDLE                     2
+#define configEXPECTED_IDLE_TIME_BEFORE_SLEEP       2
+
+void sim_suppress_ticks_and_sleep(uint32_t expected_ticks);
+uint32_t xf_osal_port_pre_sleep(uint32_t expected_ticks);
+void xf_osal_port_post_sleep(uint32_t expected_ticks);
+
+#define portSUPPRESS_TICKS_AND_SLEEP(x)             sim_suppress_ticks_and_sleep(x)
+#define configPRE_SLEEP_PROCESSING(x)               (x) = xf_osal_port_pre_sleep(x)
+#define configPOST_SLEEP_PROCESSING(x)              xf_osal_port_post_sleep(x)
+
+/* ==================== [API] =============================================== */
+
+#define INCLUDE_vTaskPrioritySet                    1
+#define INCLUDE_uxTaskPriorityGet                   1
+#define INCLUDE_vTaskDelete                         1
+#define INCLUDE_vTaskSuspend                        1
+#define INCLUDE_xTaskDelayUntil                     1
+#define INCLUDE_vTaskDelay                          1
+#define INCLUDE_xTaskGetSchedulerState              1
+#define INCLUDE_xTaskGetCurrentTaskHandle           1
+#define INCLUDE_uxTaskGetStackHighWaterMark         1
+#define INCLUDE_xTaskGetIdleTaskHandle              1
+#define INCLUDE_eTaskGetState                       1
+#define INCLUDE_xTaskAbortDelay                     1
+#define INCLUDE_xTaskGetHandle                      1
+#define INCLUDE_xSemaphoreGetMutexHolder            1
+#define INCLUDE_xTimerPendFunctionCall              1
+
+/* ==================== [Assert] ============================================ */
+
+void sim_assert_failed(const char *file, int line);
+
+#define configASSERT(x)                             do { if (!(x)) { sim_assert_failed(__FILE__, __LINE__); } } while (0)
+
+#endif /* FREERTOS_CONFIG_H */
@@ -0,0 +1,33 @@
+/**
+ * @file xf_osal_config.h
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief 模拟器工程的 xf_osal 配置：默认开启的功能全部开启，另开启空闲钩子。
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+#ifndef __XF_OSAL_CONFIG_H__
+#define __XF_OSAL_CONFIG_H__
+
+/* FreeRTOSConfig.h 中 configUSE_IDLE_HOOK 为 1, vApplicationIdleHook() 由对接层提供 */
+#define XF_OSAL_IDLE_HOOK_ENABLE    1
+
+/* 模拟中断上下文，FreeRTOS 对接层据此判断 IRQ_Context(), 见 sim_run_from_isr() */
+#include <stdint.h>
+extern volatile uint32_t sim_isr_nesting;
+#define IS_IRQ_MODE()                   (sim_isr_nesting != 0U)
+
+/* 基准测试以主机单调时钟计时（ns, 按 32 位回绕），见 bench/xf_osal_bench.h */
+uint32_t sim_timestamp_ns(void);
+#define XF_OSAL_BENCH_TIMESTAMP()       sim_timestamp_ns()
+#define XF_OSAL_BENCH_TIMESTAMP_FREQ()  (1000000000UL)
+#define XF_OSAL_BENCH_STACK_SIZE        (64U * 1024U)
+
+/* 调用跟踪等统计功能使用同一时钟，滴答的分辨率不足以测量单条记录 */
+#define XF_OSAL_TRACE_TIMESTAMP()       sim_timestamp_ns()
+#define XF_OSAL_TRACE_TIMESTAMP_FREQ()  (1000000000UL)
+
+#endif /* __XF_OSAL_CONFIG_H__ */
@@ -0,0 +1,38 @@
+/**
+ * @file xf_utils.h
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief 模拟器工程使用的 xf_utils 最小实现，只提供 xf_osal 用到的类型与错误码。
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * 与 XFusion 一起编译时请用 -DXF_UTILS_INCLUDE_DIR=<dir> 指定完整的 xf_utils.
+ */
+
+#ifndef __XF_UTILS_H__
+#define __XF_UTILS_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* ==================== [Defines] =========================================== */
+
+#define XF_OK                   0
+#define XF_FAIL                 -1
+#define XF_ERR_NO_MEM           0x101
+#define XF_ERR_INVALID_ARG      0x102
+#define XF_ERR_NOT_SUPPORTED    0x106
+#define XF_ERR_TIMEOUT          0x107
+#define XF_ERR_RESOURCE         0x120
+#define XF_ERR_ISR              0x121
+
+/* ==================== [Typedefs] ========================================== */
+
+typedef int32_t xf_err_t;
+
+#endif /* __XF_UTILS_H__ */
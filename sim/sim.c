@@ -0,0 +1,195 @@
+/**
+ * @file sim.c
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include <stdlib.h>
+#include <time.h>
+
+#include "sim.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Static Prototypes] ================================= */
+
+static void sim_main_thread(void *argument);
+
+/* ==================== [Global Variables] ================================== */
+
+/* 非 0 时处于模拟的中断上下文，见 sim/config/xf_osal_config.h 中的 IS_IRQ_MODE() */
+volatile uint32_t sim_isr_nesting = 0U;
+
+/* ==================== [Static Variables] ================================== */
+
+static volatile uint32_t s_failures = 0U;
+
+/* 无滴答睡眠统计，见 sim_suppress_ticks_and_sleep() */
+static volatile uint32_t s_sleeps = 0U;
+static volatile uint32_t s_avoided_ticks = 0U;
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+int main(void)
+{
+    const xf_osal_thread_attr_t attr = {
+        .name       = "sim_main",
+        .stack_size = SIM_STACK_SIZE,
+        .priority   = XF_OSAL_PRIORITY_NORMOL,
+    };
+
+    setvbuf(stdout, NULL, _IOLBF, 0);
+
+    if (xf_osal_thread_create(sim_main_thread, NULL, &attr) == NULL) {
+        fprintf(stderr, "failed to create main thread\n");
+        return 1;
+    }
+
+    vTaskStartScheduler();
+
+    /* 不会到达这里 */
+    return 1;
+}
+
+void sim_check_failed(const char *file, int line, const char *expr)
+{
+    s_failures++;
+    printf("%s:%d: check failed: %s\n", file, line, expr);
+}
+
+uint32_t sim_get_failures(void)
+{
+    return s_failures;
+}
+
+uint64_t sim_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+uint32_t sim_timestamp_ns(void)
+{
+    return (uint32_t)sim_now_ns();
+}
+
+uint32_t sim_get_seed(void)
+{
+    const char *env = getenv("XF_OSAL_SIM_SEED");
+    uint32_t seed;
+
+    if (env != NULL) {
+        seed = (uint32_t)strtoul(env, NULL, 0);
+    } else {
+        seed = (uint32_t)sim_now_ns();
+    }
+
+    return (seed != 0U) ? seed : 1U;
+}
+
+uint32_t sim_rand(uint32_t *state)
+{
+    uint32_t x = *state;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+
+    return x;
+}
+
+void sim_get_sleep_stats(uint32_t *sleeps, uint32_t *avoided_ticks)
+{
+    if (sleeps != NULL) {
+        *sleeps = s_sleeps;
+    }
+    if (avoided_ticks != NULL) {
+        *avoided_ticks = s_avoided_ticks;
+    }
+}
+
+void sim_run_from_isr(void (*func)(void *arg), void *arg)
+{
+    taskENTER_CRITICAL();
+    sim_isr_nesting++;
+    func(arg);
+    sim_isr_nesting--;
+    taskEXIT_CRITICAL();
+}
+
+/**
+ * @brief portSUPPRESS_TICKS_AND_SLEEP() 的模拟实现，在空闲线程中、调度器暂停期间调用。
+ *
+ * 真实的对接层在这里关闭滴答中断，设置 ticks 个周期后的唤醒中断再进入低功耗。
+ * POSIX 移植的滴答信号无法停止，调度器暂停期间到达的滴答会在恢复时补上，
+ * 因此这里只按真实时间睡眠，并记录本可以省去的滴答中断数（唤醒本身仍需一次中断）。
+ */
+void sim_suppress_ticks_and_sleep(uint32_t expected_ticks)
+{
+    uint32_t ticks = expected_ticks;
+    uint64_t deadline;
+    uint64_t now;
+    struct timespec ts;
+
+    if (eTaskConfirmSleepModeStatus() == eAbortSleep) {
+        return;
+    }
+
+    configPRE_SLEEP_PROCESSING(ticks);
+
+    if (ticks != 0U) {
+        deadline = sim_now_ns() + ((uint64_t)ticks * (1000000000ULL / configTICK_RATE_HZ));
+        /* 滴答信号会打断 nanosleep(), 按剩余时间继续睡眠 */
+        while ((now = sim_now_ns()) < deadline) {
+            ts.tv_sec  = (time_t)((deadline - now) / 1000000000ULL);
+            ts.tv_nsec = (long)((deadline - now) % 1000000000ULL);
+            (void)nanosleep(&ts, NULL);
+        }
+
+        s_sleeps++;
+        s_avoided_ticks += ticks - 1U;
+    }
+
+    configPOST_SLEEP_PROCESSING(ticks);
+}
+
+void sim_assert_failed(const char *file, int line)
+{
+    printf("%s:%d: configASSERT failed\n", file, line);
+    abort();
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static void sim_main_thread(void *argument)
+{
+    int ret;
+
+    (void)argument;
+
+    ret = sim_main();
+    if ((ret == 0) && (s_failures != 0U)) {
+        ret = 1;
+    }
+
+    printf("%s (%u failed checks)\n", (ret == 0) ? "PASSED" : "FAILED", (unsigned)s_failures);
+    exit(ret);
+}
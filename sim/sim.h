@@ -0,0 +1,106 @@
+/**
+ * @file sim.h
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief FreeRTOS POSIX 模拟器上的测试运行框架。
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * 每个测试程序实现 sim_main(), 由 sim.c 中的 main() 在调度器启动后的线程中调用，
+ * 返回值与检查失败次数决定进程退出码，供 ctest 判断。
+ */
+
+#ifndef __SIM_H__
+#define __SIM_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "xf_osal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/* 模拟器中每个线程都是一个 pthread, 栈不能小于 PTHREAD_STACK_MIN */
+#define SIM_STACK_SIZE          (64U * 1024U)
+
+/* ==================== [Global Prototypes] ================================= */
+
+/**
+ * @brief 测试程序入口，在优先级为 XF_OSAL_PRIORITY_NORMOL 的线程中运行。
+ *
+ * @return int 0 表示通过。
+ */
+int sim_main(void);
+
+/**
+ * @brief 记录一次检查失败，不中止测试。
+ */
+void sim_check_failed(const char *file, int line, const char *expr);
+
+/**
+ * @brief 获取检查失败次数。
+ */
+uint32_t sim_get_failures(void);
+
+/**
+ * @brief 主机单调时钟，单位 ns.
+ */
+uint64_t sim_now_ns(void);
+
+/**
+ * @brief sim_now_ns() 的低 32 位，作为基准测试的时间戳。
+ */
+uint32_t sim_timestamp_ns(void);
+
+/**
+ * @brief 随机种子：环境变量 XF_OSAL_SIM_SEED, 未设置时取当前时间。
+ */
+uint32_t sim_get_seed(void);
+
+/**
+ * @brief xorshift32 伪随机数，state 不能为 0.
+ */
+uint32_t sim_rand(uint32_t *state);
+
+/**
+ * @brief 模拟的无滴答睡眠统计：睡眠次数与省去的滴答中断数，均为启动以来的累计值。
+ */
+void sim_get_sleep_stats(uint32_t *sleeps, uint32_t *avoided_ticks);
+
+/**
+ * @brief 模拟在中断服务函数中调用 func: 期间禁止调度与滴答中断，对接层的 IRQ_Context() 返回 1.
+ *
+ * func 中只能调用允许在中断中调用的接口，不能阻塞。
+ */
+void sim_run_from_isr(void (*func)(void *arg), void *arg);
+
+/* ==================== [Macros] ============================================ */
+
+#define SIM_CHECK(expr)                                                             \
+    do {                                                                            \
+        if (!(expr)) {                                                              \
+            sim_check_failed(__FILE__, __LINE__, #expr);                            \
+        }                                                                           \
+    } while (0)
+
+#define SIM_CHECK_EQ(a, b)      SIM_CHECK((a) == (b))
+
+#define SIM_RUN(test)                                                               \
+    do {                                                                            \
+        uint32_t _fail = sim_get_failures();                                        \
+        test();                                                                     \
+        printf("%s %s\n", (sim_get_failures() == _fail) ? "[ OK ]" : "[FAIL]", #test); \
+    } while (0)
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* __SIM_H__ */
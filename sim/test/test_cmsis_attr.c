@@ -0,0 +1,304 @@
+/**
+ * @file test_cmsis_attr.c
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief CMSIS-OS2 对接层创建线程时的属性转换，os* 接口由本文件打桩。
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * xf_osal_thread_attr_t 与 osThreadAttr_t 布局不同（后者多出 tz_module 等字段），
+ * 对接层必须逐个字段复制；这里记录 osThreadNew() 收到的属性并逐项比较。
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "xf_osal_internal.h"
+
+/* ==================== [Defines] =========================================== */
+
+#define FAKE_THREAD_ID          ((osThreadId_t)(uintptr_t)0x1000U)
+
+/* ==================== [Typedefs] ========================================== */
+
+typedef struct _fake_thread_new_t {
+    uint32_t            calls;
+    osThreadFunc_t      func;
+    void               *argument;
+    uint32_t            has_attr;
+    osThreadAttr_t      attr;
+} fake_thread_new_t;
+
+/* ==================== [Static Prototypes] ================================= */
+
+static void test_attr_copy(void);
+static void test_attr_null(void);
+static void test_priority_values(void);
+static void thread_func(void *argument);
+
+/* ==================== [Static Variables] ================================== */
+
+static uint32_t s_failures = 0U;
+static fake_thread_new_t s_new;
+
+/* ==================== [Macros] ============================================ */
+
+#define CHECK(expr)                                                                 \
+    do {                                                                            \
+        if (!(expr)) {                                                              \
+            s_failures++;                                                           \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #expr);         \
+        }                                                                           \
+    } while (0)
+
+/* ==================== [Global Functions] ================================== */
+
+int main(void)
+{
+    test_attr_copy();
+    test_attr_null();
+    test_priority_values();
+
+    printf("%s (%u failed checks)\n", (s_failures == 0U) ? "PASSED" : "FAILED", (unsigned)s_failures);
+
+    return (s_failures == 0U) ? 0 : 1;
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static void test_attr_copy(void)
+{
+    static uint64_t cb_mem[32];
+    static uint64_t stack_mem[256];
+    const xf_osal_thread_attr_t attr = {
+        .name       = "attr",
+        .attr_bits  = osThreadJoinable,
+        .cb_mem     = cb_mem,
+        .cb_size    = sizeof(cb_mem),
+        .stack_mem  = stack_mem,
+        .stack_size = sizeof(stack_mem),
+        .priority   = XF_OSAL_PRIORITY_HIGH,
+#if XF_CMSIS_THREAD_AFFINITY_IS_ENABLE
+        .affinity_mask = 0x2U,
+#endif
+    };
+    int arg;
+    xf_osal_thread_t thread;
+
+    memset(&s_new, 0xA5, sizeof(s_new));
+    s_new.calls = 0U;
+
+    thread = xf_osal_thread_create(thread_func, &arg, &attr);
+
+    CHECK(thread == (xf_osal_thread_t)FAKE_THREAD_ID);
+    CHECK(s_new.calls == 1U);
+    CHECK(s_new.func == (osThreadFunc_t)thread_func);
+    CHECK(s_new.argument == &arg);
+    CHECK(s_new.has_attr == 1U);
+    CHECK(s_new.attr.name == attr.name);
+    CHECK(s_new.attr.attr_bits == attr.attr_bits);
+    CHECK(s_new.attr.cb_mem == attr.cb_mem);
+    CHECK(s_new.attr.cb_size == attr.cb_size);
+    CHECK(s_new.attr.stack_mem == attr.stack_mem);
+    CHECK(s_new.attr.stack_size == attr.stack_size);
+    CHECK(s_new.attr.priority == osPriorityHigh);
+    CHECK(s_new.attr.tz_module == 0U);
+    CHECK(s_new.attr.reserved == 0U);
+#if XF_CMSIS_THREAD_AFFINITY_IS_ENABLE
+    CHECK(s_new.attr.affinity_mask == attr.affinity_mask);
+#endif
+}
+
+static void test_attr_null(void)
+{
+    xf_osal_thread_t thread;
+
+    memset(&s_new, 0, sizeof(s_new));
+    s_new.has_attr = 1U;
+
+    thread = xf_osal_thread_create(thread_func, NULL, NULL);
+
+    CHECK(thread == (xf_osal_thread_t)FAKE_THREAD_ID);
+    CHECK(s_new.calls == 1U);
+    CHECK(s_new.has_attr == 0U);
+}
+
+/* 优先级按数值直接交给 CMSIS, 两边的枚举值必须一致 */
+static void test_priority_values(void)
+{
+    const xf_osal_thread_attr_t attr_idle = { .priority = XF_OSAL_PRIORITY_IDLE };
+    const xf_osal_thread_attr_t attr_isr  = { .priority = XF_OSAL_PRIORITY_ISR };
+
+    CHECK((int)XF_OSAL_PRIORITY_NONE == (int)osPriorityNone);
+    CHECK((int)XF_OSAL_PRIORITY_IDLE == (int)osPriorityIdle);
+    CHECK((int)XF_OSAL_PRIORITY_LOW == (int)osPriorityLow);
+    CHECK((int)XF_OSAL_PRIORITY_NORMOL == (int)osPriorityNormal);
+    CHECK((int)XF_OSAL_PRIORITY_REALTIME7 == (int)osPriorityRealtime7);
+    CHECK((int)XF_OSAL_PRIORITY_ISR == (int)osPriorityISR);
+
+    (void)xf_osal_thread_create(thread_func, NULL, &attr_idle);
+    CHECK(s_new.attr.priority == osPriorityIdle);
+    (void)xf_osal_thread_create(thread_func, NULL, &attr_isr);
+    CHECK(s_new.attr.priority == osPriorityISR);
+}
+
+static void thread_func(void *argument)
+{
+    (void)argument;
+}
+
+/* ==================== [Fakes] ============================================= */
+
+osThreadId_t osThreadNew(osThreadFunc_t func, void *argument, const osThreadAttr_t *attr)
+{
+    s_new.calls++;
+    s_new.func     = func;
+    s_new.argument = argument;
+    s_new.has_attr = (attr != NULL) ? 1U : 0U;
+    if (attr != NULL) {
+        s_new.attr = *attr;
+    }
+
+    return FAKE_THREAD_ID;
+}
+
+uint32_t xf_osal_kernel_ms_to_ticks(uint32_t ms)
+{
+    return ms;
+}
+
+osStatus_t osDelay(uint32_t ticks)
+{
+    (void)ticks;
+    return osOK;
+}
+
+osStatus_t osDelayUntil(uint32_t ticks)
+{
+    (void)ticks;
+    return osOK;
+}
+
+int32_t osKernelLock(void)
+{
+    return 0;
+}
+
+int32_t osKernelRestoreLock(int32_t lock)
+{
+    return lock;
+}
+
+uint32_t osThreadEnumerate(osThreadId_t *thread_array, uint32_t array_items)
+{
+    (void)thread_array;
+    (void)array_items;
+    return 0U;
+}
+
+uint32_t osThreadFlagsClear(uint32_t flags)
+{
+    (void)flags;
+    return 0U;
+}
+
+uint32_t osThreadFlagsGet(void)
+{
+    return 0U;
+}
+
+uint32_t osThreadFlagsSet(osThreadId_t thread_id, uint32_t flags)
+{
+    (void)thread_id;
+    return flags;
+}
+
+uint32_t osThreadFlagsWait(uint32_t flags, uint32_t options, uint32_t timeout)
+{
+    (void)flags;
+    (void)options;
+    (void)timeout;
+    return (uint32_t)osFlagsErrorTimeout;
+}
+
+uint32_t osThreadGetCount(void)
+{
+    return 0U;
+}
+
+osThreadId_t osThreadGetId(void)
+{
+    return FAKE_THREAD_ID;
+}
+
+const char *osThreadGetName(osThreadId_t thread_id)
+{
+    (void)thread_id;
+    return NULL;
+}
+
+osPriority_t osThreadGetPriority(osThreadId_t thread_id)
+{
+    (void)thread_id;
+    return osPriorityNormal;
+}
+
+uint32_t osThreadGetStackSpace(osThreadId_t thread_id)
+{
+    (void)thread_id;
+    return 0U;
+}
+
+osThreadState_t osThreadGetState(osThreadId_t thread_id)
+{
+    (void)thread_id;
+    return osThreadRunning;
+}
+
+osStatus_t osThreadResume(osThreadId_t thread_id)
+{
+    (void)thread_id;
+    return osOK;
+}
+
+osStatus_t osThreadSetPriority(osThreadId_t thread_id, osPriority_t priority)
+{
+    (void)thread_id;
+    (void)priority;
+    return osOK;
+}
+
+osStatus_t osThreadSuspend(osThreadId_t thread_id)
+{
+    (void)thread_id;
+    return osOK;
+}
+
+osStatus_t osThreadTerminate(osThreadId_t thread_id)
+{
+    (void)thread_id;
+    return osOK;
+}
+
+osStatus_t osThreadYield(void)
+{
+    return osOK;
+}
+
+#if XF_CMSIS_THREAD_AFFINITY_IS_ENABLE
+osStatus_t osThreadSetAffinityMask(osThreadId_t thread_id, uint32_t affinity_mask)
+{
+    (void)thread_id;
+    (void)affinity_mask;
+    return osOK;
+}
+
+uint32_t osThreadGetAffinityMask(osThreadId_t thread_id)
+{
+    (void)thread_id;
+    return 0U;
+}
+#endif
@@ -0,0 +1,1094 @@
+/**
+ * @file test_conformance.c
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief FreeRTOS 对接层与 CMSIS-OS2 对接层应一致的语义。
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include <string.h>
+
+#include "sim.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* ==================== [Defines] =========================================== */
+
+#define TEST_FLAG_A             (0x01U)
+#define TEST_FLAG_B             (0x02U)
+#define TEST_FLAG_C             (0x04U)
+#define TEST_FLAGS_ALL          (TEST_FLAG_A | TEST_FLAG_B | TEST_FLAG_C)
+
+#define TEST_COND_WAITERS       (4U)
+
+/* ==================== [Typedefs] ========================================== */
+
+typedef struct _notify_arg_t {
+    xf_osal_thread_t    target;
+    uint32_t            delay;
+    uint32_t            flags;
+} notify_arg_t;
+
+typedef struct _sem_arg_t {
+    xf_osal_semaphore_t sem;
+    uint32_t            n;
+    volatile xf_err_t   result;
+    volatile uint32_t   done;
+} sem_arg_t;
+
+typedef struct _cond_arg_t {
+    xf_osal_cond_t      cond;
+    xf_osal_mutex_t     mutex;
+    volatile uint32_t   waiting;
+    volatile uint32_t   woken;
+} cond_arg_t;
+
+/* ==================== [Static Prototypes] ================================= */
+
+static void test_notify_wait_timeout_zero(void);
+static void test_notify_wait_ticks(void);
+static void test_notify_wait_already_set(void);
+static void test_notify_wait_all_partial(void);
+static void test_notify_wait_from_thread(void);
+static void test_notify_clear(void);
+static void test_priority_idle_isr(void);
+static void test_semaphore_acquire_n(void);
+static void test_select_semaphore(void);
+static void test_select_delete_nonempty(void);
+static void test_cond_signal_broadcast(void);
+static void test_coro_notify(void);
+static void test_queue_overwrite_peek(void);
+static void test_mutex_recursive(void);
+static void test_event_wait_all(void);
+static void test_timer_once_periodic(void);
+static void test_msgbuf_messages(void);
+static void test_streambuf_trigger(void);
+static void test_broadcast_subscribers(void);
+static void test_lwsem_count_wake(void);
+static void test_ratelimit_basic(void);
+static void test_periodic_basic(void);
+static void test_sched_basic(void);
+static void test_tls_destructor(void);
+static void test_defer(void);
+static void test_heap_stats(void);
+
+static xf_osal_thread_t spawn(xf_osal_thread_func_t func, void *arg, xf_osal_priority_t priority);
+static void notify_clear_all(void);
+static void idle_thread(void *argument);
+static void notify_thread(void *argument);
+static void sem_acquire_n_thread(void *argument);
+static void cond_wait_thread(void *argument);
+
+/* ==================== [Static Variables] ================================== */
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+int sim_main(void)
+{
+    SIM_RUN(test_notify_wait_timeout_zero);
+    SIM_RUN(test_notify_wait_ticks);
+    SIM_RUN(test_notify_wait_already_set);
+    SIM_RUN(test_notify_wait_all_partial);
+    SIM_RUN(test_notify_wait_from_thread);
+    SIM_RUN(test_notify_clear);
+    SIM_RUN(test_priority_idle_isr);
+    SIM_RUN(test_semaphore_acquire_n);
+    SIM_RUN(test_select_semaphore);
+    SIM_RUN(test_select_delete_nonempty);
+    SIM_RUN(test_cond_signal_broadcast);
+    SIM_RUN(test_coro_notify);
+    SIM_RUN(test_queue_overwrite_peek);
+    SIM_RUN(test_mutex_recursive);
+    SIM_RUN(test_event_wait_all);
+    SIM_RUN(test_timer_once_periodic);
+    SIM_RUN(test_msgbuf_messages);
+    SIM_RUN(test_streambuf_trigger);
+    SIM_RUN(test_broadcast_subscribers);
+    SIM_RUN(test_lwsem_count_wake);
+    SIM_RUN(test_ratelimit_basic);
+    SIM_RUN(test_periodic_basic);
+    SIM_RUN(test_sched_basic);
+    SIM_RUN(test_tls_destructor);
+    SIM_RUN(test_defer);
+    SIM_RUN(test_heap_stats);
+
+    return 0;
+}
+
+/* ==================== [Static Functions] ================================== */
+
+/* timeout 为 0 时只检查一次，不阻塞 */
+static void test_notify_wait_timeout_zero(void)
+{
+    uint32_t t0;
+
+    notify_clear_all();
+
+    t0 = xf_osal_kernel_get_tick_count();
+    SIM_CHECK_EQ(xf_osal_thread_notify_wait(TEST_FLAG_A, XF_OSAL_WAIT_ANY, 0U), XF_ERR_RESOURCE);
+    SIM_CHECK(xf_osal_kernel_get_tick_count() - t0 <= 1U);
+}
+
+/* timeout 的单位是 tick, 不是 ms */
+static void test_notify_wait_ticks(void)
+{
+    const uint32_t ticks = 20U;
+    uint64_t ns;
+    uint32_t t0;
+    uint32_t elapsed;
+
+    notify_clear_all();
+
+    SIM_CHECK(xf_osal_kernel_ms_to_ticks(1000U) == configTICK_RATE_HZ);
+
+    t0 = xf_osal_kernel_get_tick_count();
+    ns = sim_now_ns();
+    SIM_CHECK_EQ(xf_osal_thread_notify_wait(TEST_FLAG_A, XF_OSAL_WAIT_ANY, ticks), XF_ERR_TIMEOUT);
+    elapsed = xf_osal_kernel_get_tick_count() - t0;
+    ns = sim_now_ns() - ns;
+
+    SIM_CHECK(elapsed >= ticks);
+    SIM_CHECK(elapsed <= ticks + 2U);
+    SIM_CHECK(ns >= (uint64_t)(ticks - 1U) * 1000000000ULL / configTICK_RATE_HZ);
+}
+
+/* 等待前已经置位的标志立即满足，并且只清除满足条件的位 */
+static void test_notify_wait_already_set(void)
+{
+    xf_osal_thread_t self = xf_osal_thread_get_current();
+
+    notify_clear_all();
+
+    SIM_CHECK_EQ(xf_osal_thread_notify_set(self, TEST_FLAG_A | TEST_FLAG_C), XF_OK);
+    SIM_CHECK_EQ(xf_osal_thread_notify_wait(TEST_FLAG_A | TEST_FLAG_B, XF_OSAL_WAIT_ANY, 0U), XF_OK);
+    SIM_CHECK_EQ(xf_osal_thread_notify_get() & TEST_FLAGS_ALL, TEST_FLAG_C);
+
+    SIM_CHECK_EQ(xf_osal_thread_notify_wait(TEST_FLAG_C, XF_OSAL_WAIT_ANY | XF_OSAL_NO_CLEAR, 0U), XF_OK);
+    SIM_CHECK_EQ(xf_osal_thread_notify_get() & TEST_FLAGS_ALL, TEST_FLAG_C);
+}
+
+/* WAIT_ALL 只满足一部分时超时，已收到的位保留 */
+static void test_notify_wait_all_partial(void)
+{
+    xf_osal_thread_t self = xf_osal_thread_get_current();
+
+    notify_clear_all();
+
+    SIM_CHECK_EQ(xf_osal_thread_notify_set(self, TEST_FLAG_A), XF_OK);
+    SIM_CHECK_EQ(xf_osal_thread_notify_wait(TEST_FLAG_A | TEST_FLAG_B, XF_OSAL_WAIT_ALL, 0U), XF_ERR_RESOURCE);
+    SIM_CHECK_EQ(xf_osal_thread_notify_wait(TEST_FLAG_A | TEST_FLAG_B, XF_OSAL_WAIT_ALL, 3U), XF_ERR_TIMEOUT);
+    SIM_CHECK_EQ(xf_osal_thread_notify_get() & TEST_FLAGS_ALL, TEST_FLAG_A);
+
+    SIM_CHECK_EQ(xf_osal_thread_notify_set(self, TEST_FLAG_B), XF_OK);
+    SIM_CHECK_EQ(xf_osal_thread_notify_wait(TEST_FLAG_A | TEST_FLAG_B, XF_OSAL_WAIT_ALL, 0U), XF_OK);
+    SIM_CHECK_EQ(xf_osal_thread_notify_get() & TEST_FLAGS_ALL, 0U);
+}
+
+/* 其他线程分两次置位，WAIT_ALL 在两位都到齐后返回 */
+static void test_notify_wait_from_thread(void)
+{
+    notify_arg_t arg_a = { xf_osal_thread_get_current(), 5U, TEST_FLAG_A };
+    notify_arg_t arg_b = { xf_osal_thread_get_current(), 10U, TEST_FLAG_B };
+    uint32_t t0;
+
+    notify_clear_all();
+
+    t0 = xf_osal_kernel_get_tick_count();
+    SIM_CHECK(spawn(notify_thread, &arg_a, XF_OSAL_PRIORITY_NORMOL) != NULL);
+    SIM_CHECK(spawn(notify_thread, &arg_b, XF_OSAL_PRIORITY_NORMOL) != NULL);
+
+    SIM_CHECK_EQ(xf_osal_thread_notify_wait(TEST_FLAG_A | TEST_FLAG_B, XF_OSAL_WAIT_ALL, XF_OSAL_WAIT_FOREVER), XF_OK);
+    SIM_CHECK(xf_osal_kernel_get_tick_count() - t0 >= 10U);
+    SIM_CHECK_EQ(xf_osal_thread_notify_get() & TEST_FLAGS_ALL, 0U);
+
+    /* 等待两个线程退出 */
+    xf_osal_delay(2U);
+}
+
+/* notify_clear 只清除指定的位 */
+static void test_notify_clear(void)
+{
+    xf_osal_thread_t self = xf_osal_thread_get_current();
+
+    notify_clear_all();
+
+    SIM_CHECK_EQ(xf_osal_thread_notify_set(self, TEST_FLAGS_ALL), XF_OK);
+    SIM_CHECK_EQ(xf_osal_thread_notify_clear(TEST_FLAG_B), XF_OK);
+    SIM_CHECK_EQ(xf_osal_thread_notify_get() & TEST_FLAGS_ALL, TEST_FLAG_A | TEST_FLAG_C);
+
+    SIM_CHECK_EQ(xf_osal_thread_notify_clear(TEST_FLAG_B), XF_OK);
+    SIM_CHECK_EQ(xf_osal_thread_notify_get() & TEST_FLAGS_ALL, TEST_FLAG_A | TEST_FLAG_C);
+
+    SIM_CHECK_EQ(xf_osal_thread_notify_clear(TEST_FLAG_A | TEST_FLAG_C), XF_OK);
+    SIM_CHECK_EQ(xf_osal_thread_notify_get() & TEST_FLAGS_ALL, 0U);
+}
+
+/* IDLE 与 ISR 映射到最低与最高的原生优先级，而不是把枚举值直接交给内核 */
+static void test_priority_idle_isr(void)
+{
+    xf_osal_thread_t idle;
+    xf_osal_thread_t isr;
+
+    idle = spawn(idle_thread, NULL, XF_OSAL_PRIORITY_IDLE);
+    isr  = spawn(idle_thread, NULL, XF_OSAL_PRIORITY_ISR);
+    SIM_CHECK(idle != NULL);
+    SIM_CHECK(isr != NULL);
+    if ((idle == NULL) || (isr == NULL)) {
+        return;
+    }
+
+    SIM_CHECK_EQ(uxTaskPriorityGet((TaskHandle_t)idle), (UBaseType_t)tskIDLE_PRIORITY);
+    SIM_CHECK_EQ(uxTaskPriorityGet((TaskHandle_t)isr), (UBaseType_t)(configMAX_PRIORITIES - 1));
+
+    SIM_CHECK_EQ(xf_osal_thread_get_effective_priority(XF_OSAL_PRIORITY_IDLE),
+                 xf_osal_thread_get_effective_priority(XF_OSAL_PRIORITY_LOW));
+    SIM_CHECK_EQ(xf_osal_thread_get_effective_priority(XF_OSAL_PRIORITY_ISR),
+                 xf_osal_thread_get_effective_priority(XF_OSAL_PRIORITY_REALTIME7));
+
+    SIM_CHECK_EQ(xf_osal_thread_set_priority(idle, XF_OSAL_PRIORITY_ISR), XF_OK);
+    SIM_CHECK_EQ(uxTaskPriorityGet((TaskHandle_t)idle), (UBaseType_t)(configMAX_PRIORITIES - 1));
+    SIM_CHECK_EQ(xf_osal_thread_set_priority(isr, XF_OSAL_PRIORITY_IDLE), XF_OK);
+    SIM_CHECK_EQ(uxTaskPriorityGet((TaskHandle_t)isr), (UBaseType_t)tskIDLE_PRIORITY);
+
+    SIM_CHECK_EQ(xf_osal_thread_delete(idle), XF_OK);
+    SIM_CHECK_EQ(xf_osal_thread_delete(isr), XF_OK);
+}
+
+/* acquire_n: n 超过最大令牌数时报错；排队的等待者不会被后来的单令牌获取者抢先 */
+static void test_semaphore_acquire_n(void)
+{
+    xf_osal_semaphore_t sem;
+    sem_arg_t arg;
+
+    sem = xf_osal_semaphore_create(4U, 0U, NULL);
+    SIM_CHECK(sem != NULL);
+    if (sem == NULL) {
+        return;
+    }
+
+    SIM_CHECK_EQ(xf_osal_semaphore_acquire_n(sem, 5U, 0U), XF_ERR_INVALID_ARG);
+    SIM_CHECK_EQ(xf_osal_semaphore_release_n(sem, 5U), XF_ERR_RESOURCE);
+
+    arg.sem    = sem;
+    arg.n      = 3U;
+    arg.result = XF_FAIL;
+    arg.done   = 0U;
+    SIM_CHECK(spawn(sem_acquire_n_thread, &arg, XF_OSAL_PRIORITY_NORMOL) != NULL);
+    xf_osal_delay(2U);
+    SIM_CHECK_EQ(arg.done, 0U);
+
+    /* 有线程在等待 3 个令牌，单令牌获取者只能排在它后面 */
+    SIM_CHECK_EQ(xf_osal_semaphore_release(sem), XF_OK);
+    SIM_CHECK_EQ(xf_osal_semaphore_acquire(sem, 0U), XF_ERR_RESOURCE);
+    SIM_CHECK_EQ(xf_osal_semaphore_get_count(sem), 1U);
+
+    SIM_CHECK_EQ(xf_osal_semaphore_release_n(sem, 3U), XF_OK);
+    xf_osal_delay(2U);
+    SIM_CHECK_EQ(arg.done, 1U);
+    SIM_CHECK_EQ(arg.result, XF_OK);
+    SIM_CHECK_EQ(xf_osal_semaphore_get_count(sem), 1U);
+
+    SIM_CHECK_EQ(xf_osal_semaphore_acquire(sem, 0U), XF_OK);
+    SIM_CHECK_EQ(xf_osal_semaphore_delete(sem), XF_OK);
+}
+
+/* 信号量可以加入等待集合，释放后 select 返回该信号量 */
+static void test_select_semaphore(void)
+{
+    xf_osal_semaphore_t sem;
+    xf_osal_select_t set;
+    void *ready;
+
+    sem = xf_osal_semaphore_create(2U, 0U, NULL);
+    set = xf_osal_select_create(4U, NULL);
+    SIM_CHECK((sem != NULL) && (set != NULL));
+    if ((sem == NULL) || (set == NULL)) {
+        return;
+    }
+
+    SIM_CHECK_EQ(xf_osal_select_add_semaphore(set, sem), XF_OK);
+    SIM_CHECK_EQ(xf_osal_select(set, &ready, 0U), XF_ERR_RESOURCE);
+
+    SIM_CHECK_EQ(xf_osal_semaphore_release_n(sem, 2U), XF_OK);
+    SIM_CHECK_EQ(xf_osal_select(set, &ready, 5U), XF_OK);
+    SIM_CHECK(ready == (void *)sem);
+    SIM_CHECK_EQ(xf_osal_semaphore_acquire(sem, 0U), XF_OK);
+    SIM_CHECK_EQ(xf_osal_select(set, &ready, 5U), XF_OK);
+    SIM_CHECK(ready == (void *)sem);
+    SIM_CHECK_EQ(xf_osal_semaphore_acquire(sem, 0U), XF_OK);
+
+    SIM_CHECK_EQ(xf_osal_select_remove(set, sem), XF_OK);
+    SIM_CHECK_EQ(xf_osal_select_delete(set), XF_OK);
+    SIM_CHECK_EQ(xf_osal_semaphore_delete(sem), XF_OK);
+}
+
+/* 仍有成员的等待集合不能删除，移除全部成员后才能删除 */
+static void test_select_delete_nonempty(void)
+{
+    xf_osal_semaphore_t sem;
+    xf_osal_queue_t queue;
+    xf_osal_select_t set;
+    void *ready;
+    uint32_t msg = 1U;
+
+    sem   = xf_osal_semaphore_create(1U, 0U, NULL);
+    queue = xf_osal_queue_create(2U, sizeof(uint32_t), NULL);
+    set   = xf_osal_select_create(4U, NULL);
+    SIM_CHECK((sem != NULL) && (queue != NULL) && (set != NULL));
+    if ((sem == NULL) || (queue == NULL) || (set == NULL)) {
+        return;
+    }
+
+    SIM_CHECK_EQ(xf_osal_select_add_semaphore(set, sem), XF_OK);
+    SIM_CHECK_EQ(xf_osal_select_add_queue(set, queue), XF_OK);
+    SIM_CHECK_EQ(xf_osal_select_delete(set), XF_ERR_RESOURCE);
+
+    /* 拒绝删除后集合仍然可用 */
+    SIM_CHECK_EQ(xf_osal_semaphore_release(sem), XF_OK);
+    SIM_CHECK_EQ(xf_osal_select(set, &ready, 5U), XF_OK);
+    SIM_CHECK(ready == (void *)sem);
+    SIM_CHECK_EQ(xf_osal_semaphore_acquire(sem, 0U), XF_OK);
+
+    SIM_CHECK_EQ(xf_osal_select_remove(set, sem), XF_OK);
+    SIM_CHECK_EQ(xf_osal_select_delete(set), XF_ERR_RESOURCE);
+
+    /* 移除后信号量不再向集合投递 */
+    SIM_CHECK_EQ(xf_osal_semaphore_release(sem), XF_OK);
+    SIM_CHECK_EQ(xf_osal_select(set, &ready, 0U), XF_ERR_RESOURCE);
+
+    SIM_CHECK_EQ(xf_osal_select_remove(set, queue), XF_OK);
+    SIM_CHECK_EQ(xf_osal_select_delete(set), XF_OK);
+
+    /* 集合删除后成员照常工作 */
+    SIM_CHECK_EQ(xf_osal_queue_put(queue, &msg, 0U, 0U), XF_OK);
+    SIM_CHECK_EQ(xf_osal_semaphore_acquire(sem, 0U), XF_OK);
+    SIM_CHECK_EQ(xf_osal_semaphore_release(sem), XF_OK);
+    SIM_CHECK_EQ(xf_osal_semaphore_delete(sem), XF_OK);
+    SIM_CHECK_EQ(xf_osal_queue_delete(queue), XF_OK);
+}
+
+/* signal 只唤醒一个等待者，broadcast 唤醒其余全部 */
+static void test_cond_signal_broadcast(void)
+{
+    static cond_arg_t arg;
+    uint32_t i;
+
+    arg.cond    = xf_osal_cond_create(NULL);
+    arg.mutex   = xf_osal_mutex_create(NULL);
+    arg.waiting = 0U;
+    arg.woken   = 0U;
+    SIM_CHECK((arg.cond != NULL) && (arg.mutex != NULL));
+    if ((arg.cond == NULL) || (arg.mutex == NULL)) {
+        return;
+    }
+
+    for (i = 0U; i < TEST_COND_WAITERS; i++) {
+        SIM_CHECK(spawn(cond_wait_thread, &arg, XF_OSAL_PRIORITY_ABOVE_NORMAL) != NULL);
+    }
+    xf_osal_delay(5U);
+    SIM_CHECK_EQ(arg.waiting, TEST_COND_WAITERS);
+    SIM_CHECK_EQ(arg.woken, 0U);
+
+    /* 只有一个等待者返回，其余仍在等待 */
+    SIM_CHECK_EQ(xf_osal_cond_signal(arg.cond), XF_OK);
+    xf_osal_delay(5U);
+    SIM_CHECK_EQ(arg.woken, 1U);
+    xf_osal_delay(5U);
+    SIM_CHECK_EQ(arg.woken, 1U);
+
+    SIM_CHECK_EQ(xf_osal_cond_broadcast(arg.cond), XF_OK);
+    xf_osal_delay(5U);
+    SIM_CHECK_EQ(arg.woken, TEST_COND_WAITERS);
+
+    /* 没有等待者时的通知不会保留，超时为 0 的等待立即返回 */
+    SIM_CHECK_EQ(xf_osal_cond_signal(arg.cond), XF_OK);
+    SIM_CHECK_EQ(xf_osal_mutex_acquire(arg.mutex, XF_OSAL_WAIT_FOREVER), XF_OK);
+    SIM_CHECK_EQ(xf_osal_cond_timedwait(arg.cond, arg.mutex, 0U), XF_ERR_RESOURCE);
+    SIM_CHECK_EQ(xf_osal_mutex_release(arg.mutex), XF_OK);
+
+    /* 全部等待者都已离开队列，可以删除 */
+    SIM_CHECK_EQ(xf_osal_cond_delete(arg.cond), XF_OK);
+    SIM_CHECK_EQ(xf_osal_mutex_delete(arg.mutex), XF_OK);
+}
+
+/* ==================== [Coro] ============================================== */
+
+typedef struct _coro_session_t {
+    xf_osal_coro_t      coro;
+    xf_osal_queue_t     queue;
+    uint32_t            msg;
+    volatile uint32_t   got;
+    volatile uint32_t   tick;
+} coro_session_t;
+
+static xf_osal_coro_exec_t s_exec;
+
+static xf_osal_coro_status_t coro_session(xf_osal_coro_t *coro, void *arg)
+{
+    coro_session_t *s = (coro_session_t *)arg;
+
+    XF_OSAL_CORO_BEGIN(coro);
+    XF_OSAL_CORO_AWAIT(coro, xf_osal_coro_queue_get(coro, s->queue, &s->msg, XF_OSAL_WAIT_FOREVER));
+    s->got  = s->msg;
+    s->tick = xf_osal_kernel_get_tick_count();
+    XF_OSAL_CORO_END(coro);
+}
+
+static void coro_exec_thread(void *argument)
+{
+    (void)xf_osal_coro_exec_run((xf_osal_coro_exec_t *)argument);
+    xf_osal_thread_delete(NULL);
+}
+
+/* 不轮询的执行器只靠 xf_osal_coro_notify() 唤醒 */
+static void test_coro_notify(void)
+{
+    static coro_session_t s;
+    uint32_t msg = 0x5AU;
+    uint32_t t0;
+
+    s.queue = xf_osal_queue_create(4U, sizeof(uint32_t), NULL);
+    SIM_CHECK(s.queue != NULL);
+    if (s.queue == NULL) {
+        return;
+    }
+
+    SIM_CHECK_EQ(xf_osal_coro_exec_init(&s_exec, 0U), XF_OK);
+    SIM_CHECK(spawn(coro_exec_thread, &s_exec, XF_OSAL_PRIORITY_NORMOL1) != NULL);
+    SIM_CHECK_EQ(xf_osal_coro_spawn(&s_exec, &s.coro, coro_session, &s, NULL), XF_OK);
+    xf_osal_delay(5U);
+    SIM_CHECK_EQ(s.got, 0U);
+
+    t0 = xf_osal_kernel_get_tick_count();
+    SIM_CHECK_EQ(xf_osal_queue_put(s.queue, &msg, 0U, 0U), XF_OK);
+    SIM_CHECK_EQ(xf_osal_coro_notify(s.queue), XF_OK);
+    xf_osal_delay(2U);
+    SIM_CHECK_EQ(s.got, msg);
+    SIM_CHECK(s.tick - t0 <= 1U);
+    SIM_CHECK_EQ(xf_osal_coro_exec_get_count(&s_exec), 0U);
+
+    SIM_CHECK_EQ(xf_osal_coro_exec_stop(&s_exec), XF_OK);
+    xf_osal_delay(2U);
+    SIM_CHECK_EQ(xf_osal_queue_delete(s.queue), XF_OK);
+}
+
+/* ==================== [Queue] ============================================= */
+
+/* peek 读取队首而不取走；邮箱模式放入总是成功并覆盖旧消息 */
+static void test_queue_overwrite_peek(void)
+{
+    const xf_osal_queue_attr_t attr = { .attr_bits = XF_OSAL_QUEUE_OVERWRITE };
+    xf_osal_queue_t queue;
+    xf_osal_queue_t mailbox;
+    uint32_t msg;
+
+    queue   = xf_osal_queue_create(4U, sizeof(uint32_t), NULL);
+    mailbox = xf_osal_queue_create(1U, sizeof(uint32_t), &attr);
+    SIM_CHECK((queue != NULL) && (mailbox != NULL));
+    if ((queue == NULL) || (mailbox == NULL)) {
+        return;
+    }
+
+    /* 邮箱只能容纳一条消息 */
+    SIM_CHECK(xf_osal_queue_create(2U, sizeof(uint32_t), &attr) == NULL);
+
+    msg = 1U;
+    SIM_CHECK_EQ(xf_osal_queue_put(queue, &msg, 0U, 0U), XF_OK);
+    msg = 2U;
+    SIM_CHECK_EQ(xf_osal_queue_put(queue, &msg, 0U, 0U), XF_OK);
+    msg = 0U;
+    SIM_CHECK_EQ(xf_osal_queue_peek(queue, &msg, 0U), XF_OK);
+    SIM_CHECK_EQ(msg, 1U);
+    SIM_CHECK_EQ(xf_osal_queue_get_count(queue), 2U);
+    SIM_CHECK_EQ(xf_osal_queue_get(queue, &msg, NULL, 0U), XF_OK);
+    SIM_CHECK_EQ(msg, 1U);
+
+    msg = 10U;
+    SIM_CHECK_EQ(xf_osal_queue_put(mailbox, &msg, 0U, 0U), XF_OK);
+    msg = 11U;
+    SIM_CHECK_EQ(xf_osal_queue_put(mailbox, &msg, 0U, 0U), XF_OK);
+    SIM_CHECK_EQ(xf_osal_queue_get_count(mailbox), 1U);
+    msg = 0U;
+    SIM_CHECK_EQ(xf_osal_queue_peek(mailbox, &msg, 0U), XF_OK);
+    SIM_CHECK_EQ(msg, 11U);
+    SIM_CHECK_EQ(xf_osal_queue_peek(mailbox, &msg, 0U), XF_OK);
+    SIM_CHECK_EQ(xf_osal_queue_get(mailbox, &msg, NULL, 0U), XF_OK);
+    SIM_CHECK_EQ(msg, 11U);
+    SIM_CHECK_EQ(xf_osal_queue_peek(mailbox, &msg, 0U), XF_ERR_RESOURCE);
+    SIM_CHECK_EQ(xf_osal_queue_peek(mailbox, &msg, 2U), XF_ERR_TIMEOUT);
+
+    SIM_CHECK_EQ(xf_osal_queue_delete(queue), XF_OK);
+    SIM_CHECK_EQ(xf_osal_queue_delete(mailbox), XF_OK);
+}
+
+/* ==================== [Mutex] ============================================= */
+
+typedef struct _mutex_arg_t {
+    xf_osal_mutex_t     mutex;
+    volatile xf_err_t   result;
+    volatile uint32_t   done;
+} mutex_arg_t;
+
+static void mutex_try_thread(void *argument)
+{
+    mutex_arg_t *arg = (mutex_arg_t *)argument;
+
+    arg->result = xf_osal_mutex_acquire(arg->mutex, 0U);
+    if (arg->result == XF_OK) {
+        (void)xf_osal_mutex_release(arg->mutex);
+    }
+    arg->done = 1U;
+    xf_osal_thread_delete(NULL);
+}
+
+/* 递归互斥锁须释放与获取相同的次数，其他线程才能获取 */
+static void test_mutex_recursive(void)
+{
+    const xf_osal_mutex_attr_t attr = { .attr_bits = XF_OSAL_MUTEX_RECURSIVE };
+    static mutex_arg_t arg;
+
+    arg.mutex = xf_osal_mutex_create(&attr);
+    SIM_CHECK(arg.mutex != NULL);
+    if (arg.mutex == NULL) {
+        return;
+    }
+
+    SIM_CHECK_EQ(xf_osal_mutex_acquire(arg.mutex, 0U), XF_OK);
+    SIM_CHECK_EQ(xf_osal_mutex_acquire(arg.mutex, 0U), XF_OK);
+    SIM_CHECK(xf_osal_mutex_get_owner(arg.mutex) == xf_osal_thread_get_current());
+
+    SIM_CHECK_EQ(xf_osal_mutex_release(arg.mutex), XF_OK);
+    SIM_CHECK(xf_osal_mutex_get_owner(arg.mutex) == xf_osal_thread_get_current());
+    arg.done = 0U;
+    SIM_CHECK(spawn(mutex_try_thread, &arg, XF_OSAL_PRIORITY_ABOVE_NORMAL) != NULL);
+    xf_osal_delay(2U);
+    SIM_CHECK_EQ(arg.done, 1U);
+    SIM_CHECK(arg.result != XF_OK);
+
+    SIM_CHECK_EQ(xf_osal_mutex_release(arg.mutex), XF_OK);
+    SIM_CHECK(xf_osal_mutex_get_owner(arg.mutex) == NULL);
+    arg.done = 0U;
+    SIM_CHECK(spawn(mutex_try_thread, &arg, XF_OSAL_PRIORITY_ABOVE_NORMAL) != NULL);
+    xf_osal_delay(2U);
+    SIM_CHECK_EQ(arg.done, 1U);
+    SIM_CHECK_EQ(arg.result, XF_OK);
+
+    SIM_CHECK_EQ(xf_osal_mutex_delete(arg.mutex), XF_OK);
+}
+
+/* ==================== [Event] ============================================= */
+
+typedef struct _event_arg_t {
+    xf_osal_event_t     event;
+    uint32_t            delay;
+    uint32_t            flags;
+} event_arg_t;
+
+static void event_set_thread(void *argument)
+{
+    event_arg_t *arg = (event_arg_t *)argument;
+
+    xf_osal_delay(arg->delay);
+    (void)xf_osal_event_set(arg->event, arg->flags);
+    xf_osal_thread_delete(NULL);
+}
+
+/* WAIT_ALL 在全部标志到齐前不返回，返回时只清除等待的标志 */
+static void test_event_wait_all(void)
+{
+    static event_arg_t arg;
+    uint32_t t0;
+
+    arg.event = xf_osal_event_create(NULL);
+    SIM_CHECK(arg.event != NULL);
+    if (arg.event == NULL) {
+        return;
+    }
+
+    SIM_CHECK_EQ(xf_osal_event_set(arg.event, TEST_FLAG_A | TEST_FLAG_C), XF_OK);
+    SIM_CHECK_EQ(xf_osal_event_wait(arg.event, TEST_FLAG_A | TEST_FLAG_B, XF_OSAL_WAIT_ALL, 0U),
+                 XF_ERR_RESOURCE);
+    SIM_CHECK_EQ(xf_osal_event_get(arg.event), TEST_FLAG_A | TEST_FLAG_C);
+
+    arg.delay = 4U;
+    arg.flags = TEST_FLAG_B;
+    SIM_CHECK(spawn(event_set_thread, &arg, XF_OSAL_PRIORITY_ABOVE_NORMAL) != NULL);
+    t0 = xf_osal_kernel_get_tick_count();
+    SIM_CHECK_EQ(xf_osal_event_wait(arg.event, TEST_FLAG_A | TEST_FLAG_B, XF_OSAL_WAIT_ALL, 20U), XF_OK);
+    SIM_CHECK(xf_osal_kernel_get_tick_count() - t0 >= arg.delay);
+    SIM_CHECK_EQ(xf_osal_event_get(arg.event), TEST_FLAG_C);
+
+    /* NO_CLEAR 时保留标志 */
+    SIM_CHECK_EQ(xf_osal_event_wait(arg.event, TEST_FLAG_C, XF_OSAL_WAIT_ALL | XF_OSAL_NO_CLEAR, 0U), XF_OK);
+    SIM_CHECK_EQ(xf_osal_event_get(arg.event), TEST_FLAG_C);
+
+    SIM_CHECK_EQ(xf_osal_event_delete(arg.event), XF_OK);
+}
+
+/* ==================== [Timer] ============================================= */
+
+static void timer_count_cb(void *argument)
+{
+    (*(volatile uint32_t *)argument)++;
+}
+
+/* 单次定时器只触发一次；周期定时器按周期触发，停止后不再触发 */
+static void test_timer_once_periodic(void)
+{
+    static volatile uint32_t once_count;
+    static volatile uint32_t periodic_count;
+    xf_osal_timer_t once;
+    xf_osal_timer_t periodic;
+    uint32_t count;
+
+    once_count     = 0U;
+    periodic_count = 0U;
+    once     = xf_osal_timer_create(timer_count_cb, XF_OSAL_TIMER_ONCE, (void *)&once_count, NULL);
+    periodic = xf_osal_timer_create(timer_count_cb, XF_OSAL_TIMER_PERIODIC, (void *)&periodic_count, NULL);
+    SIM_CHECK((once != NULL) && (periodic != NULL));
+    if ((once == NULL) || (periodic == NULL)) {
+        return;
+    }
+
+    SIM_CHECK_EQ(xf_osal_timer_start(once, 5U), XF_OK);
+    SIM_CHECK_EQ(xf_osal_timer_start(periodic, 2U), XF_OK);
+    SIM_CHECK(xf_osal_timer_is_running(once) != 0U);
+    xf_osal_delay(3U);
+    SIM_CHECK_EQ(once_count, 0U);
+    xf_osal_delay(18U);
+    SIM_CHECK_EQ(once_count, 1U);
+    SIM_CHECK_EQ(xf_osal_timer_is_running(once), 0U);
+
+    SIM_CHECK_EQ(xf_osal_timer_stop(periodic), XF_OK);
+    count = periodic_count;
+    SIM_CHECK((count >= 9U) && (count <= 11U));
+    xf_osal_delay(6U);
+    SIM_CHECK_EQ(periodic_count, count);
+    SIM_CHECK_EQ(xf_osal_timer_is_running(periodic), 0U);
+
+    SIM_CHECK_EQ(xf_osal_timer_delete(once), XF_OK);
+    SIM_CHECK_EQ(xf_osal_timer_delete(periodic), XF_OK);
+}
+
+/* ==================== [Msgbuf] ============================================ */
+
+/* 消息按条读取；接收缓冲区太小时消息保留 */
+static void test_msgbuf_messages(void)
+{
+    xf_osal_msgbuf_t msgbuf;
+    char buf[16];
+    uint32_t space0;
+    uint32_t len;
+
+    msgbuf = xf_osal_msgbuf_create(64U, NULL);
+    SIM_CHECK(msgbuf != NULL);
+    if (msgbuf == NULL) {
+        return;
+    }
+
+    space0 = xf_osal_msgbuf_get_space(msgbuf);
+    SIM_CHECK_EQ(xf_osal_msgbuf_send(msgbuf, "abc", 3U, 0U), XF_OK);
+    SIM_CHECK_EQ(xf_osal_msgbuf_send(msgbuf, "hello", 5U, 0U), XF_OK);
+    SIM_CHECK(xf_osal_msgbuf_get_space(msgbuf) <= space0 - 8U);
+
+    SIM_CHECK_EQ(xf_osal_msgbuf_receive(msgbuf, buf, 2U, &len, 0U), XF_ERR_NO_MEM);
+    SIM_CHECK_EQ(xf_osal_msgbuf_receive(msgbuf, buf, sizeof(buf), &len, 0U), XF_OK);
+    SIM_CHECK((len == 3U) && (memcmp(buf, "abc", 3U) == 0));
+    SIM_CHECK_EQ(xf_osal_msgbuf_receive(msgbuf, buf, sizeof(buf), &len, 0U), XF_OK);
+    SIM_CHECK((len == 5U) && (memcmp(buf, "hello", 5U) == 0));
+    SIM_CHECK_EQ(xf_osal_msgbuf_receive(msgbuf, buf, sizeof(buf), &len, 0U), XF_ERR_RESOURCE);
+    SIM_CHECK_EQ(xf_osal_msgbuf_receive(msgbuf, buf, sizeof(buf), &len, 2U), XF_ERR_TIMEOUT);
+    SIM_CHECK_EQ(xf_osal_msgbuf_get_space(msgbuf), space0);
+
+    SIM_CHECK_EQ(xf_osal_msgbuf_delete(msgbuf), XF_OK);
+}
+
+/* ==================== [Streambuf] ========================================= */
+
+typedef struct _stream_arg_t {
+    xf_osal_streambuf_t streambuf;
+    uint8_t             buf[16];
+    volatile uint32_t   received;
+    volatile uint32_t   done;
+} stream_arg_t;
+
+static void stream_recv_thread(void *argument)
+{
+    stream_arg_t *arg = (stream_arg_t *)argument;
+    uint32_t received = 0U;
+
+    (void)xf_osal_streambuf_receive(arg->streambuf, arg->buf, sizeof(arg->buf), &received,
+                                    XF_OSAL_WAIT_FOREVER);
+    arg->received = received;
+    arg->done = 1U;
+    xf_osal_thread_delete(NULL);
+}
+
+/* 字节流可分段读取；阻塞的读者在达到触发水平后才被唤醒 */
+static void test_streambuf_trigger(void)
+{
+    static stream_arg_t arg;
+    uint8_t buf[32];
+    uint32_t n;
+
+    arg.streambuf = xf_osal_streambuf_create(16U, 4U, NULL);
+    SIM_CHECK(arg.streambuf != NULL);
+    if (arg.streambuf == NULL) {
+        return;
+    }
+
+    SIM_CHECK_EQ(xf_osal_streambuf_send(arg.streambuf, "abcdef", 6U, &n, 0U), XF_OK);
+    SIM_CHECK_EQ(n, 6U);
+    SIM_CHECK_EQ(xf_osal_streambuf_get_count(arg.streambuf), 6U);
+    SIM_CHECK_EQ(xf_osal_streambuf_receive(arg.streambuf, buf, 4U, &n, 0U), XF_OK);
+    SIM_CHECK((n == 4U) && (memcmp(buf, "abcd", 4U) == 0));
+    SIM_CHECK_EQ(xf_osal_streambuf_receive(arg.streambuf, buf, sizeof(buf), &n, 0U), XF_OK);
+    SIM_CHECK((n == 2U) && (memcmp(buf, "ef", 2U) == 0));
+    SIM_CHECK_EQ(xf_osal_streambuf_receive(arg.streambuf, buf, sizeof(buf), &n, 0U), XF_ERR_RESOURCE);
+
+    /* 空间不足时只写入一部分 */
+    memset(buf, 0x55, sizeof(buf));
+    SIM_CHECK_EQ(xf_osal_streambuf_send(arg.streambuf, buf, 20U, &n, 0U), XF_ERR_RESOURCE);
+    SIM_CHECK_EQ(n, 16U);
+    SIM_CHECK_EQ(xf_osal_streambuf_get_space(arg.streambuf), 0U);
+    SIM_CHECK_EQ(xf_osal_streambuf_reset(arg.streambuf), XF_OK);
+    SIM_CHECK_EQ(xf_osal_streambuf_get_count(arg.streambuf), 0U);
+
+    arg.done = 0U;
+    SIM_CHECK(spawn(stream_recv_thread, &arg, XF_OSAL_PRIORITY_ABOVE_NORMAL) != NULL);
+    xf_osal_delay(2U);
+    SIM_CHECK_EQ(xf_osal_streambuf_send(arg.streambuf, "xy", 2U, &n, 0U), XF_OK);
+    xf_osal_delay(3U);
+    SIM_CHECK_EQ(arg.done, 0U);
+    SIM_CHECK_EQ(xf_osal_streambuf_send(arg.streambuf, "zw", 2U, &n, 0U), XF_OK);
+    xf_osal_delay(3U);
+    SIM_CHECK_EQ(arg.done, 1U);
+    SIM_CHECK((arg.received == 4U) && (memcmp(arg.buf, "xyzw", 4U) == 0));
+
+    SIM_CHECK_EQ(xf_osal_streambuf_delete(arg.streambuf), XF_OK);
+}
+
+/* ==================== [Broadcast] ========================================= */
+
+/* 每个订阅者读到订阅之后的全部消息；读得太慢时丢弃最旧的并报告丢失数 */
+static void test_broadcast_subscribers(void)
+{
+    static xf_osal_broadcast_t bc;
+    static uint32_t ring[4];
+    xf_osal_broadcast_sub_t fast;
+    xf_osal_broadcast_sub_t slow;
+    uint32_t msg;
+    uint32_t lost;
+    uint32_t i;
+
+    SIM_CHECK_EQ(xf_osal_broadcast_init(&bc, ring, sizeof(uint32_t), 4U), XF_OK);
+    msg = 100U;
+    SIM_CHECK_EQ(xf_osal_broadcast_publish(&bc, &msg), XF_OK);
+    SIM_CHECK_EQ(xf_osal_broadcast_subscribe(&bc, &fast), XF_OK);
+    SIM_CHECK_EQ(xf_osal_broadcast_subscribe(&bc, &slow), XF_OK);
+    SIM_CHECK_EQ(xf_osal_broadcast_receive(&fast, &msg, &lost, 0U), XF_ERR_RESOURCE);
+
+    for (i = 1U; i <= 6U; i++) {
+        SIM_CHECK_EQ(xf_osal_broadcast_publish(&bc, &i), XF_OK);
+        SIM_CHECK_EQ(xf_osal_broadcast_receive(&fast, &msg, &lost, 0U), XF_OK);
+        SIM_CHECK_EQ(msg, i);
+        SIM_CHECK_EQ(lost, 0U);
+    }
+
+    SIM_CHECK_EQ(xf_osal_broadcast_get_pending(&slow), 4U);
+    SIM_CHECK_EQ(xf_osal_broadcast_receive(&slow, &msg, &lost, 0U), XF_OK);
+    SIM_CHECK_EQ(msg, 3U);
+    SIM_CHECK_EQ(lost, 2U);
+    for (i = 4U; i <= 6U; i++) {
+        SIM_CHECK_EQ(xf_osal_broadcast_receive(&slow, &msg, &lost, 0U), XF_OK);
+        SIM_CHECK_EQ(msg, i);
+    }
+    SIM_CHECK_EQ(xf_osal_broadcast_get_overrun(&slow), 2U);
+    SIM_CHECK_EQ(xf_osal_broadcast_get_overrun(&fast), 0U);
+    SIM_CHECK_EQ(xf_osal_broadcast_receive(&slow, &msg, &lost, 2U), XF_ERR_TIMEOUT);
+
+    SIM_CHECK_EQ(xf_osal_broadcast_deinit(&bc), XF_OK);
+}
+
+/* ==================== [Lwsem] ============================================= */
+
+typedef struct _lwsem_arg_t {
+    xf_osal_lwsem_t     lwsem;
+    volatile xf_err_t   result;
+    volatile uint32_t   done;
+} lwsem_arg_t;
+
+static void lwsem_acquire_thread(void *argument)
+{
+    lwsem_arg_t *arg = (lwsem_arg_t *)argument;
+
+    arg->result = xf_osal_lwsem_acquire(&arg->lwsem, XF_OSAL_WAIT_FOREVER);
+    arg->done = 1U;
+    xf_osal_thread_delete(NULL);
+}
+
+/* 计数不超过上限；阻塞的线程由 release 唤醒 */
+static void test_lwsem_count_wake(void)
+{
+    static lwsem_arg_t arg;
+
+    SIM_CHECK_EQ(xf_osal_lwsem_init(&arg.lwsem, 2U, 0U), XF_OK);
+    SIM_CHECK_EQ(xf_osal_lwsem_acquire(&arg.lwsem, 0U), XF_ERR_RESOURCE);
+
+    SIM_CHECK_EQ(xf_osal_lwsem_release(&arg.lwsem), XF_OK);
+    SIM_CHECK_EQ(xf_osal_lwsem_release(&arg.lwsem), XF_OK);
+    SIM_CHECK_EQ(xf_osal_lwsem_release(&arg.lwsem), XF_ERR_RESOURCE);
+    SIM_CHECK_EQ(xf_osal_lwsem_get_count(&arg.lwsem), 2U);
+    SIM_CHECK_EQ(xf_osal_lwsem_acquire(&arg.lwsem, 0U), XF_OK);
+    SIM_CHECK_EQ(xf_osal_lwsem_acquire(&arg.lwsem, 0U), XF_OK);
+
+    arg.done = 0U;
+    SIM_CHECK(spawn(lwsem_acquire_thread, &arg, XF_OSAL_PRIORITY_ABOVE_NORMAL) != NULL);
+    xf_osal_delay(3U);
+    SIM_CHECK_EQ(arg.done, 0U);
+    SIM_CHECK_EQ(xf_osal_lwsem_release(&arg.lwsem), XF_OK);
+    xf_osal_delay(2U);
+    SIM_CHECK_EQ(arg.done, 1U);
+    SIM_CHECK_EQ(arg.result, XF_OK);
+    SIM_CHECK_EQ(xf_osal_lwsem_get_count(&arg.lwsem), 0U);
+
+    SIM_CHECK_EQ(xf_osal_lwsem_deinit(&arg.lwsem), XF_OK);
+}
+
+/* ==================== [Ratelimit] ========================================= */
+
+/* 初始时桶是满的；取空后按速率补充 */
+static void test_ratelimit_basic(void)
+{
+    xf_osal_ratelimit_t rl;
+    uint32_t t0;
+
+    /* 每 tick 一个令牌 */
+    SIM_CHECK_EQ(xf_osal_ratelimit_init(&rl, xf_osal_kernel_get_tick_freq(), 4U), XF_OK);
+    SIM_CHECK_EQ(xf_osal_ratelimit_get_available(&rl), 4U);
+    SIM_CHECK_EQ(xf_osal_ratelimit_try_acquire(&rl, 4U), XF_OK);
+    SIM_CHECK_EQ(xf_osal_ratelimit_try_acquire(&rl, 1U), XF_ERR_RESOURCE);
+
+    t0 = xf_osal_kernel_get_tick_count();
+    SIM_CHECK_EQ(xf_osal_ratelimit_acquire(&rl, 2U, 10U), XF_OK);
+    SIM_CHECK(xf_osal_kernel_get_tick_count() - t0 >= 1U);
+    SIM_CHECK(xf_osal_kernel_get_tick_count() - t0 <= 3U);
+}
+
+/* ==================== [Periodic] ========================================== */
+
+static void periodic_count_cb(void *arg)
+{
+    (*(volatile uint32_t *)arg)++;
+}
+
+/* 回调按周期执行，删除后不再执行 */
+static void test_periodic_basic(void)
+{
+    static xf_osal_periodic_t periodic;
+    static volatile uint32_t count;
+    xf_osal_periodic_attr_t attr = {0};
+    xf_osal_periodic_stats_t stats;
+    uint32_t n;
+
+    attr.thread.name       = "periodic";
+    attr.thread.stack_size = SIM_STACK_SIZE;
+    attr.thread.priority   = XF_OSAL_PRIORITY_ABOVE_NORMAL;
+
+    count = 0U;
+    SIM_CHECK_EQ(xf_osal_periodic_create(&periodic, 2U, periodic_count_cb, (void *)&count, &attr), XF_OK);
+    xf_osal_delay(21U);
+    SIM_CHECK_EQ(xf_osal_periodic_get_stats(&periodic, &stats), XF_OK);
+    n = count;
+    SIM_CHECK((n >= 9U) && (n <= 11U));
+    SIM_CHECK_EQ(stats.run_count, n);
+    SIM_CHECK_EQ(stats.overrun_count, 0U);
+
+    SIM_CHECK_EQ(xf_osal_periodic_delete(&periodic), XF_OK);
+    n = count;
+    xf_osal_delay(6U);
+    SIM_CHECK_EQ(count, n);
+}
+
+/* ==================== [Sched] ============================================= */
+
+/* 截止时间短的线程得到更高优先级，响应时间按响应时间分析计算 */
+static void test_sched_basic(void)
+{
+    xf_osal_sched_task_t tasks[2] = {
+        { .name = "slow", .period = 20U, .wcet = 4U },
+        { .name = "fast", .period = 10U, .wcet = 2U },
+    };
+
+    SIM_CHECK_EQ(xf_osal_sched_analyze(tasks, 2U, XF_OSAL_PRIORITY_NORMOL, XF_OSAL_PRIORITY_REALTIME, false),
+                 XF_OK);
+    SIM_CHECK(tasks[1].priority > tasks[0].priority);
+    SIM_CHECK_EQ(tasks[1].response, 2U);
+    SIM_CHECK_EQ(tasks[0].response, 6U);
+    SIM_CHECK(tasks[0].schedulable && tasks[1].schedulable);
+}
+
+/* ==================== [TLS] =============================================== */
+
+static volatile uint32_t s_tls_destructed;
+
+static void tls_destructor(void *value)
+{
+    s_tls_destructed += (uint32_t)(uintptr_t)value;
+}
+
+static void tls_thread(void *argument)
+{
+    xf_osal_tls_key_t key = *(xf_osal_tls_key_t *)argument;
+
+    /* 新线程中的值初始为 NULL */
+    if (xf_osal_tls_get(key) == NULL) {
+        (void)xf_osal_tls_set(key, (void *)(uintptr_t)7U);
+    }
+    xf_osal_thread_delete(NULL);
+}
+
+/* 每个线程各有一份值；线程删除时对非 NULL 的值调用析构函数；释放后复用的键读不到旧值 */
+static void test_tls_destructor(void)
+{
+    static xf_osal_tls_key_t key;
+    xf_osal_tls_key_t key2;
+
+    s_tls_destructed = 0U;
+    SIM_CHECK_EQ(xf_osal_tls_alloc(&key, tls_destructor), XF_OK);
+    SIM_CHECK(xf_osal_tls_get(key) == NULL);
+    SIM_CHECK_EQ(xf_osal_tls_set(key, (void *)(uintptr_t)1U), XF_OK);
+
+    SIM_CHECK(spawn(tls_thread, &key, XF_OSAL_PRIORITY_ABOVE_NORMAL) != NULL);
+    xf_osal_delay(2U);
+    SIM_CHECK_EQ(s_tls_destructed, 7U);
+    SIM_CHECK(xf_osal_tls_get(key) == (void *)(uintptr_t)1U);
+
+    SIM_CHECK_EQ(xf_osal_tls_free(key), XF_OK);
+    SIM_CHECK_EQ(xf_osal_tls_alloc(&key2, NULL), XF_OK);
+    SIM_CHECK(xf_osal_tls_get(key2) == NULL);
+    SIM_CHECK_EQ(xf_osal_tls_free(key2), XF_OK);
+    SIM_CHECK_EQ(s_tls_destructed, 7U);
+}
+
+/* ==================== [Kernel] ============================================ */
+
+static void defer_func(void *arg1, uint32_t arg2)
+{
+    *(volatile uint32_t *)arg1 += arg2;
+}
+
+/* 提交的函数在工作线程中按顺序执行 */
+static void test_defer(void)
+{
+    static volatile uint32_t sum;
+    xf_osal_defer_stats_t stats;
+
+    sum = 0U;
+    SIM_CHECK_EQ(xf_osal_kernel_defer_init(), XF_OK);
+    SIM_CHECK_EQ(xf_osal_kernel_defer(defer_func, (void *)&sum, 3U), XF_OK);
+    SIM_CHECK_EQ(xf_osal_kernel_defer(defer_func, (void *)&sum, 4U), XF_OK);
+    SIM_CHECK_EQ(xf_osal_kernel_defer(NULL, NULL, 0U), XF_ERR_INVALID_ARG);
+    xf_osal_delay(2U);
+    SIM_CHECK_EQ(sum, 7U);
+
+    SIM_CHECK_EQ(xf_osal_kernel_get_defer_stats(&stats), XF_OK);
+    SIM_CHECK(stats.capacity > 0U);
+    SIM_CHECK_EQ(stats.overflow, 0U);
+}
+
+/* 创建对象后空闲字节减少、分配计数增加，删除后释放计数增加 */
+static void test_heap_stats(void)
+{
+    xf_osal_heap_stats_t before;
+    xf_osal_heap_stats_t mid;
+    xf_osal_heap_stats_t after;
+    xf_osal_queue_t queue;
+
+    SIM_CHECK_EQ(xf_osal_kernel_get_heap_stats(NULL), XF_ERR_INVALID_ARG);
+    SIM_CHECK_EQ(xf_osal_kernel_get_heap_stats(&before), XF_OK);
+    SIM_CHECK(before.free_size > 0U);
+    SIM_CHECK(before.min_free_size <= before.free_size);
+    SIM_CHECK(before.largest_free_block <= before.free_size);
+
+    queue = xf_osal_queue_create(16U, 64U, NULL);
+    SIM_CHECK(queue != NULL);
+    if (queue == NULL) {
+        return;
+    }
+    SIM_CHECK_EQ(xf_osal_kernel_get_heap_stats(&mid), XF_OK);
+    SIM_CHECK(mid.free_size + 16U * 64U <= before.free_size);
+    SIM_CHECK(mid.alloc_count > before.alloc_count);
+
+    SIM_CHECK_EQ(xf_osal_queue_delete(queue), XF_OK);
+    SIM_CHECK_EQ(xf_osal_kernel_get_heap_stats(&after), XF_OK);
+    SIM_CHECK(after.free_size > mid.free_size);
+    SIM_CHECK(after.free_count > mid.free_count);
+    SIM_CHECK(after.min_free_size <= mid.free_size);
+}
+
+/* ==================== [Helpers] =========================================== */
+
+static xf_osal_thread_t spawn(xf_osal_thread_func_t func, void *arg, xf_osal_priority_t priority)
+{
+    const xf_osal_thread_attr_t attr = {
+        .name       = "test",
+        .stack_size = SIM_STACK_SIZE,
+        .priority   = priority,
+    };
+
+    return xf_osal_thread_create(func, arg, &attr);
+}
+
+static void notify_clear_all(void)
+{
+    (void)xf_osal_thread_notify_clear(TEST_FLAGS_ALL);
+}
+
+static void idle_thread(void *argument)
+{
+    (void)argument;
+
+    for (;;) {
+        (void)xf_osal_thread_notify_wait(TEST_FLAG_A, XF_OSAL_WAIT_ANY, XF_OSAL_WAIT_FOREVER);
+    }
+}
+
+static void notify_thread(void *argument)
+{
+    notify_arg_t *arg = (notify_arg_t *)argument;
+
+    xf_osal_delay(arg->delay);
+    (void)xf_osal_thread_notify_set(arg->target, arg->flags);
+    xf_osal_thread_delete(NULL);
+}
+
+static void sem_acquire_n_thread(void *argument)
+{
+    sem_arg_t *arg = (sem_arg_t *)argument;
+
+    arg->result = xf_osal_semaphore_acquire_n(arg->sem, arg->n, XF_OSAL_WAIT_FOREVER);
+    arg->done = 1U;
+    xf_osal_thread_delete(NULL);
+}
+
+static void cond_wait_thread(void *argument)
+{
+    cond_arg_t *arg = (cond_arg_t *)argument;
+
+    (void)xf_osal_mutex_acquire(arg->mutex, XF_OSAL_WAIT_FOREVER);
+    arg->waiting++;
+    if (xf_osal_cond_wait(arg->cond, arg->mutex) == XF_OK) {
+        arg->woken++;
+    }
+    (void)xf_osal_mutex_release(arg->mutex);
+    xf_osal_thread_delete(NULL);
+}
@@ -0,0 +1,240 @@
+/**
+ * @file test_lwsem.c
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief 轻量信号量的慢速路径：等待超时后撤销登记，以及超时与释放同时发生时不丢失、不多出令牌。
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "sim.h"
+
+/* ==================== [Defines] =========================================== */
+
+#define TEST_ACQUIRERS          (4U)
+#define TEST_ATTEMPTS           (200U)
+#define TEST_RELEASES           (600U)
+
+/* ==================== [Typedefs] ========================================== */
+
+typedef struct _waiter_arg_t {
+    xf_osal_lwsem_t    *lwsem;
+    uint32_t            timeout;
+    volatile xf_err_t   result;
+    volatile uint32_t   done;
+} waiter_arg_t;
+
+typedef struct _acquirer_arg_t {
+    uint32_t            seed;
+    volatile uint32_t   acquired;
+    volatile uint32_t   timeouts;
+    volatile uint32_t   done;
+} acquirer_arg_t;
+
+/* ==================== [Static Prototypes] ================================= */
+
+static void test_timeout_undo(void);
+static void test_timeout_among_waiters(void);
+static void test_timeout_release_race(void);
+
+static xf_osal_thread_t spawn(xf_osal_thread_func_t func, void *arg, xf_osal_priority_t priority);
+static void waiter_thread(void *argument);
+static void acquirer_thread(void *argument);
+static void releaser_thread(void *argument);
+
+/* ==================== [Static Variables] ================================== */
+
+static xf_osal_lwsem_t s_lwsem;
+static volatile uint32_t s_released;
+static volatile uint32_t s_releaser_done;
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+int sim_main(void)
+{
+    SIM_RUN(test_timeout_undo);
+    SIM_RUN(test_timeout_among_waiters);
+    SIM_RUN(test_timeout_release_race);
+
+    return 0;
+}
+
+/* ==================== [Static Functions] ================================== */
+
+/* 超时返回后计数恢复原值，底层信号量中没有残留的唤醒 */
+static void test_timeout_undo(void)
+{
+    uint32_t t0;
+    uint32_t elapsed;
+
+    SIM_CHECK_EQ(xf_osal_lwsem_init(&s_lwsem, 4U, 0U), XF_OK);
+
+    t0 = xf_osal_kernel_get_tick_count();
+    SIM_CHECK_EQ(xf_osal_lwsem_acquire(&s_lwsem, 3U), XF_ERR_TIMEOUT);
+    elapsed = xf_osal_kernel_get_tick_count() - t0;
+    SIM_CHECK(elapsed >= 3U);
+    SIM_CHECK(elapsed <= 4U);
+
+    /* 登记已撤销：计数不为负，因此可以反初始化 */
+    SIM_CHECK_EQ(s_lwsem.count, 0);
+    SIM_CHECK_EQ(xf_osal_semaphore_acquire(s_lwsem.sema, 0U), XF_ERR_RESOURCE);
+
+    /* 之后的释放与获取走快速路径，令牌只有一个 */
+    SIM_CHECK_EQ(xf_osal_lwsem_release(&s_lwsem), XF_OK);
+    SIM_CHECK_EQ(xf_osal_lwsem_get_count(&s_lwsem), 1U);
+    SIM_CHECK_EQ(xf_osal_lwsem_acquire(&s_lwsem, 0U), XF_OK);
+    SIM_CHECK_EQ(xf_osal_lwsem_acquire(&s_lwsem, 0U), XF_ERR_RESOURCE);
+
+    SIM_CHECK_EQ(xf_osal_lwsem_deinit(&s_lwsem), XF_OK);
+}
+
+/* 多个等待者中一个超时，只撤销它自己的登记，其余等待者仍能被唤醒 */
+static void test_timeout_among_waiters(void)
+{
+    static waiter_arg_t forever;
+    static waiter_arg_t shortwait;
+
+    SIM_CHECK_EQ(xf_osal_lwsem_init(&s_lwsem, 4U, 0U), XF_OK);
+
+    forever.lwsem   = &s_lwsem;
+    forever.timeout = XF_OSAL_WAIT_FOREVER;
+    forever.done    = 0U;
+    shortwait.lwsem   = &s_lwsem;
+    shortwait.timeout = 3U;
+    shortwait.done    = 0U;
+
+    SIM_CHECK(spawn(waiter_thread, &forever, XF_OSAL_PRIORITY_ABOVE_NORMAL) != NULL);
+    SIM_CHECK(spawn(waiter_thread, &shortwait, XF_OSAL_PRIORITY_ABOVE_NORMAL) != NULL);
+    xf_osal_delay(1U);
+    SIM_CHECK_EQ(s_lwsem.count, -2);
+
+    xf_osal_delay(5U);
+    SIM_CHECK_EQ(shortwait.done, 1U);
+    SIM_CHECK_EQ(shortwait.result, XF_ERR_TIMEOUT);
+    SIM_CHECK_EQ(forever.done, 0U);
+    SIM_CHECK_EQ(s_lwsem.count, -1);
+    /* 仍有等待者时不能反初始化 */
+    SIM_CHECK_EQ(xf_osal_lwsem_deinit(&s_lwsem), XF_ERR_RESOURCE);
+
+    SIM_CHECK_EQ(xf_osal_lwsem_release(&s_lwsem), XF_OK);
+    xf_osal_delay(2U);
+    SIM_CHECK_EQ(forever.done, 1U);
+    SIM_CHECK_EQ(forever.result, XF_OK);
+    SIM_CHECK_EQ(s_lwsem.count, 0);
+    SIM_CHECK_EQ(xf_osal_semaphore_acquire(s_lwsem.sema, 0U), XF_ERR_RESOURCE);
+
+    SIM_CHECK_EQ(xf_osal_lwsem_deinit(&s_lwsem), XF_OK);
+}
+
+/*
+ * 等待时间很短的获取者与随机间隔的释放者并发，使超时与释放交错发生，
+ * 覆盖“超时后发现令牌已被交给自己、须从底层信号量取走”的分支。
+ * 结束后令牌守恒：获取成功数 + 剩余计数 = 释放数，且底层信号量中没有多余的唤醒。
+ */
+static void test_timeout_release_race(void)
+{
+    static acquirer_arg_t args[TEST_ACQUIRERS];
+    uint32_t seed = sim_get_seed();
+    uint32_t acquired = 0U;
+    uint32_t timeouts = 0U;
+    uint32_t done;
+    uint32_t i;
+
+    SIM_CHECK_EQ(xf_osal_lwsem_init(&s_lwsem, TEST_RELEASES, 0U), XF_OK);
+    s_released      = 0U;
+    s_releaser_done = 0U;
+
+    for (i = 0U; i < TEST_ACQUIRERS; i++) {
+        args[i].seed     = sim_rand(&seed);
+        args[i].acquired = 0U;
+        args[i].timeouts = 0U;
+        args[i].done     = 0U;
+        /* 一半高于释放者，一半同优先级，改变超时与释放的先后 */
+        SIM_CHECK(spawn(acquirer_thread, &args[i],
+                        ((i & 1U) != 0U) ? XF_OSAL_PRIORITY_ABOVE_NORMAL : XF_OSAL_PRIORITY_NORMOL1) != NULL);
+    }
+    SIM_CHECK(spawn(releaser_thread, &seed, XF_OSAL_PRIORITY_NORMOL1) != NULL);
+
+    do {
+        xf_osal_delay(10U);
+        done = s_releaser_done;
+        for (i = 0U; i < TEST_ACQUIRERS; i++) {
+            done += args[i].done;
+        }
+    } while (done < TEST_ACQUIRERS + 1U);
+
+    for (i = 0U; i < TEST_ACQUIRERS; i++) {
+        acquired += args[i].acquired;
+        timeouts += args[i].timeouts;
+    }
+    printf("released %u, acquired %u, timeouts %u\n",
+           (unsigned)s_released, (unsigned)acquired, (unsigned)timeouts);
+
+    SIM_CHECK_EQ(acquired + timeouts, TEST_ACQUIRERS * TEST_ATTEMPTS);
+    SIM_CHECK(timeouts > 0U);
+    SIM_CHECK(s_lwsem.count >= 0);
+    SIM_CHECK_EQ(acquired + xf_osal_lwsem_get_count(&s_lwsem), s_released);
+    SIM_CHECK_EQ(xf_osal_semaphore_acquire(s_lwsem.sema, 0U), XF_ERR_RESOURCE);
+
+    SIM_CHECK_EQ(xf_osal_lwsem_deinit(&s_lwsem), XF_OK);
+}
+
+static xf_osal_thread_t spawn(xf_osal_thread_func_t func, void *arg, xf_osal_priority_t priority)
+{
+    const xf_osal_thread_attr_t attr = {
+        .name       = "test",
+        .stack_size = SIM_STACK_SIZE,
+        .priority   = priority,
+    };
+
+    return xf_osal_thread_create(func, arg, &attr);
+}
+
+static void waiter_thread(void *argument)
+{
+    waiter_arg_t *arg = (waiter_arg_t *)argument;
+
+    arg->result = xf_osal_lwsem_acquire(arg->lwsem, arg->timeout);
+    arg->done = 1U;
+    xf_osal_thread_delete(NULL);
+}
+
+static void acquirer_thread(void *argument)
+{
+    acquirer_arg_t *arg = (acquirer_arg_t *)argument;
+    uint32_t seed = arg->seed;
+    uint32_t i;
+
+    for (i = 0U; i < TEST_ATTEMPTS; i++) {
+        if (xf_osal_lwsem_acquire(&s_lwsem, 1U + (sim_rand(&seed) % 2U)) == XF_OK) {
+            arg->acquired++;
+        } else {
+            arg->timeouts++;
+        }
+    }
+    arg->done = 1U;
+    xf_osal_thread_delete(NULL);
+}
+
+static void releaser_thread(void *argument)
+{
+    uint32_t seed = *(uint32_t *)argument;
+    uint32_t i;
+
+    for (i = 0U; i < TEST_RELEASES; i++) {
+        if (xf_osal_lwsem_release(&s_lwsem) == XF_OK) {
+            s_released++;
+        }
+        if ((sim_rand(&seed) % 4U) != 0U) {
+            xf_osal_delay(1U);
+        }
+    }
+    s_releaser_done = 1U;
+    xf_osal_thread_delete(NULL);
+}
@@ -0,0 +1,204 @@
+/**
+ * @file test_periodic.c
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief 周期线程：回调超时后追赶与跳过两种策略的执行时刻、超时次数、跳过次数与抖动直方图，以及删除的等待时间。
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "sim.h"
+
+/* ==================== [Defines] =========================================== */
+
+#define TEST_PERIOD             (4U)
+#define TEST_RUNS               (10U)
+/* 第 TEST_OVERRUN_AT 次（从 0 开始）回调耗时 TEST_OVERRUN_TICKS, 错过之后一个半周期 */
+#define TEST_OVERRUN_AT         (2U)
+#define TEST_OVERRUN_TICKS      (10U)
+#define TEST_DELETE_PERIOD      (20U)
+
+/* ==================== [Typedefs] ========================================== */
+
+typedef struct _run_log_t {
+    uint32_t            starts[TEST_RUNS];  /* 每次回调开始时的 tick */
+    volatile uint32_t   count;
+} run_log_t;
+
+/* ==================== [Static Prototypes] ================================= */
+
+static void test_overrun_catch_up(void);
+static void test_overrun_skip(void);
+static void test_delete_waits_for_wakeup(void);
+
+static void run_overrunning(xf_osal_periodic_policy_t policy, run_log_t *log, xf_osal_periodic_stats_t *stats);
+static uint32_t hist_sum(const xf_osal_periodic_stats_t *stats);
+static void overrun_cb(void *arg);
+static void noop_cb(void *arg);
+
+/* ==================== [Static Variables] ================================== */
+
+static xf_osal_periodic_t s_periodic;
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+int sim_main(void)
+{
+    SIM_RUN(test_overrun_catch_up);
+    SIM_RUN(test_overrun_skip);
+    SIM_RUN(test_delete_waits_for_wakeup);
+
+    return 0;
+}
+
+/* ==================== [Static Functions] ================================== */
+
+/*
+ * 追赶：第 2 次回调在 first + 8 开始、first + 18 结束，错过 first + 12 与 first + 16 两个截止时刻，
+ * 第 3、4 次立即连续执行（抖动 6 与 2 tick），记两次超时；第 5 次起回到原相位，没有周期丢失。
+ */
+static void test_overrun_catch_up(void)
+{
+    static run_log_t log;
+    xf_osal_periodic_stats_t stats;
+    uint32_t first;
+    uint32_t i;
+
+    run_overrunning(XF_OSAL_PERIODIC_CATCH_UP, &log, &stats);
+    first = log.starts[0];
+
+    for (i = 0U; i <= TEST_OVERRUN_AT; i++) {
+        SIM_CHECK_EQ(log.starts[i] - first, i * TEST_PERIOD);
+    }
+    SIM_CHECK_EQ(log.starts[3], log.starts[2] + TEST_OVERRUN_TICKS);
+    SIM_CHECK_EQ(log.starts[4], log.starts[3]);
+    for (i = 5U; i < TEST_RUNS; i++) {
+        SIM_CHECK_EQ(log.starts[i] - first, i * TEST_PERIOD);
+    }
+
+    SIM_CHECK_EQ(stats.overrun_count, 2U);
+    SIM_CHECK_EQ(stats.skip_count, 0U);
+    SIM_CHECK_EQ(stats.max_jitter, TEST_OVERRUN_TICKS - TEST_PERIOD);
+    /* 抖动 6 落在桶 3 [4, 8), 抖动 2 落在桶 2 [2, 4), 其余为 0 */
+    SIM_CHECK_EQ(stats.jitter_hist[3], 1U);
+    SIM_CHECK_EQ(stats.jitter_hist[2], 1U);
+    SIM_CHECK_EQ(stats.jitter_hist[0], stats.run_count - 2U);
+    SIM_CHECK_EQ(hist_sum(&stats), stats.run_count);
+}
+
+/*
+ * 跳过：第 2 次回调在 first + 18 结束，丢弃 first + 12 与 first + 16 两个截止时刻，
+ * 下一次在 first + 20 执行，只记一次超时；所有回调都在原相位上开始，抖动全为 0.
+ */
+static void test_overrun_skip(void)
+{
+    static run_log_t log;
+    xf_osal_periodic_stats_t stats;
+    uint32_t first;
+    uint32_t i;
+
+    run_overrunning(XF_OSAL_PERIODIC_SKIP, &log, &stats);
+    first = log.starts[0];
+
+    for (i = 0U; i <= TEST_OVERRUN_AT; i++) {
+        SIM_CHECK_EQ(log.starts[i] - first, i * TEST_PERIOD);
+    }
+    for (i = TEST_OVERRUN_AT + 1U; i < TEST_RUNS; i++) {
+        SIM_CHECK_EQ(log.starts[i] - first, (i + 2U) * TEST_PERIOD);
+    }
+
+    SIM_CHECK_EQ(stats.overrun_count, 1U);
+    SIM_CHECK_EQ(stats.skip_count, 2U);
+    SIM_CHECK_EQ(stats.max_jitter, 0U);
+    SIM_CHECK_EQ(stats.jitter_hist[0], stats.run_count);
+    SIM_CHECK_EQ(hist_sum(&stats), stats.run_count);
+}
+
+/* 删除不会提前唤醒阻塞中的周期线程，最多等待约一个周期 */
+static void test_delete_waits_for_wakeup(void)
+{
+    xf_osal_periodic_attr_t attr = {0};
+    xf_osal_periodic_stats_t stats;
+    uint32_t t0;
+    uint32_t elapsed;
+
+    attr.thread.name       = "periodic";
+    attr.thread.stack_size = SIM_STACK_SIZE;
+    attr.thread.priority   = XF_OSAL_PRIORITY_ABOVE_NORMAL;
+
+    xf_osal_delay(1U);
+    t0 = xf_osal_kernel_get_tick_count();
+    SIM_CHECK_EQ(xf_osal_periodic_create(&s_periodic, TEST_DELETE_PERIOD, noop_cb, NULL, &attr), XF_OK);
+    SIM_CHECK_EQ(xf_osal_periodic_delete(&s_periodic), XF_OK);
+    elapsed = xf_osal_kernel_get_tick_count() - t0;
+
+    SIM_CHECK(elapsed + 1U >= TEST_DELETE_PERIOD);
+    SIM_CHECK(elapsed <= TEST_DELETE_PERIOD + 1U);
+    /* 醒来后发现停止请求，不再执行回调 */
+    SIM_CHECK_EQ(xf_osal_periodic_get_stats(&s_periodic, &stats), XF_OK);
+    SIM_CHECK_EQ(stats.run_count, 0U);
+}
+
+/**
+ * @brief 以 policy 运行周期线程，第 TEST_OVERRUN_AT 次回调超时，记录前 TEST_RUNS 次回调后删除。
+ */
+static void run_overrunning(xf_osal_periodic_policy_t policy, run_log_t *log, xf_osal_periodic_stats_t *stats)
+{
+    xf_osal_periodic_attr_t attr = {0};
+
+    attr.thread.name       = "periodic";
+    attr.thread.stack_size = SIM_STACK_SIZE;
+    attr.thread.priority   = XF_OSAL_PRIORITY_ABOVE_NORMAL;
+    attr.policy            = policy;
+
+    log->count = 0U;
+    SIM_CHECK_EQ(xf_osal_periodic_create(&s_periodic, TEST_PERIOD, overrun_cb, log, &attr), XF_OK);
+    while (log->count < TEST_RUNS) {
+        xf_osal_delay(1U);
+    }
+    SIM_CHECK_EQ(xf_osal_periodic_delete(&s_periodic), XF_OK);
+    SIM_CHECK_EQ(xf_osal_periodic_get_stats(&s_periodic, stats), XF_OK);
+
+    printf("policy %d: runs %u, overruns %u, skipped %u, max jitter %u\n", (int)policy,
+           (unsigned)stats->run_count, (unsigned)stats->overrun_count,
+           (unsigned)stats->skip_count, (unsigned)stats->max_jitter);
+    SIM_CHECK(stats->run_count >= TEST_RUNS);
+}
+
+static uint32_t hist_sum(const xf_osal_periodic_stats_t *stats)
+{
+    uint32_t sum = 0U;
+    uint32_t i;
+
+    for (i = 0U; i < XF_OSAL_PERIODIC_JITTER_BUCKETS; i++) {
+        sum += stats->jitter_hist[i];
+    }
+
+    return sum;
+}
+
+static void overrun_cb(void *arg)
+{
+    run_log_t *log = (run_log_t *)arg;
+    uint32_t n = log->count;
+
+    if (n < TEST_RUNS) {
+        log->starts[n] = xf_osal_kernel_get_tick_count();
+    }
+    log->count = n + 1U;
+
+    if (n == TEST_OVERRUN_AT) {
+        xf_osal_delay(TEST_OVERRUN_TICKS);
+    }
+}
+
+static void noop_cb(void *arg)
+{
+    (void)arg;
+}
@@ -0,0 +1,279 @@
+/**
+ * @file test_ratelimit.c
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief 令牌桶限速器：突发、补充、超时预判、中断中获取、令牌守恒与内部计数回绕。
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "sim.h"
+
+/* ==================== [Defines] =========================================== */
+
+/* 250 Hz 滴答下每 5 个 tick 补充一个令牌 */
+#define TEST_RATE               (50U)
+#define TEST_BURST              (5U)
+#define TEST_PER_THREAD         (10U)
+#define TEST_WRAP_BURST         (10U)
+
+/* ==================== [Typedefs] ========================================== */
+
+typedef struct _isr_result_t {
+    uint32_t            acquired;
+    xf_err_t            try_err;
+    xf_err_t            nowait_err;
+    xf_err_t            wait_err;
+} isr_result_t;
+
+/* ==================== [Static Prototypes] ================================= */
+
+static void test_burst_then_resource(void);
+static void test_tokens_equal_burst(void);
+static void test_refill(void);
+static void test_timeout_precheck(void);
+static void test_try_acquire_from_isr(void);
+static void test_contended(void);
+static void test_tick_wrap(void);
+
+static uint32_t ticks_per_token(void);
+static void drain(void);
+static void isr_acquire(void *arg);
+static void acquirer_thread(void *argument);
+
+/* ==================== [Static Variables] ================================== */
+
+static xf_osal_ratelimit_t s_limit;
+static volatile uint32_t s_done;
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+int sim_main(void)
+{
+    SIM_RUN(test_burst_then_resource);
+    SIM_RUN(test_tokens_equal_burst);
+    SIM_RUN(test_refill);
+    SIM_RUN(test_timeout_precheck);
+    SIM_RUN(test_try_acquire_from_isr);
+    SIM_RUN(test_contended);
+    SIM_RUN(test_tick_wrap);
+
+    return 0;
+}
+
+/* ==================== [Static Functions] ================================== */
+
+/* 初始时桶满，连续取走 burst 个令牌后不等待的获取返回 XF_ERR_RESOURCE */
+static void test_burst_then_resource(void)
+{
+    uint32_t i;
+
+    SIM_CHECK_EQ(xf_osal_ratelimit_init(&s_limit, TEST_RATE, TEST_BURST), XF_OK);
+    SIM_CHECK_EQ(xf_osal_ratelimit_get_available(&s_limit), TEST_BURST);
+
+    for (i = 0U; i < TEST_BURST; i++) {
+        SIM_CHECK_EQ(xf_osal_ratelimit_try_acquire(&s_limit, 1U), XF_OK);
+    }
+    SIM_CHECK_EQ(xf_osal_ratelimit_try_acquire(&s_limit, 1U), XF_ERR_RESOURCE);
+    SIM_CHECK_EQ(xf_osal_ratelimit_acquire(&s_limit, 1U, 0U), XF_ERR_RESOURCE);
+    SIM_CHECK_EQ(xf_osal_ratelimit_get_available(&s_limit), 0U);
+
+    /* 参数检查 */
+    SIM_CHECK_EQ(xf_osal_ratelimit_init(&s_limit, 0U, TEST_BURST), XF_ERR_INVALID_ARG);
+    SIM_CHECK_EQ(xf_osal_ratelimit_init(&s_limit, TEST_RATE, 0U), XF_ERR_INVALID_ARG);
+    SIM_CHECK_EQ(xf_osal_ratelimit_try_acquire(NULL, 1U), XF_ERR_INVALID_ARG);
+}
+
+/* 一次取走整桶是合法的，超过 burst 则永远无法满足，直接报参数错误 */
+static void test_tokens_equal_burst(void)
+{
+    const uint32_t tpt = ticks_per_token();
+    uint32_t t0;
+    uint32_t elapsed;
+
+    SIM_CHECK_EQ(xf_osal_ratelimit_init(&s_limit, TEST_RATE, TEST_BURST), XF_OK);
+
+    SIM_CHECK_EQ(xf_osal_ratelimit_acquire(&s_limit, TEST_BURST, 0U), XF_OK);
+    SIM_CHECK_EQ(xf_osal_ratelimit_acquire(&s_limit, TEST_BURST, 0U), XF_ERR_RESOURCE);
+    SIM_CHECK_EQ(xf_osal_ratelimit_try_acquire(&s_limit, TEST_BURST + 1U), XF_ERR_INVALID_ARG);
+    SIM_CHECK_EQ(xf_osal_ratelimit_acquire(&s_limit, TEST_BURST + 1U, XF_OSAL_WAIT_FOREVER), XF_ERR_INVALID_ARG);
+
+    /* 桶空后再取整桶，需要等待整个桶补满 */
+    t0 = xf_osal_kernel_get_tick_count();
+    SIM_CHECK_EQ(xf_osal_ratelimit_acquire(&s_limit, TEST_BURST, XF_OSAL_WAIT_FOREVER), XF_OK);
+    elapsed = xf_osal_kernel_get_tick_count() - t0;
+    SIM_CHECK(elapsed + 1U >= TEST_BURST * tpt);
+    SIM_CHECK(elapsed <= TEST_BURST * tpt + 1U);
+    SIM_CHECK_EQ(xf_osal_ratelimit_get_available(&s_limit), 0U);
+}
+
+/* 每经过一个令牌的时间补充一个，补满后不再增加 */
+static void test_refill(void)
+{
+    const uint32_t tpt = ticks_per_token();
+
+    SIM_CHECK_EQ(xf_osal_ratelimit_init(&s_limit, TEST_RATE, TEST_BURST), XF_OK);
+    drain();
+
+    SIM_CHECK_EQ(xf_osal_delay(tpt), XF_OK);
+    SIM_CHECK_EQ(xf_osal_ratelimit_get_available(&s_limit), 1U);
+    SIM_CHECK_EQ(xf_osal_ratelimit_try_acquire(&s_limit, 1U), XF_OK);
+    SIM_CHECK_EQ(xf_osal_ratelimit_try_acquire(&s_limit, 1U), XF_ERR_RESOURCE);
+
+    SIM_CHECK_EQ(xf_osal_delay(2U * tpt), XF_OK);
+    SIM_CHECK_EQ(xf_osal_ratelimit_get_available(&s_limit), 2U);
+
+    /* 空闲远超补满所需的时间 */
+    SIM_CHECK_EQ(xf_osal_delay(10U * TEST_BURST * tpt), XF_OK);
+    SIM_CHECK_EQ(xf_osal_ratelimit_get_available(&s_limit), TEST_BURST);
+}
+
+/* 超时前肯定积攒不够时立即返回 XF_ERR_TIMEOUT, 不空等；够时恰好休眠到令牌积攒够 */
+static void test_timeout_precheck(void)
+{
+    const uint32_t tpt = ticks_per_token();
+    uint32_t t0;
+    uint32_t elapsed;
+
+    SIM_CHECK_EQ(xf_osal_ratelimit_init(&s_limit, TEST_RATE, TEST_BURST), XF_OK);
+    drain();
+
+    t0 = xf_osal_kernel_get_tick_count();
+    SIM_CHECK_EQ(xf_osal_ratelimit_acquire(&s_limit, 1U, tpt - 2U), XF_ERR_TIMEOUT);
+    SIM_CHECK_EQ(xf_osal_ratelimit_acquire(&s_limit, 3U, 3U * tpt - 2U), XF_ERR_TIMEOUT);
+    SIM_CHECK_EQ(xf_osal_kernel_get_tick_count() - t0, 0U);
+
+    SIM_CHECK_EQ(xf_osal_ratelimit_acquire(&s_limit, 1U, tpt + 1U), XF_OK);
+    elapsed = xf_osal_kernel_get_tick_count() - t0;
+    SIM_CHECK(elapsed + 1U >= tpt);
+    SIM_CHECK(elapsed <= tpt);
+}
+
+/* try_acquire 与不等待的 acquire 可在中断中调用，需要等待的 acquire 返回 XF_ERR_ISR */
+static void test_try_acquire_from_isr(void)
+{
+    isr_result_t result = { 0 };
+
+    SIM_CHECK_EQ(xf_osal_ratelimit_init(&s_limit, TEST_RATE, TEST_BURST), XF_OK);
+
+    sim_run_from_isr(isr_acquire, &result);
+
+    SIM_CHECK_EQ(result.acquired, TEST_BURST);
+    SIM_CHECK_EQ(result.try_err, XF_ERR_RESOURCE);
+    SIM_CHECK_EQ(result.nowait_err, XF_ERR_RESOURCE);
+    SIM_CHECK_EQ(result.wait_err, XF_ERR_ISR);
+    SIM_CHECK_EQ(xf_osal_ratelimit_get_available(&s_limit), 0U);
+}
+
+/*
+ * 两个线程一直等待获取，醒来后令牌可能已被对方取走，需重新计算并继续等待。
+ * 令牌守恒：除初始的整桶外，其余令牌按速率补充，总耗时由令牌数决定。
+ */
+static void test_contended(void)
+{
+    const xf_osal_thread_attr_t attr = {
+        .name       = "test",
+        .stack_size = SIM_STACK_SIZE,
+        .priority   = XF_OSAL_PRIORITY_ABOVE_NORMAL,
+    };
+    const uint32_t tpt = ticks_per_token();
+    const uint32_t refilled = 2U * TEST_PER_THREAD - TEST_BURST;
+    uint32_t t0;
+    uint32_t elapsed;
+
+    SIM_CHECK_EQ(xf_osal_ratelimit_init(&s_limit, TEST_RATE, TEST_BURST), XF_OK);
+    s_done = 0U;
+
+    t0 = xf_osal_kernel_get_tick_count();
+    SIM_CHECK(xf_osal_thread_create(acquirer_thread, NULL, &attr) != NULL);
+    SIM_CHECK(xf_osal_thread_create(acquirer_thread, NULL, &attr) != NULL);
+    while (s_done < 2U) {
+        xf_osal_delay(1U);
+    }
+    elapsed = xf_osal_kernel_get_tick_count() - t0;
+
+    SIM_CHECK(elapsed + 1U >= refilled * tpt);
+    SIM_CHECK(elapsed <= refilled * tpt + 2U);
+    SIM_CHECK_EQ(xf_osal_ratelimit_get_available(&s_limit), 0U);
+}
+
+/*
+ * 内部单位为 tick 数乘以 tick_units, 按 uint32_t 回绕。选取速率使回绕恰好发生在几个 tick 之后：
+ * 回绕前取空整桶，回绕后理论时刻落后于当前时刻（差值按无符号数远大于 tolerance），应视为桶满。
+ */
+static void test_tick_wrap(void)
+{
+    uint32_t tick = xf_osal_kernel_get_tick_count();
+    uint32_t target = tick + 8U;
+    uint32_t rate = (UINT32_MAX / target) + 1U;
+    uint32_t i;
+
+    /* 与滴答频率互质，tick_units 就是 rate 本身 */
+    while (((rate % 2U) == 0U) || ((rate % 5U) == 0U)) {
+        rate++;
+    }
+    SIM_CHECK_EQ(xf_osal_kernel_get_tick_freq(), 250U);
+    SIM_CHECK((target - 1U) * rate > target * rate);
+
+    SIM_CHECK_EQ(xf_osal_ratelimit_init(&s_limit, rate, TEST_WRAP_BURST), XF_OK);
+    SIM_CHECK_EQ(s_limit.tick_units, rate);
+
+    /* 回绕前的最后一个 tick 取空整桶 */
+    SIM_CHECK_EQ(xf_osal_delay_until(target - 1U), XF_OK);
+    SIM_CHECK_EQ(xf_osal_kernel_get_tick_count(), target - 1U);
+    SIM_CHECK_EQ(xf_osal_ratelimit_try_acquire(&s_limit, TEST_WRAP_BURST), XF_OK);
+    SIM_CHECK_EQ(xf_osal_ratelimit_try_acquire(&s_limit, 1U), XF_ERR_RESOURCE);
+
+    /* 回绕后：一个 tick 补充的令牌远多于 burst, 桶满且只能取 burst 个 */
+    SIM_CHECK_EQ(xf_osal_delay_until(target), XF_OK);
+    SIM_CHECK_EQ(xf_osal_kernel_get_tick_count(), target);
+    SIM_CHECK_EQ(xf_osal_ratelimit_get_available(&s_limit), TEST_WRAP_BURST);
+    for (i = 0U; i < TEST_WRAP_BURST; i++) {
+        SIM_CHECK_EQ(xf_osal_ratelimit_try_acquire(&s_limit, 1U), XF_OK);
+    }
+    SIM_CHECK_EQ(xf_osal_ratelimit_try_acquire(&s_limit, 1U), XF_ERR_RESOURCE);
+    SIM_CHECK_EQ(xf_osal_ratelimit_acquire(&s_limit, 1U, 1U), XF_OK);
+}
+
+static uint32_t ticks_per_token(void)
+{
+    return xf_osal_kernel_get_tick_freq() / TEST_RATE;
+}
+
+/* 对齐到 tick 开始后取空整桶，使后续的时间判断不受当前 tick 已过去部分的影响 */
+static void drain(void)
+{
+    xf_osal_delay(1U);
+    SIM_CHECK_EQ(xf_osal_ratelimit_try_acquire(&s_limit, TEST_BURST), XF_OK);
+    SIM_CHECK_EQ(xf_osal_ratelimit_get_available(&s_limit), 0U);
+}
+
+static void isr_acquire(void *arg)
+{
+    isr_result_t *result = (isr_result_t *)arg;
+
+    while ((result->try_err = xf_osal_ratelimit_try_acquire(&s_limit, 1U)) == XF_OK) {
+        result->acquired++;
+    }
+    result->nowait_err = xf_osal_ratelimit_acquire(&s_limit, 1U, 0U);
+    result->wait_err = xf_osal_ratelimit_acquire(&s_limit, 1U, XF_OSAL_WAIT_FOREVER);
+}
+
+static void acquirer_thread(void *argument)
+{
+    uint32_t i;
+
+    (void)argument;
+
+    for (i = 0U; i < TEST_PER_THREAD; i++) {
+        SIM_CHECK_EQ(xf_osal_ratelimit_acquire(&s_limit, 1U, XF_OSAL_WAIT_FOREVER), XF_OK);
+    }
+    s_done++;
+    xf_osal_thread_delete(NULL);
+}
@@ -0,0 +1,197 @@
+/**
+ * @file test_sched.c
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief 可调度性分析：已知可调度与不可调度的线程组、截止时间单调的优先级分配，以及共用 RTOS 优先级时的干扰。
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "sim.h"
+
+/* ==================== [Defines] =========================================== */
+
+#define TEST_ARRAY_SIZE(a)      (sizeof(a) / sizeof((a)[0]))
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Static Prototypes] ================================= */
+
+static void test_schedulable_set(void);
+static void test_unschedulable_set(void);
+static void test_deadline_monotonic(void);
+static void test_shared_native_level(void);
+static void test_distinct_native_levels(void);
+
+static xf_osal_priority_t find_shared_level(void);
+
+/* ==================== [Static Variables] ================================== */
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+int sim_main(void)
+{
+    SIM_RUN(test_schedulable_set);
+    SIM_RUN(test_unschedulable_set);
+    SIM_RUN(test_deadline_monotonic);
+    SIM_RUN(test_shared_native_level);
+    SIM_RUN(test_distinct_native_levels);
+
+    return 0;
+}
+
+/* ==================== [Static Functions] ================================== */
+
+/*
+ * 利用率 0.9, 超过 Liu-Layland 界（3 个线程约 0.78），但响应时间分析可以证明可调度：
+ * R1 = 1; R2 = 2 + 1 = 3; R3: 5 -> 9 -> 12 -> 14 -> 15 -> 15.
+ */
+static void test_schedulable_set(void)
+{
+    xf_osal_sched_task_t tasks[] = {
+        { .name = "c", .period = 20U, .wcet = 5U },
+        { .name = "a", .period = 4U,  .wcet = 1U },
+        { .name = "b", .period = 5U,  .wcet = 2U },
+    };
+
+    SIM_CHECK_EQ(xf_osal_sched_analyze(tasks, TEST_ARRAY_SIZE(tasks),
+                                       XF_OSAL_PRIORITY_NORMOL, XF_OSAL_PRIORITY_REALTIME, false), XF_OK);
+
+    /* 速率单调：周期越短优先级越高，与数组顺序无关 */
+    SIM_CHECK(tasks[1].priority > tasks[2].priority);
+    SIM_CHECK(tasks[2].priority > tasks[0].priority);
+
+    SIM_CHECK_EQ(tasks[1].response, 1U);
+    SIM_CHECK_EQ(tasks[2].response, 3U);
+    SIM_CHECK_EQ(tasks[0].response, 15U);
+    SIM_CHECK(tasks[0].schedulable && tasks[1].schedulable && tasks[2].schedulable);
+
+    xf_osal_sched_report(tasks, TEST_ARRAY_SIZE(tasks), printf);
+}
+
+/*
+ * 利用率约 1.08: 高优先级的两个线程可调度，最低的一个
+ * R3: 3 -> 7 -> 11 -> 13 > 12, 超过截止时间后停止迭代。
+ */
+static void test_unschedulable_set(void)
+{
+    xf_osal_sched_task_t tasks[] = {
+        { .name = "a", .period = 4U,  .wcet = 2U },
+        { .name = "b", .period = 6U,  .wcet = 2U },
+        { .name = "c", .period = 12U, .wcet = 3U },
+    };
+
+    SIM_CHECK_EQ(xf_osal_sched_analyze(tasks, TEST_ARRAY_SIZE(tasks),
+                                       XF_OSAL_PRIORITY_NORMOL, XF_OSAL_PRIORITY_REALTIME, false), XF_FAIL);
+
+    SIM_CHECK_EQ(tasks[0].response, 2U);
+    SIM_CHECK_EQ(tasks[1].response, 4U);
+    SIM_CHECK_EQ(tasks[2].response, 13U);
+    SIM_CHECK(tasks[0].schedulable && tasks[1].schedulable);
+    SIM_CHECK(!tasks[2].schedulable);
+
+    xf_osal_sched_report(tasks, TEST_ARRAY_SIZE(tasks), printf);
+}
+
+/* 截止时间短于周期的线程按截止时间排序，周期更长也可能得到更高优先级 */
+static void test_deadline_monotonic(void)
+{
+    xf_osal_sched_task_t tasks[] = {
+        { .name = "fast",  .period = 5U,  .wcet = 1U },
+        { .name = "tight", .period = 10U, .wcet = 2U, .deadline = 3U },
+    };
+
+    SIM_CHECK_EQ(xf_osal_sched_analyze(tasks, TEST_ARRAY_SIZE(tasks),
+                                       XF_OSAL_PRIORITY_NORMOL, XF_OSAL_PRIORITY_REALTIME, false), XF_OK);
+
+    SIM_CHECK(tasks[1].priority > tasks[0].priority);
+    SIM_CHECK_EQ(tasks[1].response, 2U);
+    SIM_CHECK_EQ(tasks[0].response, 3U);
+
+    /* 参数检查 */
+    tasks[0].period = 0U;
+    SIM_CHECK_EQ(xf_osal_sched_analyze(tasks, TEST_ARRAY_SIZE(tasks),
+                                       XF_OSAL_PRIORITY_NORMOL, XF_OSAL_PRIORITY_REALTIME, false), XF_ERR_INVALID_ARG);
+    SIM_CHECK_EQ(xf_osal_sched_analyze(tasks, 0U,
+                                       XF_OSAL_PRIORITY_NORMOL, XF_OSAL_PRIORITY_REALTIME, false), XF_ERR_INVALID_ARG);
+}
+
+/*
+ * 两个 xf_osal 优先级映射到同一 RTOS 优先级时只算一个可用优先级，两个线程共用，互相计入干扰：
+ * 若按 xf_osal 优先级视为严格有序，"a" 的响应时间为 3, 误判为可调度；
+ * 共用时 R = 3 + 4 = 7 > 6, 不可调度。
+ */
+static void test_shared_native_level(void)
+{
+    xf_osal_priority_t low = find_shared_level();
+    xf_osal_sched_task_t tasks[] = {
+        { .name = "a", .period = 6U,  .wcet = 3U },
+        { .name = "b", .period = 20U, .wcet = 4U },
+    };
+
+    SIM_CHECK(low != XF_OSAL_PRIORITY_ERROR);
+    if (low == XF_OSAL_PRIORITY_ERROR) {
+        return;
+    }
+
+    SIM_CHECK_EQ(xf_osal_sched_analyze(tasks, TEST_ARRAY_SIZE(tasks),
+                                       low, (xf_osal_priority_t)(low + 1), false), XF_FAIL);
+    SIM_CHECK_EQ(xf_osal_thread_get_effective_priority(tasks[0].priority),
+                 xf_osal_thread_get_effective_priority(tasks[1].priority));
+    SIM_CHECK_EQ(tasks[0].response, 7U);
+    SIM_CHECK(!tasks[0].schedulable);
+    /* "b" 同样计入 "a" 的干扰：4 -> 7 -> 10 -> 10 */
+    SIM_CHECK_EQ(tasks[1].response, 10U);
+    SIM_CHECK(tasks[1].schedulable);
+}
+
+/* 区间中有足够的 RTOS 优先级时，分配的优先级落在不同 RTOS 优先级上，上例可调度 */
+static void test_distinct_native_levels(void)
+{
+    xf_osal_priority_t low = find_shared_level();
+    xf_osal_sched_task_t tasks[] = {
+        { .name = "a", .period = 6U,  .wcet = 3U },
+        { .name = "b", .period = 20U, .wcet = 4U },
+    };
+
+    if (low == XF_OSAL_PRIORITY_ERROR) {
+        return;
+    }
+
+    /* low 与 low + 1 共用一个 RTOS 优先级，low + 2 映射到下一个 */
+    SIM_CHECK(xf_osal_thread_get_effective_priority((xf_osal_priority_t)(low + 2))
+              != xf_osal_thread_get_effective_priority(low));
+
+    SIM_CHECK_EQ(xf_osal_sched_analyze(tasks, TEST_ARRAY_SIZE(tasks),
+                                       low, (xf_osal_priority_t)(low + 2), false), XF_OK);
+    SIM_CHECK(xf_osal_thread_get_effective_priority(tasks[0].priority)
+              > xf_osal_thread_get_effective_priority(tasks[1].priority));
+    SIM_CHECK_EQ(tasks[0].response, 3U);
+    /* 4 -> 7 -> 10 -> 10 */
+    SIM_CHECK_EQ(tasks[1].response, 10U);
+}
+
+/**
+ * @brief 查找与下一级映射到同一 RTOS 优先级、而再下一级映射到不同 RTOS 优先级的 xf_osal 优先级。
+ */
+static xf_osal_priority_t find_shared_level(void)
+{
+    xf_osal_priority_t effective;
+    int32_t prio;
+
+    for (prio = XF_OSAL_PRIORITY_LOW; prio + 2 < XF_OSAL_PRIORITY_ISR; prio++) {
+        effective = xf_osal_thread_get_effective_priority((xf_osal_priority_t)prio);
+        if ((xf_osal_thread_get_effective_priority((xf_osal_priority_t)(prio + 1)) == effective)
+                && (xf_osal_thread_get_effective_priority((xf_osal_priority_t)(prio + 2)) != effective)) {
+            return (xf_osal_priority_t)prio;
+        }
+    }
+
+    return XF_OSAL_PRIORITY_ERROR;
+}
@@ -0,0 +1,336 @@
+/**
+ * @file test_stress.c
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief 随机多线程压力测试：混合执行信号量、互斥锁、队列与事件操作，结束后检查不变量。
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * 操作序列由种子决定，失败时用打印出的种子复现：
+ *
+ *     XF_OSAL_SIM_SEED=<seed> ./xf_osal_test_stress
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "sim.h"
+
+/* ==================== [Defines] =========================================== */
+
+#define STRESS_WORKERS          (6U)
+#define STRESS_OPS              (3000U)
+#define STRESS_SEM_TOKENS       (4U)
+#define STRESS_QUEUE_LEN        (8U)
+/* 超过这个时间还没结束即视为死锁 */
+#define STRESS_DEADLINE_MS      (60U * 1000U)
+
+/* ==================== [Typedefs] ========================================== */
+
+typedef enum _stress_op_t {
+    STRESS_OP_SEMAPHORE = 0,
+    STRESS_OP_MUTEX,
+    STRESS_OP_QUEUE,
+    STRESS_OP_EVENT,
+    STRESS_OP_YIELD,
+    STRESS_OP_MAX,
+} stress_op_t;
+
+typedef struct _stress_worker_t {
+    uint32_t            id;
+    uint32_t            rng;
+    uint32_t            increments;
+    uint32_t            sent_count;
+    uint64_t            sent_sum;
+    uint32_t            ops[STRESS_OP_MAX];
+} stress_worker_t;
+
+/* ==================== [Static Prototypes] ================================= */
+
+static void test_stress_mixed(void);
+
+static void stress_worker(void *argument);
+static void stress_consumer(void *argument);
+static void stress_semaphore(stress_worker_t *w);
+static void stress_mutex(stress_worker_t *w);
+static void stress_queue(stress_worker_t *w);
+static void stress_event(stress_worker_t *w);
+
+/* ==================== [Static Variables] ================================== */
+
+static xf_osal_semaphore_t s_tokens;
+static xf_osal_semaphore_t s_done;
+static xf_osal_mutex_t s_mutex;
+static xf_osal_queue_t s_queue;
+static xf_osal_event_t s_event;
+
+/* 只在持有 s_mutex 时读写 */
+static volatile uint32_t s_counter;
+/* 同时持有的令牌数，超过 STRESS_SEM_TOKENS 说明信号量多发了令牌 */
+static volatile uint32_t s_tokens_held;
+static uint32_t s_tokens_held_max;
+
+static uint32_t s_recv_count;
+static uint64_t s_recv_sum;
+
+static stress_worker_t s_workers[STRESS_WORKERS];
+
+static const xf_osal_priority_t s_priorities[STRESS_WORKERS] = {
+    XF_OSAL_PRIORITY_LOW,
+    XF_OSAL_PRIORITY_BELOW_NORMAL,
+    XF_OSAL_PRIORITY_NORMOL,
+    XF_OSAL_PRIORITY_NORMOL,
+    XF_OSAL_PRIORITY_ABOVE_NORMAL,
+    XF_OSAL_PRIORITY_HIGH,
+};
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+int sim_main(void)
+{
+    SIM_RUN(test_stress_mixed);
+
+    return 0;
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static void test_stress_mixed(void)
+{
+    const uint32_t seed = sim_get_seed();
+    const uint32_t deadline = xf_osal_kernel_ms_to_ticks(STRESS_DEADLINE_MS);
+    xf_osal_thread_attr_t attr = {
+        .name       = "stress",
+        .stack_size = SIM_STACK_SIZE,
+        .priority   = XF_OSAL_PRIORITY_NORMOL,
+    };
+    uint32_t expected_counter = 0U;
+    uint32_t sent_count = 0U;
+    uint64_t sent_sum = 0U;
+    uint32_t sentinel = 0U;
+    uint32_t start;
+    uint32_t elapsed;
+    uint32_t i;
+
+    printf("seed %u (XF_OSAL_SIM_SEED=%u to reproduce)\n", (unsigned)seed, (unsigned)seed);
+
+    s_tokens = xf_osal_semaphore_create(STRESS_SEM_TOKENS, STRESS_SEM_TOKENS, NULL);
+    s_done   = xf_osal_semaphore_create(STRESS_WORKERS + 1U, 0U, NULL);
+    s_mutex  = xf_osal_mutex_create(NULL);
+    s_queue  = xf_osal_queue_create(STRESS_QUEUE_LEN, sizeof(uint32_t), NULL);
+    s_event  = xf_osal_event_create(NULL);
+    SIM_CHECK((s_tokens != NULL) && (s_done != NULL) && (s_mutex != NULL) && (s_queue != NULL) && (s_event != NULL));
+    if ((s_tokens == NULL) || (s_done == NULL) || (s_mutex == NULL) || (s_queue == NULL) || (s_event == NULL)) {
+        return;
+    }
+
+    attr.name = "consumer";
+    SIM_CHECK(xf_osal_thread_create(stress_consumer, NULL, &attr) != NULL);
+
+    for (i = 0U; i < STRESS_WORKERS; i++) {
+        s_workers[i].id  = i;
+        s_workers[i].rng = seed ^ ((i + 1U) * 0x9E3779B9U);
+        if (s_workers[i].rng == 0U) {
+            s_workers[i].rng = 1U;
+        }
+        attr.name     = "worker";
+        attr.priority = s_priorities[i];
+        SIM_CHECK(xf_osal_thread_create(stress_worker, &s_workers[i], &attr) != NULL);
+    }
+
+    /* 所有工作线程按时结束，否则视为死锁 */
+    start = xf_osal_kernel_get_tick_count();
+    for (i = 0U; i < STRESS_WORKERS; i++) {
+        elapsed = xf_osal_kernel_get_tick_count() - start;
+        if (xf_osal_semaphore_acquire(s_done, (elapsed < deadline) ? (deadline - elapsed) : 0U) != XF_OK) {
+            SIM_CHECK(!"worker deadlocked");
+            return;
+        }
+    }
+
+    SIM_CHECK_EQ(xf_osal_queue_put(s_queue, &sentinel, 0U, XF_OSAL_WAIT_FOREVER), XF_OK);
+    SIM_CHECK_EQ(xf_osal_semaphore_acquire(s_done, deadline), XF_OK);
+
+    for (i = 0U; i < STRESS_WORKERS; i++) {
+        expected_counter += s_workers[i].increments;
+        sent_count += s_workers[i].sent_count;
+        sent_sum += s_workers[i].sent_sum;
+        printf("worker %u: sem %u mutex %u queue %u event %u yield %u\n", (unsigned)i,
+               (unsigned)s_workers[i].ops[STRESS_OP_SEMAPHORE], (unsigned)s_workers[i].ops[STRESS_OP_MUTEX],
+               (unsigned)s_workers[i].ops[STRESS_OP_QUEUE], (unsigned)s_workers[i].ops[STRESS_OP_EVENT],
+               (unsigned)s_workers[i].ops[STRESS_OP_YIELD]);
+    }
+
+    /* 令牌守恒 */
+    SIM_CHECK_EQ(xf_osal_semaphore_get_count(s_tokens), STRESS_SEM_TOKENS);
+    SIM_CHECK_EQ(s_tokens_held, 0U);
+    SIM_CHECK(s_tokens_held_max <= STRESS_SEM_TOKENS);
+
+    /* 互斥：没有丢失的自增 */
+    SIM_CHECK_EQ(s_counter, expected_counter);
+    SIM_CHECK(xf_osal_mutex_get_owner(s_mutex) == NULL);
+
+    /* 消息不丢失、不重复 */
+    SIM_CHECK_EQ(s_recv_count, sent_count);
+    SIM_CHECK_EQ(s_recv_sum, sent_sum);
+    SIM_CHECK_EQ(xf_osal_queue_get_count(s_queue), 0U);
+
+    /* 每个线程只等待并清除自己的位 */
+    SIM_CHECK_EQ(xf_osal_event_get(s_event), 0U);
+
+    SIM_CHECK_EQ(xf_osal_event_delete(s_event), XF_OK);
+    SIM_CHECK_EQ(xf_osal_queue_delete(s_queue), XF_OK);
+    SIM_CHECK_EQ(xf_osal_mutex_delete(s_mutex), XF_OK);
+    SIM_CHECK_EQ(xf_osal_semaphore_delete(s_done), XF_OK);
+    SIM_CHECK_EQ(xf_osal_semaphore_delete(s_tokens), XF_OK);
+}
+
+static void stress_worker(void *argument)
+{
+    stress_worker_t *w = (stress_worker_t *)argument;
+    uint32_t op;
+    uint32_t i;
+
+    for (i = 0U; i < STRESS_OPS; i++) {
+        op = sim_rand(&w->rng) % (uint32_t)STRESS_OP_MAX;
+        w->ops[op]++;
+
+        switch (op) {
+        case STRESS_OP_SEMAPHORE:
+            stress_semaphore(w);
+            break;
+        case STRESS_OP_MUTEX:
+            stress_mutex(w);
+            break;
+        case STRESS_OP_QUEUE:
+            stress_queue(w);
+            break;
+        case STRESS_OP_EVENT:
+            stress_event(w);
+            break;
+        default:
+            if ((sim_rand(&w->rng) & 1U) != 0U) {
+                (void)xf_osal_thread_yield();
+            } else {
+                (void)xf_osal_delay(1U);
+            }
+            break;
+        }
+    }
+
+    (void)xf_osal_semaphore_release(s_done);
+    (void)xf_osal_thread_delete(NULL);
+}
+
+static void stress_consumer(void *argument)
+{
+    uint32_t msg;
+
+    (void)argument;
+
+    for (;;) {
+        if (xf_osal_queue_get(s_queue, &msg, NULL, XF_OSAL_WAIT_FOREVER) != XF_OK) {
+            continue;
+        }
+        /* 工作线程发送的消息都是奇数，0 表示结束 */
+        if (msg == 0U) {
+            break;
+        }
+        s_recv_count++;
+        s_recv_sum += msg;
+    }
+
+    (void)xf_osal_semaphore_release(s_done);
+    (void)xf_osal_thread_delete(NULL);
+}
+
+/* 随机取 1..3 个令牌，持有一会儿再还回去 */
+static void stress_semaphore(stress_worker_t *w)
+{
+    uint32_t n = (sim_rand(&w->rng) % 3U) + 1U;
+    uint32_t timeout = sim_rand(&w->rng) % 4U;
+    uint32_t held;
+    xf_err_t err;
+
+    if (n == 1U) {
+        err = xf_osal_semaphore_acquire(s_tokens, timeout);
+    } else {
+        err = xf_osal_semaphore_acquire_n(s_tokens, n, timeout);
+    }
+    if (err != XF_OK) {
+        SIM_CHECK((err == XF_ERR_TIMEOUT) || (err == XF_ERR_RESOURCE));
+        return;
+    }
+
+    xf_osal_mutex_acquire(s_mutex, XF_OSAL_WAIT_FOREVER);
+    s_tokens_held += n;
+    held = s_tokens_held;
+    if (held > s_tokens_held_max) {
+        s_tokens_held_max = held;
+    }
+    xf_osal_mutex_release(s_mutex);
+
+    if ((sim_rand(&w->rng) & 1U) != 0U) {
+        (void)xf_osal_thread_yield();
+    }
+
+    xf_osal_mutex_acquire(s_mutex, XF_OSAL_WAIT_FOREVER);
+    s_tokens_held -= n;
+    xf_osal_mutex_release(s_mutex);
+
+    if (n == 1U) {
+        SIM_CHECK_EQ(xf_osal_semaphore_release(s_tokens), XF_OK);
+    } else {
+        SIM_CHECK_EQ(xf_osal_semaphore_release_n(s_tokens, n), XF_OK);
+    }
+}
+
+/* 读-让出-写，没有互斥时必然丢失自增 */
+static void stress_mutex(stress_worker_t *w)
+{
+    uint32_t value;
+
+    if (xf_osal_mutex_acquire(s_mutex, sim_rand(&w->rng) % 4U) != XF_OK) {
+        return;
+    }
+
+    SIM_CHECK(xf_osal_mutex_get_owner(s_mutex) == xf_osal_thread_get_current());
+    value = s_counter;
+    if ((sim_rand(&w->rng) & 3U) == 0U) {
+        (void)xf_osal_thread_yield();
+    }
+    s_counter = value + 1U;
+    w->increments++;
+
+    SIM_CHECK_EQ(xf_osal_mutex_release(s_mutex), XF_OK);
+}
+
+static void stress_queue(stress_worker_t *w)
+{
+    uint32_t msg = sim_rand(&w->rng) | 1U;
+    xf_err_t err;
+
+    err = xf_osal_queue_put(s_queue, &msg, 0U, sim_rand(&w->rng) % 4U);
+    if (err != XF_OK) {
+        SIM_CHECK((err == XF_ERR_TIMEOUT) || (err == XF_ERR_RESOURCE));
+        return;
+    }
+
+    w->sent_count++;
+    w->sent_sum += msg;
+}
+
+/* 置位自己的标志后立即能等到，并且不影响其他线程的位 */
+static void stress_event(stress_worker_t *w)
+{
+    const uint32_t flag = 1UL << w->id;
+
+    SIM_CHECK_EQ(xf_osal_event_set(s_event, flag), XF_OK);
+    if ((sim_rand(&w->rng) & 1U) != 0U) {
+        (void)xf_osal_thread_yield();
+    }
+    SIM_CHECK_EQ(xf_osal_event_wait(s_event, flag, XF_OSAL_WAIT_ANY, 0U), XF_OK);
+    SIM_CHECK_EQ(xf_osal_event_wait(s_event, flag, XF_OSAL_WAIT_ANY, 0U), XF_ERR_RESOURCE);
+}
@@ -0,0 +1,175 @@
+/**
+ * @file test_tickless.c
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief FreeRTOS 对接层的无滴答睡眠：睡眠钩子、下一次唤醒时刻与省去的滴答中断数。
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "sim.h"
+
+/* ==================== [Defines] =========================================== */
+
+#define TEST_IDLE_TICKS         (100U)
+/* 空闲期间至少这个比例（%）的滴答中断应被省去 */
+#define TEST_AVOIDED_PERCENT    (80U)
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Static Prototypes] ================================= */
+
+static void test_next_wakeup_outside_sleep(void);
+static void test_pre_sleep_next_wakeup(void);
+static void test_avoided_ticks(void);
+static void test_pre_sleep_veto(void);
+
+static void hook_pre_sleep(uint32_t *expected_ticks);
+static void hook_post_sleep(uint32_t expected_ticks);
+static void hook_pre_sleep_veto(uint32_t *expected_ticks);
+
+/* ==================== [Static Variables] ================================== */
+
+static volatile uint32_t s_pre_count;
+static volatile uint32_t s_post_count;
+static volatile uint32_t s_first_expected;
+static volatile uint32_t s_first_next_wakeup;
+static volatile uint32_t s_post_next_wakeup;
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+int sim_main(void)
+{
+    SIM_RUN(test_next_wakeup_outside_sleep);
+    SIM_RUN(test_pre_sleep_next_wakeup);
+    SIM_RUN(test_avoided_ticks);
+    SIM_RUN(test_pre_sleep_veto);
+
+    return 0;
+}
+
+/* ==================== [Static Functions] ================================== */
+
+/* 睡眠窗口之外没有有效的唤醒时刻 */
+static void test_next_wakeup_outside_sleep(void)
+{
+    SIM_CHECK_EQ(xf_osal_kernel_get_next_wakeup(), XF_OSAL_WAIT_FOREVER);
+
+    /* 经过一次睡眠后仍然无效 */
+    SIM_CHECK_EQ(xf_osal_delay(10U), XF_OK);
+    SIM_CHECK_EQ(xf_osal_kernel_get_next_wakeup(), XF_OSAL_WAIT_FOREVER);
+}
+
+/* 睡眠钩子中读到的下一次唤醒时刻与本次预计睡眠的滴答数一致 */
+static void test_pre_sleep_next_wakeup(void)
+{
+    const xf_osal_sleep_hooks_t hooks = {
+        .pre_sleep  = hook_pre_sleep,
+        .post_sleep = hook_post_sleep,
+    };
+
+    s_pre_count  = 0U;
+    s_post_count = 0U;
+    SIM_CHECK_EQ(xf_osal_kernel_set_sleep_hooks(&hooks), XF_OK);
+
+    SIM_CHECK_EQ(xf_osal_delay(40U), XF_OK);
+
+    SIM_CHECK_EQ(xf_osal_kernel_set_sleep_hooks(NULL), XF_OK);
+
+    SIM_CHECK(s_pre_count >= 1U);
+    SIM_CHECK_EQ(s_post_count, s_pre_count);
+    SIM_CHECK_EQ(s_first_next_wakeup, s_first_expected);
+    SIM_CHECK(s_first_expected >= 30U);
+    SIM_CHECK(s_first_expected <= 40U);
+    /* post_sleep 中唤醒时刻仍然有效，且已经到达或接近 */
+    SIM_CHECK(s_post_next_wakeup != XF_OSAL_WAIT_FOREVER);
+    SIM_CHECK_EQ(xf_osal_kernel_get_next_wakeup(), XF_OSAL_WAIT_FOREVER);
+}
+
+/* 空闲期间绝大部分滴答中断被省去，并且只需很少几次睡眠 */
+static void test_avoided_ticks(void)
+{
+    uint32_t sleeps0;
+    uint32_t avoided0;
+    uint32_t sleeps;
+    uint32_t avoided;
+    uint32_t t0;
+    uint32_t elapsed;
+
+    sim_get_sleep_stats(&sleeps0, &avoided0);
+    t0 = xf_osal_kernel_get_tick_count();
+
+    SIM_CHECK_EQ(xf_osal_delay(TEST_IDLE_TICKS), XF_OK);
+
+    elapsed = xf_osal_kernel_get_tick_count() - t0;
+    sim_get_sleep_stats(&sleeps, &avoided);
+    sleeps  -= sleeps0;
+    avoided -= avoided0;
+
+    printf("idle %u ticks: %u sleeps, %u tick interrupts avoided\n",
+           (unsigned)elapsed, (unsigned)sleeps, (unsigned)avoided);
+
+    SIM_CHECK(elapsed >= TEST_IDLE_TICKS);
+    SIM_CHECK(elapsed <= TEST_IDLE_TICKS + 2U);
+    SIM_CHECK(sleeps >= 1U);
+    SIM_CHECK(sleeps <= 10U);
+    SIM_CHECK(avoided * 100U >= TEST_IDLE_TICKS * TEST_AVOIDED_PERCENT);
+    SIM_CHECK(avoided < elapsed);
+}
+
+/* pre_sleep 把滴答数置 0 时取消睡眠，不省去任何滴答中断 */
+static void test_pre_sleep_veto(void)
+{
+    const xf_osal_sleep_hooks_t hooks = {
+        .pre_sleep  = hook_pre_sleep_veto,
+        .post_sleep = hook_post_sleep,
+    };
+    uint32_t sleeps0;
+    uint32_t avoided0;
+    uint32_t sleeps;
+    uint32_t avoided;
+
+    s_pre_count  = 0U;
+    s_post_count = 0U;
+    SIM_CHECK_EQ(xf_osal_kernel_set_sleep_hooks(&hooks), XF_OK);
+
+    sim_get_sleep_stats(&sleeps0, &avoided0);
+    SIM_CHECK_EQ(xf_osal_delay(20U), XF_OK);
+    sim_get_sleep_stats(&sleeps, &avoided);
+
+    SIM_CHECK_EQ(xf_osal_kernel_set_sleep_hooks(NULL), XF_OK);
+
+    SIM_CHECK(s_pre_count >= 1U);
+    SIM_CHECK_EQ(s_post_count, s_pre_count);
+    SIM_CHECK_EQ(sleeps, sleeps0);
+    SIM_CHECK_EQ(avoided, avoided0);
+}
+
+static void hook_pre_sleep(uint32_t *expected_ticks)
+{
+    if (s_pre_count == 0U) {
+        s_first_expected    = *expected_ticks;
+        s_first_next_wakeup = xf_osal_kernel_get_next_wakeup();
+    }
+    s_pre_count++;
+}
+
+static void hook_post_sleep(uint32_t expected_ticks)
+{
+    (void)expected_ticks;
+
+    s_post_next_wakeup = xf_osal_kernel_get_next_wakeup();
+    s_post_count++;
+}
+
+static void hook_pre_sleep_veto(uint32_t *expected_ticks)
+{
+    *expected_ticks = 0U;
+    s_pre_count++;
+}
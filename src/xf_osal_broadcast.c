@@ -0,0 +1,251 @@
+/**
+ * @file xf_osal_broadcast.c
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include <string.h>
+
+#include "xf_osal.h"
+
+#if XF_OSAL_BROADCAST_IS_ENABLE
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Static Prototypes] ================================= */
+
+static uint32_t broadcast_catch_up(xf_osal_broadcast_sub_t *sub);
+static uint32_t broadcast_slot(const xf_osal_broadcast_sub_t *sub);
+
+/* ==================== [Static Variables] ================================== */
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+xf_err_t xf_osal_broadcast_init(xf_osal_broadcast_t *bc, void *buf, uint32_t msg_size, uint32_t msg_count)
+{
+    if ((bc == NULL) || (buf == NULL) || (msg_size == 0U) || (msg_count == 0U)) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    bc->mutex = xf_osal_mutex_create(NULL);
+    if (bc->mutex == NULL) {
+        return XF_ERR_NO_MEM;
+    }
+
+    bc->cond = xf_osal_cond_create(NULL);
+    if (bc->cond == NULL) {
+        (void)xf_osal_mutex_delete(bc->mutex);
+        bc->mutex = NULL;
+        return XF_ERR_NO_MEM;
+    }
+
+    bc->buf = (uint8_t *)buf;
+    bc->msg_size = msg_size;
+    bc->msg_count = msg_count;
+    bc->head = 0U;
+    bc->head_slot = 0U;
+
+    return XF_OK;
+}
+
+xf_err_t xf_osal_broadcast_deinit(xf_osal_broadcast_t *bc)
+{
+    xf_err_t err;
+
+    if ((bc == NULL) || (bc->mutex == NULL)) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    err = xf_osal_cond_delete(bc->cond);
+    if (err != XF_OK) {
+        return err;
+    }
+    bc->cond = NULL;
+
+    err = xf_osal_mutex_delete(bc->mutex);
+    if (err == XF_OK) {
+        bc->mutex = NULL;
+    }
+
+    return err;
+}
+
+xf_err_t xf_osal_broadcast_subscribe(xf_osal_broadcast_t *bc, xf_osal_broadcast_sub_t *sub)
+{
+    if ((bc == NULL) || (bc->mutex == NULL) || (sub == NULL)) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    (void)xf_osal_mutex_acquire(bc->mutex, XF_OSAL_WAIT_FOREVER);
+    sub->bc = bc;
+    sub->cursor = bc->head;
+    sub->overrun = 0U;
+    (void)xf_osal_mutex_release(bc->mutex);
+
+    return XF_OK;
+}
+
+xf_err_t xf_osal_broadcast_publish(xf_osal_broadcast_t *bc, const void *msg_ptr)
+{
+    xf_err_t err;
+
+    if ((bc == NULL) || (bc->mutex == NULL) || (msg_ptr == NULL)) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    err = xf_osal_mutex_acquire(bc->mutex, XF_OSAL_WAIT_FOREVER);
+    if (err != XF_OK) {
+        return err;
+    }
+
+    memcpy(&bc->buf[bc->head_slot * bc->msg_size], msg_ptr, bc->msg_size);
+    bc->head++;
+    bc->head_slot++;
+    if (bc->head_slot == bc->msg_count) {
+        bc->head_slot = 0U;
+    }
+
+    (void)xf_osal_cond_broadcast(bc->cond);
+    (void)xf_osal_mutex_release(bc->mutex);
+
+    return XF_OK;
+}
+
+xf_err_t xf_osal_broadcast_receive(
+    xf_osal_broadcast_sub_t *sub, void *msg_ptr, uint32_t *lost, uint32_t timeout)
+{
+    xf_osal_broadcast_t *bc;
+    uint32_t start;
+    uint32_t elapsed;
+    uint32_t dropped;
+    xf_err_t err;
+
+    if ((sub == NULL) || (sub->bc == NULL) || (msg_ptr == NULL)) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    bc = sub->bc;
+
+    err = xf_osal_mutex_acquire(bc->mutex, XF_OSAL_WAIT_FOREVER);
+    if (err != XF_OK) {
+        return err;
+    }
+
+    start = xf_osal_kernel_get_tick_count();
+
+    while (sub->cursor == bc->head) {
+        if (timeout == 0U) {
+            err = XF_ERR_RESOURCE;
+        } else if (timeout == XF_OSAL_WAIT_FOREVER) {
+            err = xf_osal_cond_wait(bc->cond, bc->mutex);
+        } else {
+            elapsed = xf_osal_kernel_get_tick_count() - start;
+            if (elapsed >= timeout) {
+                err = XF_ERR_TIMEOUT;
+            } else {
+                err = xf_osal_cond_timedwait(bc->cond, bc->mutex, timeout - elapsed);
+                if (err == XF_ERR_TIMEOUT) {
+                    /* 超时与发布同时发生时以消息为准 */
+                    err = XF_OK;
+                    if (sub->cursor == bc->head) {
+                        err = XF_ERR_TIMEOUT;
+                    }
+                }
+            }
+        }
+
+        if (err != XF_OK) {
+            (void)xf_osal_mutex_release(bc->mutex);
+            return err;
+        }
+    }
+
+    dropped = broadcast_catch_up(sub);
+
+    memcpy(msg_ptr, &bc->buf[broadcast_slot(sub) * bc->msg_size], bc->msg_size);
+    sub->cursor++;
+
+    (void)xf_osal_mutex_release(bc->mutex);
+
+    if (lost != NULL) {
+        *lost = dropped;
+    }
+
+    return XF_OK;
+}
+
+uint32_t xf_osal_broadcast_get_pending(xf_osal_broadcast_sub_t *sub)
+{
+    xf_osal_broadcast_t *bc;
+    uint32_t pending;
+
+    if ((sub == NULL) || (sub->bc == NULL)) {
+        return 0U;
+    }
+
+    bc = sub->bc;
+
+    (void)xf_osal_mutex_acquire(bc->mutex, XF_OSAL_WAIT_FOREVER);
+    pending = bc->head - sub->cursor;
+    if (pending > bc->msg_count) {
+        pending = bc->msg_count;
+    }
+    (void)xf_osal_mutex_release(bc->mutex);
+
+    return pending;
+}
+
+uint32_t xf_osal_broadcast_get_overrun(const xf_osal_broadcast_sub_t *sub)
+{
+    return (sub != NULL) ? sub->overrun : 0U;
+}
+
+/* ==================== [Static Functions] ================================== */
+
+/**
+ * @brief 游标落后超过缓冲区容量时跳到仍保留的最旧消息，返回跳过的消息数。
+ *
+ * 调用时必须持有 bc->mutex. 序号按 uint32_t 回绕，差值运算对回绕安全。
+ */
+static uint32_t broadcast_catch_up(xf_osal_broadcast_sub_t *sub)
+{
+    xf_osal_broadcast_t *bc = sub->bc;
+    uint32_t behind = bc->head - sub->cursor;
+    uint32_t dropped = 0U;
+
+    if (behind > bc->msg_count) {
+        dropped = behind - bc->msg_count;
+        sub->cursor += dropped;
+        sub->overrun += dropped;
+    }
+
+    return dropped;
+}
+
+/**
+ * @brief 游标所指消息的槽位。
+ *
+ * 调用时必须持有 bc->mutex, 且游标落后 1 ~ msg_count 条。
+ * 序号在 2^32 处回绕，msg_count 不是 2 的幂时不能直接对序号取模，
+ * 因此由写入槽位倒推。
+ */
+static uint32_t broadcast_slot(const xf_osal_broadcast_sub_t *sub)
+{
+    const xf_osal_broadcast_t *bc = sub->bc;
+    uint32_t behind = bc->head - sub->cursor;
+
+    return (bc->head_slot >= behind) ? (bc->head_slot - behind) : (bc->head_slot + bc->msg_count - behind);
+}
+
+#endif
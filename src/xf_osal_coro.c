@@ -0,0 +1,589 @@
+/**
+ * @file xf_osal_coro.c
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_osal.h"
+#include "xf_osal_atomic.h"
+
+#if XF_OSAL_CORO_IS_ENABLE
+
+/* ==================== [Defines] =========================================== */
+
+/* 等待类型 */
+#define CORO_WAIT_NONE          (0U)
+#define CORO_WAIT_SLEEP         (1U)
+#define CORO_WAIT_QUEUE         (2U)
+#define CORO_WAIT_SEMAPHORE     (3U)
+#define CORO_WAIT_EVENT         (4U)
+
+/* 协程状态 */
+#define CORO_STATE_IDLE         (0U)    /* 未提交或已执行完毕 */
+#define CORO_STATE_ACTIVE       (1U)    /* 已提交给执行器 */
+
+/* 重试所有等待对象的协程 */
+#define CORO_WATCH_ALL          (0xFFFFFFFFUL)
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Static Prototypes] ================================= */
+
+static bool coro_wait_begin(xf_osal_coro_t *coro, uint8_t wait, uint32_t timeout);
+static xf_err_t coro_try(xf_osal_coro_t *coro);
+static bool coro_poll(xf_osal_coro_t *coro, uint32_t now, uint32_t mask);
+static uint32_t coro_obj_bit(const void *obj);
+static void coro_exec_signal(xf_osal_coro_exec_t *exec, uint32_t mask);
+static uint32_t coro_exec_take_signaled(xf_osal_coro_exec_t *exec, uint32_t now);
+static void coro_exec_take_pending(xf_osal_coro_exec_t *exec);
+static void coro_exec_poll(xf_osal_coro_exec_t *exec, xf_osal_coro_t **link, uint32_t mask);
+static xf_osal_coro_t **coro_exec_run_ready(xf_osal_coro_exec_t *exec);
+static void coro_exec_watch(xf_osal_coro_exec_t *exec);
+static uint32_t coro_exec_next_timeout(xf_osal_coro_exec_t *exec);
+static void coro_ready_push(xf_osal_coro_exec_t *exec, xf_osal_coro_t *coro);
+
+/* ==================== [Static Variables] ================================== */
+
+/* 已初始化的执行器，只增不减，供 xf_osal_coro_notify() 在中断中无锁遍历 */
+static xf_osal_coro_exec_t *volatile s_exec_list = NULL;
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+xf_err_t xf_osal_coro_exec_init(xf_osal_coro_exec_t *exec, uint32_t poll_ticks)
+{
+    xf_osal_coro_exec_t *head;
+
+    if (exec == NULL) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    exec->pending    = NULL;
+    exec->ready_head = NULL;
+    exec->ready_tail = NULL;
+    exec->wait_head  = NULL;
+    exec->wait_tail  = &exec->wait_head;
+    exec->thread     = NULL;
+    exec->poll_ticks = poll_ticks;
+    exec->poll_last  = 0U;
+    exec->watch      = 0U;
+    exec->signaled   = 0U;
+    exec->stop       = 0U;
+    exec->count      = 0U;
+
+    /* 成员初始化完毕后再登记，notify 看到的执行器总是完整的 */
+    head = xf_osal_atomic_load(&s_exec_list);
+    do {
+        exec->next_exec = head;
+    } while (!xf_osal_atomic_cas(&s_exec_list, &head, exec));
+
+    return XF_OK;
+}
+
+xf_err_t xf_osal_coro_exec_run(xf_osal_coro_exec_t *exec)
+{
+    xf_osal_coro_t **link;
+    uint32_t timeout;
+
+    if (exec == NULL) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    exec->thread = xf_osal_thread_get_current();
+    if (exec->thread == NULL) {
+        return XF_ERR_ISR;
+    }
+
+    /* 停止期间写入的对象没有通知，重新运行时先重试一遍所有等待的协程 */
+    exec->poll_last = xf_osal_kernel_get_tick_count();
+    xf_osal_atomic_store(&exec->signaled, CORO_WATCH_ALL);
+
+    while (xf_osal_atomic_load(&exec->stop) == 0U) {
+        coro_exec_take_pending(exec);
+        coro_exec_poll(exec, &exec->wait_head, coro_exec_take_signaled(exec, xf_osal_kernel_get_tick_count()));
+        link = coro_exec_run_ready(exec);
+
+        /*
+         * 先公布等待的对象再重试本轮新登记的协程：
+         * 二者之间写入对象的生产者一定能看到公布结果并唤醒执行器，不会丢失唤醒。
+         */
+        coro_exec_watch(exec);
+        if (*link != NULL) {
+            coro_exec_poll(exec, link, CORO_WATCH_ALL);
+        }
+
+        if (exec->ready_head != NULL) {
+            /* 有让出的协程，不阻塞 */
+            continue;
+        }
+
+        /* 阻塞期间提交的协程或 wake 会置位通知，wait 立即返回，不会丢失 */
+        timeout = coro_exec_next_timeout(exec);
+        if (timeout != 0U) {
+            (void)xf_osal_thread_notify_wait(XF_OSAL_CORO_WAKE_FLAG, XF_OSAL_WAIT_ANY, timeout);
+        }
+    }
+
+    xf_osal_atomic_store(&exec->watch, 0U);
+    xf_osal_atomic_store(&exec->stop, 0U);
+    exec->thread = NULL;
+
+    return XF_OK;
+}
+
+xf_err_t xf_osal_coro_exec_stop(xf_osal_coro_exec_t *exec)
+{
+    if (exec == NULL) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    xf_osal_atomic_store(&exec->stop, 1U);
+    coro_exec_signal(exec, 0U);
+
+    return XF_OK;
+}
+
+xf_err_t xf_osal_coro_exec_wake(xf_osal_coro_exec_t *exec)
+{
+    if (exec == NULL) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    coro_exec_signal(exec, CORO_WATCH_ALL);
+
+    return XF_OK;
+}
+
+xf_err_t xf_osal_coro_notify(const void *obj)
+{
+    xf_osal_coro_exec_t *exec;
+    uint32_t bit;
+
+    if (obj == NULL) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    bit = coro_obj_bit(obj);
+
+    for (exec = xf_osal_atomic_load(&s_exec_list); exec != NULL; exec = exec->next_exec) {
+        if ((xf_osal_atomic_load(&exec->watch) & bit) != 0U) {
+            coro_exec_signal(exec, bit);
+        }
+    }
+
+    return XF_OK;
+}
+
+uint32_t xf_osal_coro_exec_get_count(xf_osal_coro_exec_t *exec)
+{
+    if (exec == NULL) {
+        return 0U;
+    }
+
+    return xf_osal_atomic_load(&exec->count);
+}
+
+xf_err_t xf_osal_coro_spawn(xf_osal_coro_exec_t *exec, xf_osal_coro_t *coro,
+                            xf_osal_coro_func_t func, void *arg, xf_osal_coro_done_cb_t done)
+{
+    uint8_t expected = CORO_STATE_IDLE;
+    xf_osal_coro_t *head;
+
+    if ((exec == NULL) || (coro == NULL) || (func == NULL)) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    if (!xf_osal_atomic_cas(&coro->state, &expected, (uint8_t)CORO_STATE_ACTIVE)) {
+        return XF_ERR_RESOURCE;
+    }
+
+    coro->func   = func;
+    coro->done   = done;
+    coro->arg    = arg;
+    coro->obj    = NULL;
+    coro->msg    = NULL;
+    coro->result = XF_OK;
+    coro->line   = 0U;
+    coro->wait   = CORO_WAIT_NONE;
+    coro->timed  = 0U;
+
+    (void)xf_osal_atomic_fetch_add(&exec->count, 1U);
+
+    /* 压入待取出链表，可能与其他线程或中断并发 */
+    head = xf_osal_atomic_load(&exec->pending);
+    do {
+        coro->next = head;
+    } while (!xf_osal_atomic_cas(&exec->pending, &head, coro));
+
+    coro_exec_signal(exec, 0U);
+
+    return XF_OK;
+}
+
+xf_err_t xf_osal_coro_result(const xf_osal_coro_t *coro)
+{
+    return (coro != NULL) ? coro->result : XF_ERR_INVALID_ARG;
+}
+
+bool xf_osal_coro_sleep(xf_osal_coro_t *coro, uint32_t ticks)
+{
+    coro->result = XF_OK;
+
+    if (ticks == 0U) {
+        return true;
+    }
+
+    coro->wait     = CORO_WAIT_SLEEP;
+    coro->timed    = (ticks != XF_OSAL_WAIT_FOREVER) ? 1U : 0U;
+    coro->deadline = xf_osal_kernel_get_tick_count() + ticks;
+
+    return false;
+}
+
+#if XF_OSAL_QUEUE_IS_ENABLE
+bool xf_osal_coro_queue_get(xf_osal_coro_t *coro, xf_osal_queue_t queue, void *msg, uint32_t timeout)
+{
+    coro->obj = queue;
+    coro->msg = msg;
+
+    return coro_wait_begin(coro, CORO_WAIT_QUEUE, timeout);
+}
+#endif
+
+#if XF_OSAL_SEMAPHORE_IS_ENABLE
+bool xf_osal_coro_semaphore_acquire(xf_osal_coro_t *coro, xf_osal_semaphore_t semaphore, uint32_t timeout)
+{
+    coro->obj = semaphore;
+
+    return coro_wait_begin(coro, CORO_WAIT_SEMAPHORE, timeout);
+}
+#endif
+
+#if XF_OSAL_EVENT_IS_ENABLE
+bool xf_osal_coro_event_wait(xf_osal_coro_t *coro, xf_osal_event_t event,
+                             uint32_t flags, uint32_t options, uint32_t timeout)
+{
+    coro->obj     = event;
+    coro->flags   = flags;
+    coro->options = options;
+
+    return coro_wait_begin(coro, CORO_WAIT_EVENT, timeout);
+}
+#endif
+
+/* ==================== [Static Functions] ================================== */
+
+/**
+ * @brief 先尝试一次，不能立即完成且 timeout 不为 0 时登记等待。
+ */
+static bool coro_wait_begin(xf_osal_coro_t *coro, uint8_t wait, uint32_t timeout)
+{
+    xf_err_t err;
+
+    coro->wait = wait;
+    err = coro_try(coro);
+
+    if ((err == XF_OK) || ((err != XF_ERR_RESOURCE) && (err != XF_ERR_TIMEOUT))) {
+        /* 成功，或参数错误等不会因等待而改变的错误 */
+        coro->wait   = CORO_WAIT_NONE;
+        coro->result = err;
+        return true;
+    }
+
+    if (timeout == 0U) {
+        coro->wait   = CORO_WAIT_NONE;
+        coro->result = XF_ERR_RESOURCE;
+        return true;
+    }
+
+    coro->timed    = (timeout != XF_OSAL_WAIT_FOREVER) ? 1U : 0U;
+    coro->deadline = xf_osal_kernel_get_tick_count() + timeout;
+    coro->result   = XF_ERR_TIMEOUT;
+
+    return false;
+}
+
+/**
+ * @brief 以 timeout 为 0 执行一次等待的操作。
+ */
+static xf_err_t coro_try(xf_osal_coro_t *coro)
+{
+    switch (coro->wait) {
+#if XF_OSAL_QUEUE_IS_ENABLE
+    case CORO_WAIT_QUEUE:
+        return xf_osal_queue_get((xf_osal_queue_t)coro->obj, coro->msg, NULL, 0U);
+#endif
+#if XF_OSAL_SEMAPHORE_IS_ENABLE
+    case CORO_WAIT_SEMAPHORE:
+        return xf_osal_semaphore_acquire((xf_osal_semaphore_t)coro->obj, 0U);
+#endif
+#if XF_OSAL_EVENT_IS_ENABLE
+    case CORO_WAIT_EVENT:
+        return xf_osal_event_wait((xf_osal_event_t)coro->obj, coro->flags, coro->options, 0U);
+#endif
+    default:
+        return XF_ERR_RESOURCE;
+    }
+}
+
+/**
+ * @brief 检查等待中的协程，已完成或超时时写入结果并返回 true.
+ *
+ * @param mask 只重试所等待对象落在 mask 中的协程，其余只检查超时。
+ */
+static bool coro_poll(xf_osal_coro_t *coro, uint32_t now, uint32_t mask)
+{
+    xf_err_t err;
+
+    if ((coro->wait != CORO_WAIT_SLEEP) && ((coro_obj_bit(coro->obj) & mask) != 0U)) {
+        err = coro_try(coro);
+        if ((err == XF_OK) || ((err != XF_ERR_RESOURCE) && (err != XF_ERR_TIMEOUT))) {
+            coro->result = err;
+            return true;
+        }
+    }
+
+    if ((coro->timed != 0U) && ((int32_t)(coro->deadline - now) <= 0)) {
+        /* 休眠到期为成功，等待对象到期为超时，两者的 result 已在登记时写好 */
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief 把对象映射到 32 位掩码中的一位，不同对象可能映射到同一位，只会造成多余的重试。
+ */
+static uint32_t coro_obj_bit(const void *obj)
+{
+    uintptr_t v = (uintptr_t)obj;
+
+    v ^= v >> 5;
+    v ^= v >> 11;
+
+    return 1UL << (v & 31U);
+}
+
+/**
+ * @brief 置位需重试的对象掩码并唤醒执行器，mask 为 0 时只唤醒。
+ */
+static void coro_exec_signal(xf_osal_coro_exec_t *exec, uint32_t mask)
+{
+    xf_osal_thread_t thread;
+    uint32_t old;
+
+    if (mask != 0U) {
+        old = xf_osal_atomic_load(&exec->signaled);
+        while (!xf_osal_atomic_cas(&exec->signaled, &old, old | mask)) {
+        }
+    }
+
+    /* 执行器尚未运行时无需唤醒，开始运行时会先检查一遍 */
+    thread = exec->thread;
+    if (thread != NULL) {
+        (void)xf_osal_thread_notify_set(thread, XF_OSAL_CORO_WAKE_FLAG);
+    }
+}
+
+/**
+ * @brief 取出 xf_osal_coro_notify() 置位的对象掩码；到达轮询间隔时返回全部位。
+ */
+static uint32_t coro_exec_take_signaled(xf_osal_coro_exec_t *exec, uint32_t now)
+{
+    uint32_t mask = xf_osal_atomic_load(&exec->signaled);
+
+    while (!xf_osal_atomic_cas(&exec->signaled, &mask, 0U)) {
+    }
+
+    if ((exec->poll_ticks != 0U) && ((now - exec->poll_last) >= exec->poll_ticks)) {
+        exec->poll_last = now;
+        mask = CORO_WATCH_ALL;
+    }
+
+    return mask;
+}
+
+/**
+ * @brief 取出其他线程提交的协程，按提交顺序加入可运行链表。
+ */
+static void coro_exec_take_pending(xf_osal_coro_exec_t *exec)
+{
+    xf_osal_coro_t *head;
+    xf_osal_coro_t *prev = NULL;
+    xf_osal_coro_t *next;
+
+    head = xf_osal_atomic_load(&exec->pending);
+    while (!xf_osal_atomic_cas(&exec->pending, &head, (xf_osal_coro_t *)NULL)) {
+    }
+
+    /* 链表为后进先出，先反转 */
+    while (head != NULL) {
+        next = head->next;
+        head->next = prev;
+        prev = head;
+        head = next;
+    }
+
+    while (prev != NULL) {
+        next = prev->next;
+        coro_ready_push(exec, prev);
+        prev = next;
+    }
+}
+
+/**
+ * @brief 检查等待链表中从 link 开始的协程，完成或超时的移入可运行链表。
+ */
+static void coro_exec_poll(xf_osal_coro_exec_t *exec, xf_osal_coro_t **link, uint32_t mask)
+{
+    xf_osal_coro_t *coro;
+    uint32_t now;
+
+    if (*link == NULL) {
+        return;
+    }
+
+    now = xf_osal_kernel_get_tick_count();
+
+    while ((coro = *link) != NULL) {
+        if (coro_poll(coro, now, mask)) {
+            *link = coro->next;
+            coro->wait = CORO_WAIT_NONE;
+            coro_ready_push(exec, coro);
+        } else {
+            link = &coro->next;
+        }
+    }
+
+    exec->wait_tail = link;
+}
+
+/**
+ * @brief 运行本轮开始时可运行的协程，本轮中让出的协程留到下一轮。
+ *
+ * @return 本轮新登记的等待协程在等待链表中的起点，按登记顺序追加在链表末尾。
+ */
+static xf_osal_coro_t **coro_exec_run_ready(xf_osal_coro_exec_t *exec)
+{
+    xf_osal_coro_t **link = exec->wait_tail;
+    xf_osal_coro_t *coro = exec->ready_head;
+    xf_osal_coro_done_cb_t done;
+    xf_osal_coro_status_t status;
+    xf_osal_coro_t *next;
+    void *arg;
+
+    exec->ready_head = NULL;
+    exec->ready_tail = NULL;
+
+    while (coro != NULL) {
+        next = coro->next;
+        status = coro->func(coro, coro->arg);
+
+        if (status == XF_OSAL_CORO_STATUS_DONE) {
+            done = coro->done;
+            arg = coro->arg;
+            coro->wait = CORO_WAIT_NONE;
+            xf_osal_atomic_store(&coro->state, (uint8_t)CORO_STATE_IDLE);
+            (void)xf_osal_atomic_fetch_add(&exec->count, (uint32_t)-1);
+            /* 回调之后不再访问协程对象 */
+            if (done != NULL) {
+                done(coro, arg);
+            }
+        } else if (coro->wait != CORO_WAIT_NONE) {
+            coro->next = NULL;
+            *exec->wait_tail = coro;
+            exec->wait_tail = &coro->next;
+        } else {
+            coro_ready_push(exec, coro);
+        }
+
+        coro = next;
+    }
+
+    return link;
+}
+
+/**
+ * @brief 公布等待中的协程所等待的对象，供 xf_osal_coro_notify() 判断是否需要唤醒。
+ */
+static void coro_exec_watch(xf_osal_coro_exec_t *exec)
+{
+    xf_osal_coro_t *coro;
+    uint32_t watch = 0U;
+    uint32_t old;
+
+    for (coro = exec->wait_head; coro != NULL; coro = coro->next) {
+        if (coro->wait != CORO_WAIT_SLEEP) {
+            watch |= coro_obj_bit(coro->obj);
+        }
+    }
+
+    /* 以读-改-写公布，与之后重试时读取对象的操作保持顺序 */
+    old = xf_osal_atomic_load(&exec->watch);
+    while (!xf_osal_atomic_cas(&exec->watch, &old, watch)) {
+    }
+}
+
+/**
+ * @brief 计算执行器可以阻塞的时间。
+ */
+static uint32_t coro_exec_next_timeout(xf_osal_coro_exec_t *exec)
+{
+    uint32_t timeout = XF_OSAL_WAIT_FOREVER;
+    xf_osal_coro_t *coro;
+    uint32_t now;
+    int32_t remain;
+
+    if (exec->wait_head == NULL) {
+        return timeout;
+    }
+
+    now = xf_osal_kernel_get_tick_count();
+
+    for (coro = exec->wait_head; coro != NULL; coro = coro->next) {
+        if ((coro->wait != CORO_WAIT_SLEEP) && (exec->poll_ticks != 0U)) {
+            /* 轮询只是没有调用 xf_osal_coro_notify() 的生产者的后备手段 */
+            remain = (int32_t)(exec->poll_last + exec->poll_ticks - now);
+            if (remain <= 0) {
+                return 0U;
+            }
+            if ((uint32_t)remain < timeout) {
+                timeout = (uint32_t)remain;
+            }
+        }
+
+        if (coro->timed != 0U) {
+            remain = (int32_t)(coro->deadline - now);
+            if (remain <= 0) {
+                return 0U;
+            }
+            if ((uint32_t)remain < timeout) {
+                timeout = (uint32_t)remain;
+            }
+        }
+    }
+
+    return timeout;
+}
+
+static void coro_ready_push(xf_osal_coro_exec_t *exec, xf_osal_coro_t *coro)
+{
+    coro->next = NULL;
+
+    if (exec->ready_tail == NULL) {
+        exec->ready_head = coro;
+    } else {
+        exec->ready_tail->next = coro;
+    }
+    exec->ready_tail = coro;
+}
+
+#endif
@@ -0,0 +1,288 @@
+/**
+ * @file xf_osal_latency.c
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include <string.h>
+
+#include "xf_osal.h"
+#include "xf_osal_atomic.h"
+
+#if XF_OSAL_LATENCY_IS_ENABLE
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+typedef struct _latency_entry_t {
+    const void     *obj;        /* 为 NULL 时槽位空闲 */
+    const char     *name;
+    uint32_t        max;
+    uint32_t        buckets[XF_OSAL_LATENCY_BUCKET_NUM];
+} latency_entry_t;
+
+/* ==================== [Static Prototypes] ================================= */
+
+static latency_entry_t *latency_find(const void *obj);
+static uint32_t latency_bucket(uint32_t duration);
+static uint32_t latency_percentile(const xf_osal_latency_stats_t *stats, uint32_t percent);
+static void latency_read(const latency_entry_t *entry, xf_osal_latency_stats_t *stats);
+static void latency_print(const xf_osal_latency_stats_t *stats, void *user_data);
+
+/* ==================== [Static Variables] ================================== */
+
+static latency_entry_t s_latency_table[XF_OSAL_LATENCY_OBJ_NUM];
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+xf_err_t xf_osal_latency_attach(const void *obj, const char *name)
+{
+    latency_entry_t *entry;
+    const void *expected;
+    uint32_t i;
+
+    if (obj == NULL) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    entry = latency_find(obj);
+    if (entry != NULL) {
+        entry->name = name;
+        return XF_OK;
+    }
+
+    for (i = 0U; i < XF_OSAL_LATENCY_OBJ_NUM; i++) {
+        entry = &s_latency_table[i];
+        if (xf_osal_atomic_load(&entry->obj) != NULL) {
+            continue;
+        }
+
+        /* 先占用槽位再初始化，槽位被其他线程抢先占用时继续找下一个 */
+        expected = NULL;
+        if (xf_osal_atomic_cas(&entry->obj, &expected, obj)) {
+            entry->name = name;
+            xf_osal_atomic_store(&entry->max, 0U);
+            memset(entry->buckets, 0, sizeof(entry->buckets));
+            return XF_OK;
+        }
+    }
+
+    return XF_ERR_NO_MEM;
+}
+
+xf_err_t xf_osal_latency_detach(const void *obj)
+{
+    latency_entry_t *entry;
+
+    if (obj == NULL) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    entry = latency_find(obj);
+    if (entry == NULL) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    xf_osal_atomic_store(&entry->obj, NULL);
+
+    return XF_OK;
+}
+
+xf_err_t xf_osal_latency_get_stats(const void *obj, xf_osal_latency_stats_t *stats)
+{
+    latency_entry_t *entry;
+
+    if ((obj == NULL) || (stats == NULL)) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    entry = latency_find(obj);
+    if (entry == NULL) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    latency_read(entry, stats);
+
+    return XF_OK;
+}
+
+uint32_t xf_osal_latency_walk(xf_osal_latency_walk_cb_t cb, void *user_data)
+{
+    xf_osal_latency_stats_t stats;
+    uint32_t walked = 0U;
+    uint32_t i;
+
+    if (cb == NULL) {
+        return 0U;
+    }
+
+    for (i = 0U; i < XF_OSAL_LATENCY_OBJ_NUM; i++) {
+        if (xf_osal_atomic_load(&s_latency_table[i].obj) == NULL) {
+            continue;
+        }
+
+        latency_read(&s_latency_table[i], &stats);
+        if (stats.obj == NULL) {
+            /* 读取期间被取消登记 */
+            continue;
+        }
+
+        cb(&stats, user_data);
+        walked++;
+    }
+
+    return walked;
+}
+
+void xf_osal_latency_dump(xf_osal_latency_print_t print)
+{
+    if (print == NULL) {
+        return;
+    }
+
+    print("%-16s %10s %10s %10s %10s  (timestamp %lu Hz)\n", "name", "count", "p50", "p99", "max",
+          (unsigned long)XF_OSAL_TRACE_TIMESTAMP_FREQ());
+    (void)xf_osal_latency_walk(latency_print, &print);
+}
+
+void xf_osal_latency_reset(void)
+{
+    latency_entry_t *entry;
+    uint32_t i;
+
+    for (i = 0U; i < XF_OSAL_LATENCY_OBJ_NUM; i++) {
+        entry = &s_latency_table[i];
+        xf_osal_atomic_store(&entry->max, 0U);
+        memset(entry->buckets, 0, sizeof(entry->buckets));
+    }
+}
+
+void xf_osal_latency_record(const void *obj, uint32_t duration)
+{
+    latency_entry_t *entry;
+    uint32_t max;
+
+    entry = latency_find(obj);
+    if (entry == NULL) {
+        return;
+    }
+
+    (void)xf_osal_atomic_fetch_add(&entry->buckets[latency_bucket(duration)], 1U);
+
+    max = xf_osal_atomic_load(&entry->max);
+    while (duration > max) {
+        if (xf_osal_atomic_cas(&entry->max, &max, duration)) {
+            break;
+        }
+    }
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static latency_entry_t *latency_find(const void *obj)
+{
+    uint32_t i;
+
+    if (obj == NULL) {
+        return NULL;
+    }
+
+    for (i = 0U; i < XF_OSAL_LATENCY_OBJ_NUM; i++) {
+        if (xf_osal_atomic_load(&s_latency_table[i].obj) == obj) {
+            return &s_latency_table[i];
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief 耗时所在的桶：0 -> 0, [2^(i-1), 2^i - 1] -> i.
+ */
+static uint32_t latency_bucket(uint32_t duration)
+{
+#if defined(__GNUC__)
+    return (duration == 0U) ? 0U : (32U - (uint32_t)__builtin_clz(duration));
+#else
+    uint32_t bucket = 0U;
+
+    while (duration != 0U) {
+        duration >>= 1;
+        bucket++;
+    }
+
+    return bucket;
+#endif
+}
+
+static uint32_t latency_percentile(const xf_osal_latency_stats_t *stats, uint32_t percent)
+{
+    uint64_t target;
+    uint64_t seen = 0U;
+    uint32_t upper;
+    uint32_t i;
+
+    if (stats->count == 0U) {
+        return 0U;
+    }
+
+    /* 第 ceil(count * percent / 100) 个样本所在的桶 */
+    target = ((uint64_t)stats->count * percent + 99U) / 100U;
+
+    for (i = 0U; i < XF_OSAL_LATENCY_BUCKET_NUM; i++) {
+        seen += stats->buckets[i];
+        if (seen >= target) {
+            break;
+        }
+    }
+
+    if (i == 0U) {
+        upper = 0U;
+    } else if (i >= 32U) {
+        upper = UINT32_MAX;
+    } else {
+        upper = (1UL << i) - 1U;
+    }
+
+    return (upper < stats->max) ? upper : stats->max;
+}
+
+static void latency_read(const latency_entry_t *entry, xf_osal_latency_stats_t *stats)
+{
+    uint32_t i;
+
+    stats->obj = xf_osal_atomic_load(&entry->obj);
+    stats->name = entry->name;
+    stats->max = xf_osal_atomic_load(&entry->max);
+
+    /* 与并发的记录之间不是原子快照，以各桶之和作为调用次数，保证百分位数自洽 */
+    stats->count = 0U;
+    for (i = 0U; i < XF_OSAL_LATENCY_BUCKET_NUM; i++) {
+        stats->buckets[i] = xf_osal_atomic_load(&entry->buckets[i]);
+        stats->count += stats->buckets[i];
+    }
+
+    stats->p50 = latency_percentile(stats, 50U);
+    stats->p99 = latency_percentile(stats, 99U);
+}
+
+static void latency_print(const xf_osal_latency_stats_t *stats, void *user_data)
+{
+    xf_osal_latency_print_t print = *(xf_osal_latency_print_t *)user_data;
+
+    print("%-16s %10lu %10lu %10lu %10lu\n", (stats->name != NULL) ? stats->name : "-",
+          (unsigned long)stats->count, (unsigned long)stats->p50,
+          (unsigned long)stats->p99, (unsigned long)stats->max);
+}
+
+#endif
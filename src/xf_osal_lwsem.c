@@ -0,0 +1,108 @@
+/**
+ * @file xf_osal_lwsem.c
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_osal.h"
+
+#if XF_OSAL_LWSEM_IS_ENABLE
+
+/* ==================== [Defines] =========================================== */
+
+/* 底层信号量只承载待唤醒的线程数，不会超过系统中的线程数 */
+#define LWSEM_SEMA_MAX_COUNT    (0x7FFFU)
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Static Prototypes] ================================= */
+
+/* ==================== [Static Variables] ================================== */
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+xf_err_t xf_osal_lwsem_init(xf_osal_lwsem_t *lwsem, uint32_t max_count, uint32_t initial_count)
+{
+    if ((lwsem == NULL) || (max_count == 0U) || (max_count > (uint32_t)INT32_MAX)
+            || (initial_count > max_count)) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    lwsem->sema = xf_osal_semaphore_create(LWSEM_SEMA_MAX_COUNT, 0U, NULL);
+    if (lwsem->sema == NULL) {
+        return XF_ERR_NO_MEM;
+    }
+
+    lwsem->max_count = (int32_t)max_count;
+    xf_osal_atomic_store(&lwsem->count, (int32_t)initial_count);
+
+    return XF_OK;
+}
+
+xf_err_t xf_osal_lwsem_deinit(xf_osal_lwsem_t *lwsem)
+{
+    xf_err_t err;
+
+    if ((lwsem == NULL) || (lwsem->sema == NULL)) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    if (xf_osal_atomic_load(&lwsem->count) < 0) {
+        return XF_ERR_RESOURCE;
+    }
+
+    err = xf_osal_semaphore_delete(lwsem->sema);
+    if (err == XF_OK) {
+        lwsem->sema = NULL;
+    }
+
+    return err;
+}
+
+xf_err_t xf_osal_lwsem_acquire_slow(xf_osal_lwsem_t *lwsem, uint32_t timeout)
+{
+    int32_t old;
+    xf_err_t err;
+
+    /* 登记为等待者；期间如有令牌被释放则直接取得 */
+    old = xf_osal_atomic_fetch_add(&lwsem->count, -1);
+    if (old > 0) {
+        return XF_OK;
+    }
+
+    err = xf_osal_semaphore_acquire(lwsem->sema, timeout);
+    if (err == XF_OK) {
+        return XF_OK;
+    }
+
+    /* 超时：撤销等待登记 */
+    old = xf_osal_atomic_load(&lwsem->count);
+    while (old < 0) {
+        if (xf_osal_atomic_cas(&lwsem->count, &old, old + 1)) {
+            return err;
+        }
+    }
+
+    /* 释放者已将令牌交给本线程，正在或即将唤醒底层信号量，必须取走 */
+    (void)xf_osal_semaphore_acquire(lwsem->sema, XF_OSAL_WAIT_FOREVER);
+
+    return XF_OK;
+}
+
+xf_err_t xf_osal_lwsem_wake(xf_osal_lwsem_t *lwsem)
+{
+    return xf_osal_semaphore_release(lwsem->sema);
+}
+
+/* ==================== [Static Functions] ================================== */
+
+#endif
@@ -0,0 +1,336 @@
+/**
+ * @file xf_osal_mutex_profile.c
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include <string.h>
+
+#include "xf_osal.h"
+
+#if XF_OSAL_MUTEX_PROFILE_IS_ENABLE
+
+/* ==================== [Defines] =========================================== */
+
+#if (XF_OSAL_MUTEX_PROFILE_NUM) > 256U
+#error "XF_OSAL_MUTEX_PROFILE_NUM must not exceed 256"
+#endif
+
+/* ==================== [Typedefs] ========================================== */
+
+typedef struct _profile_entry_t {
+    xf_osal_mutex_profile_stats_t   stats;      /* stats.mutex 为 NULL 时槽位空闲 */
+    xf_osal_thread_t                holder;     /* 当前持有者，未持有时为 NULL */
+    uint32_t                        depth;      /* 当前持有者的递归深度 */
+    uint32_t                        acquired_at;
+} profile_entry_t;
+
+/* ==================== [Static Prototypes] ================================= */
+
+static bool profile_lock(void);
+static void profile_unlock(bool locked);
+static profile_entry_t *profile_find(xf_osal_mutex_t mutex);
+static void profile_clear(profile_entry_t *entry);
+static uint32_t profile_sort(uint8_t *order);
+
+/* ==================== [Static Variables] ================================== */
+
+static profile_entry_t s_profile_table[XF_OSAL_MUTEX_PROFILE_NUM];
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+xf_err_t xf_osal_mutex_profile_get_stats(xf_osal_mutex_t mutex, xf_osal_mutex_profile_stats_t *stats)
+{
+    profile_entry_t *entry;
+    bool locked;
+
+    if ((mutex == NULL) || (stats == NULL)) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    locked = profile_lock();
+    entry = profile_find(mutex);
+    if (entry != NULL) {
+        *stats = entry->stats;
+    }
+    profile_unlock(locked);
+
+    return (entry != NULL) ? XF_OK : XF_ERR_INVALID_ARG;
+}
+
+uint32_t xf_osal_mutex_profile_snapshot(xf_osal_mutex_profile_stats_t *stats, uint32_t max_count)
+{
+    uint8_t order[XF_OSAL_MUTEX_PROFILE_NUM];
+    uint32_t count;
+    uint32_t i;
+    bool locked;
+
+    if (stats == NULL) {
+        return 0U;
+    }
+
+    locked = profile_lock();
+    count = profile_sort(order);
+    if (count > max_count) {
+        count = max_count;
+    }
+    for (i = 0U; i < count; i++) {
+        stats[i] = s_profile_table[order[i]].stats;
+    }
+    profile_unlock(locked);
+
+    return count;
+}
+
+void xf_osal_mutex_profile_report(xf_osal_mutex_profile_print_t print)
+{
+    uint8_t order[XF_OSAL_MUTEX_PROFILE_NUM];
+    xf_osal_mutex_profile_stats_t stats;
+    uint32_t count;
+    uint32_t i;
+    bool locked;
+
+    if (print == NULL) {
+        return;
+    }
+
+    locked = profile_lock();
+    count = profile_sort(order);
+    profile_unlock(locked);
+
+    print("%-16s %10s %10s %8s %12s %10s %12s %10s %-16s  (timestamp %lu Hz)\n",
+          "name", "acquire", "contended", "fail", "total_wait", "max_wait",
+          "total_hold", "max_hold", "longest_holder", (unsigned long)XF_OSAL_TRACE_TIMESTAMP_FREQ());
+
+    /* 输出期间不锁定调度器，排序后被删除的互斥锁跳过 */
+    for (i = 0U; i < count; i++) {
+        locked = profile_lock();
+        stats = s_profile_table[order[i]].stats;
+        profile_unlock(locked);
+
+        if (stats.mutex == NULL) {
+            continue;
+        }
+
+        print("%-16s %10lu %10lu %8lu %12llu %10lu %12llu %10lu %-16s\n",
+              (stats.name != NULL) ? stats.name : "-",
+              (unsigned long)stats.acquire_count, (unsigned long)stats.contended_count,
+              (unsigned long)stats.fail_count, (unsigned long long)stats.total_wait,
+              (unsigned long)stats.max_wait, (unsigned long long)stats.total_hold,
+              (unsigned long)stats.max_hold,
+              (stats.longest_holder != NULL) ? xf_osal_thread_get_name(stats.longest_holder) : "-");
+    }
+}
+
+void xf_osal_mutex_profile_reset(void)
+{
+    uint32_t i;
+    bool locked;
+
+    locked = profile_lock();
+    for (i = 0U; i < XF_OSAL_MUTEX_PROFILE_NUM; i++) {
+        if (s_profile_table[i].stats.mutex != NULL) {
+            profile_clear(&s_profile_table[i]);
+        }
+    }
+    profile_unlock(locked);
+}
+
+void xf_osal_mutex_profile_on_create(xf_osal_mutex_t mutex, const char *name)
+{
+    profile_entry_t *entry;
+    bool locked;
+
+    if (mutex == NULL) {
+        return;
+    }
+
+    locked = profile_lock();
+    entry = profile_find(NULL);
+    if (entry != NULL) {
+        memset(entry, 0, sizeof(*entry));
+        entry->stats.mutex = mutex;
+        entry->stats.name = name;
+    }
+    profile_unlock(locked);
+}
+
+void xf_osal_mutex_profile_on_delete(xf_osal_mutex_t mutex)
+{
+    profile_entry_t *entry;
+    bool locked;
+
+    if (mutex == NULL) {
+        return;
+    }
+
+    locked = profile_lock();
+    entry = profile_find(mutex);
+    if (entry != NULL) {
+        entry->stats.mutex = NULL;
+    }
+    profile_unlock(locked);
+}
+
+void xf_osal_mutex_profile_on_acquire(
+    xf_osal_mutex_t mutex, xf_osal_thread_t prev_owner, uint32_t start, uint32_t end, xf_err_t err)
+{
+    xf_osal_thread_t self = xf_osal_thread_get_current();
+    uint32_t wait = end - start;
+    profile_entry_t *entry;
+    bool locked;
+
+    if (mutex == NULL) {
+        return;
+    }
+
+    locked = profile_lock();
+    entry = profile_find(mutex);
+    if (entry == NULL) {
+        /* 未登记 */
+    } else if (err != XF_OK) {
+        entry->stats.fail_count++;
+        entry->stats.total_wait += wait;
+        if (wait > entry->stats.max_wait) {
+            entry->stats.max_wait = wait;
+        }
+    } else if ((entry->holder == self) && (entry->depth != 0U)) {
+        /* 递归获取 */
+        entry->depth++;
+    } else {
+        entry->stats.acquire_count++;
+        if ((prev_owner != NULL) && (prev_owner != self)) {
+            entry->stats.contended_count++;
+        }
+        entry->stats.total_wait += wait;
+        if (wait > entry->stats.max_wait) {
+            entry->stats.max_wait = wait;
+        }
+        entry->holder = self;
+        entry->depth = 1U;
+        entry->acquired_at = end;
+    }
+    profile_unlock(locked);
+}
+
+void xf_osal_mutex_profile_on_release(xf_osal_mutex_t mutex, uint32_t now)
+{
+    xf_osal_thread_t self = xf_osal_thread_get_current();
+    profile_entry_t *entry;
+    uint32_t hold;
+    bool locked;
+
+    if (mutex == NULL) {
+        return;
+    }
+
+    locked = profile_lock();
+    entry = profile_find(mutex);
+    if ((entry != NULL) && (entry->holder == self) && (entry->depth != 0U)) {
+        entry->depth--;
+        if (entry->depth == 0U) {
+            hold = now - entry->acquired_at;
+            entry->stats.total_hold += hold;
+            if (hold > entry->stats.max_hold) {
+                entry->stats.max_hold = hold;
+                entry->stats.longest_holder = self;
+            }
+            entry->holder = NULL;
+        }
+    }
+    profile_unlock(locked);
+}
+
+/* ==================== [Static Functions] ================================== */
+
+/**
+ * @brief 锁定调度器保护统计表。调度器未运行或已锁定时无需锁定，返回 false.
+ *
+ * 互斥锁接口不能在中断中调用，锁定调度器即可与其他线程互斥。
+ */
+static bool profile_lock(void)
+{
+    if (xf_osal_kernel_get_state() != XF_OSAL_RUNNING) {
+        return false;
+    }
+
+    return (xf_osal_kernel_lock() == XF_OK);
+}
+
+static void profile_unlock(bool locked)
+{
+    if (locked) {
+        (void)xf_osal_kernel_unlock();
+    }
+}
+
+/**
+ * @brief 查找互斥锁对应的槽位，mutex 为 NULL 时查找空闲槽位。调用时须已锁定。
+ */
+static profile_entry_t *profile_find(xf_osal_mutex_t mutex)
+{
+    uint32_t i;
+
+    for (i = 0U; i < XF_OSAL_MUTEX_PROFILE_NUM; i++) {
+        if (s_profile_table[i].stats.mutex == mutex) {
+            return &s_profile_table[i];
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief 清空统计，保留登记与当前持有状态。调用时须已锁定。
+ */
+static void profile_clear(profile_entry_t *entry)
+{
+    xf_osal_mutex_t mutex = entry->stats.mutex;
+    const char *name = entry->stats.name;
+
+    memset(&entry->stats, 0, sizeof(entry->stats));
+    entry->stats.mutex = mutex;
+    entry->stats.name = name;
+}
+
+/**
+ * @brief 已登记槽位的下标按累计等待时间从大到小写入 order, 返回个数。调用时须已锁定。
+ */
+static uint32_t profile_sort(uint8_t *order)
+{
+    uint32_t count = 0U;
+    uint32_t i;
+    uint32_t j;
+    uint8_t tmp;
+
+    for (i = 0U; i < XF_OSAL_MUTEX_PROFILE_NUM; i++) {
+        if (s_profile_table[i].stats.mutex != NULL) {
+            order[count++] = (uint8_t)i;
+        }
+    }
+
+    /* 插入排序，表很小 */
+    for (i = 1U; i < count; i++) {
+        tmp = order[i];
+        for (j = i; j > 0U; j--) {
+            if (s_profile_table[order[j - 1U]].stats.total_wait >= s_profile_table[tmp].stats.total_wait) {
+                break;
+            }
+            order[j] = order[j - 1U];
+        }
+        order[j] = tmp;
+    }
+
+    return count;
+}
+
+#endif
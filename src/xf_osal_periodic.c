@@ -0,0 +1,227 @@
+/**
+ * @file xf_osal_periodic.c
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include <string.h>
+
+#include "xf_osal.h"
+#include "xf_osal_atomic.h"
+
+#if XF_OSAL_PERIODIC_IS_ENABLE
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Static Prototypes] ================================= */
+
+static void periodic_thread(void *argument);
+static void periodic_record(xf_osal_periodic_t *periodic, uint32_t jitter, uint32_t overrun, uint32_t skipped);
+static uint32_t periodic_bucket(uint32_t jitter);
+static bool periodic_lock(void);
+static void periodic_unlock(bool locked);
+
+/* ==================== [Static Variables] ================================== */
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+xf_err_t xf_osal_periodic_create(xf_osal_periodic_t *periodic, uint32_t period,
+                                 xf_osal_periodic_func_t func, void *arg,
+                                 const xf_osal_periodic_attr_t *attr)
+{
+    if ((periodic == NULL) || (period == 0U) || (func == NULL)) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    memset(periodic, 0, sizeof(*periodic));
+    periodic->func     = func;
+    periodic->arg      = arg;
+    periodic->period   = period;
+    periodic->policy   = (attr != NULL) ? attr->policy : XF_OSAL_PERIODIC_CATCH_UP;
+    periodic->deadline = xf_osal_kernel_get_tick_count() + period;
+    periodic->running  = 1U;
+
+    periodic->thread = xf_osal_thread_create(periodic_thread, periodic, (attr != NULL) ? &attr->thread : NULL);
+    if (periodic->thread == NULL) {
+        periodic->running = 0U;
+        return XF_FAIL;
+    }
+
+    return XF_OK;
+}
+
+xf_err_t xf_osal_periodic_delete(xf_osal_periodic_t *periodic)
+{
+    if (periodic == NULL) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    xf_osal_atomic_store(&periodic->stop, 1U);
+
+    if (xf_osal_thread_get_current() == periodic->thread) {
+        /* 在回调中调用，回调返回后线程自行退出 */
+        return XF_OK;
+    }
+
+    /* 周期线程在 xf_osal_delay_until() 中阻塞时无法提前唤醒，等它下一次醒来后退出 */
+    while (xf_osal_atomic_load(&periodic->running) != 0U) {
+        xf_err_t err = xf_osal_delay(1U);
+        if (err != XF_OK) {
+            return err;
+        }
+    }
+
+    return XF_OK;
+}
+
+xf_err_t xf_osal_periodic_get_stats(xf_osal_periodic_t *periodic, xf_osal_periodic_stats_t *stats)
+{
+    bool locked;
+
+    if ((periodic == NULL) || (stats == NULL)) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    locked = periodic_lock();
+    *stats = periodic->stats;
+    periodic_unlock(locked);
+
+    return XF_OK;
+}
+
+xf_err_t xf_osal_periodic_reset_stats(xf_osal_periodic_t *periodic)
+{
+    bool locked;
+
+    if (periodic == NULL) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    locked = periodic_lock();
+    memset(&periodic->stats, 0, sizeof(periodic->stats));
+    periodic_unlock(locked);
+
+    return XF_OK;
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static void periodic_thread(void *argument)
+{
+    xf_osal_periodic_t *periodic = (xf_osal_periodic_t *)argument;
+    uint32_t skipped;
+    uint32_t overrun;
+    uint32_t jitter;
+    uint32_t late;
+    uint32_t now;
+
+    for (;;) {
+        /* 截止时刻已过时 xf_osal_delay_until() 会返回错误，此时直接执行 */
+        now = xf_osal_kernel_get_tick_count();
+        if ((int32_t)(periodic->deadline - now) > 0) {
+            (void)xf_osal_delay_until(periodic->deadline);
+            now = xf_osal_kernel_get_tick_count();
+        }
+
+        if (xf_osal_atomic_load(&periodic->stop) != 0U) {
+            break;
+        }
+
+        jitter = now - periodic->deadline;
+        periodic->func(periodic->arg);
+
+        /* 下一截止时刻只由上一截止时刻决定，不受回调耗时影响 */
+        periodic->deadline += periodic->period;
+        now = xf_osal_kernel_get_tick_count();
+        late = now - periodic->deadline;
+        overrun = 0U;
+        skipped = 0U;
+        if ((int32_t)late >= 0) {
+            overrun = 1U;
+            if (periodic->policy == XF_OSAL_PERIODIC_SKIP) {
+                /* 跳到原相位上晚于当前时刻的第一个截止时刻 */
+                skipped = (late / periodic->period) + 1U;
+                periodic->deadline += skipped * periodic->period;
+            }
+        }
+
+        periodic_record(periodic, jitter, overrun, skipped);
+    }
+
+    /* 此后不再访问 periodic, 删除者可以释放它 */
+    xf_osal_atomic_store(&periodic->running, 0U);
+    (void)xf_osal_thread_delete(NULL);
+}
+
+static void periodic_record(xf_osal_periodic_t *periodic, uint32_t jitter, uint32_t overrun, uint32_t skipped)
+{
+    xf_osal_periodic_stats_t *stats = &periodic->stats;
+    uint32_t bucket;
+    bool locked;
+
+    bucket = periodic_bucket(jitter);
+    if (bucket >= XF_OSAL_PERIODIC_JITTER_BUCKETS) {
+        bucket = XF_OSAL_PERIODIC_JITTER_BUCKETS - 1U;
+    }
+
+    locked = periodic_lock();
+    stats->run_count++;
+    stats->overrun_count += overrun;
+    stats->skip_count += skipped;
+    if (jitter > stats->max_jitter) {
+        stats->max_jitter = jitter;
+    }
+    stats->jitter_hist[bucket]++;
+    periodic_unlock(locked);
+}
+
+/**
+ * @brief 抖动所在的桶：0 -> 0, [2^(i-1), 2^i - 1] -> i.
+ */
+static uint32_t periodic_bucket(uint32_t jitter)
+{
+#if defined(__GNUC__)
+    return (jitter == 0U) ? 0U : (32U - (uint32_t)__builtin_clz(jitter));
+#else
+    uint32_t bucket = 0U;
+
+    while (jitter != 0U) {
+        jitter >>= 1;
+        bucket++;
+    }
+
+    return bucket;
+#endif
+}
+
+/**
+ * @brief 锁定调度器保护统计信息。调度器未运行或已锁定时无需锁定，返回 false.
+ */
+static bool periodic_lock(void)
+{
+    if (xf_osal_kernel_get_state() != XF_OSAL_RUNNING) {
+        return false;
+    }
+
+    return (xf_osal_kernel_lock() == XF_OK);
+}
+
+static void periodic_unlock(bool locked)
+{
+    if (locked) {
+        (void)xf_osal_kernel_unlock();
+    }
+}
+
+#endif
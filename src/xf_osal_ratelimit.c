@@ -0,0 +1,181 @@
+/**
+ * @file xf_osal_ratelimit.c
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_osal.h"
+#include "xf_osal_atomic.h"
+
+#if XF_OSAL_RATELIMIT_IS_ENABLE
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Static Prototypes] ================================= */
+
+static uint32_t ratelimit_gcd(uint32_t a, uint32_t b);
+static uint32_t ratelimit_offset(const xf_osal_ratelimit_t *ratelimit, uint32_t tat, uint32_t now);
+static uint32_t ratelimit_take(xf_osal_ratelimit_t *ratelimit, uint32_t cost, uint32_t now);
+
+/* ==================== [Static Variables] ================================== */
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+xf_err_t xf_osal_ratelimit_init(xf_osal_ratelimit_t *ratelimit, uint32_t rate, uint32_t burst)
+{
+    uint32_t freq;
+    uint32_t gcd;
+    uint64_t tolerance;
+
+    freq = xf_osal_kernel_get_tick_freq();
+    if ((ratelimit == NULL) || (rate == 0U) || (burst == 0U) || (freq == 0U)) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    /* 一个 tick 为 rate 个单位、一个令牌为 freq 个单位，约去公因数使回绕周期尽量长 */
+    gcd = ratelimit_gcd(rate, freq);
+    tolerance = (uint64_t)burst * (freq / gcd);
+    if (tolerance > (uint64_t)INT32_MAX) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    ratelimit->tick_units  = rate / gcd;
+    ratelimit->token_units = freq / gcd;
+    ratelimit->tolerance   = (uint32_t)tolerance;
+    ratelimit->burst       = burst;
+    xf_osal_atomic_store(&ratelimit->tat, xf_osal_kernel_get_tick_count() * ratelimit->tick_units);
+
+    return XF_OK;
+}
+
+xf_err_t xf_osal_ratelimit_try_acquire(xf_osal_ratelimit_t *ratelimit, uint32_t tokens)
+{
+    uint32_t now;
+
+    if ((ratelimit == NULL) || (tokens > ratelimit->burst)) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    now = xf_osal_kernel_get_tick_count() * ratelimit->tick_units;
+    if (ratelimit_take(ratelimit, tokens * ratelimit->token_units, now) != 0U) {
+        return XF_ERR_RESOURCE;
+    }
+
+    return XF_OK;
+}
+
+xf_err_t xf_osal_ratelimit_acquire(xf_osal_ratelimit_t *ratelimit, uint32_t tokens, uint32_t timeout)
+{
+    uint32_t start;
+    uint32_t tick;
+    uint32_t cost;
+    uint32_t wait_units;
+    uint32_t wait_ticks;
+    xf_err_t err;
+
+    if ((ratelimit == NULL) || (tokens > ratelimit->burst)) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    cost = tokens * ratelimit->token_units;
+    start = xf_osal_kernel_get_tick_count();
+    tick = start;
+
+    for (;;) {
+        wait_units = ratelimit_take(ratelimit, cost, tick * ratelimit->tick_units);
+        if (wait_units == 0U) {
+            return XF_OK;
+        }
+
+        if (timeout == 0U) {
+            return XF_ERR_RESOURCE;
+        }
+
+        /* 恰好休眠到令牌积攒够的 tick, 超时前肯定积攒不够时不再空等 */
+        wait_ticks = (wait_units + ratelimit->tick_units - 1U) / ratelimit->tick_units;
+        if ((timeout != XF_OSAL_WAIT_FOREVER) && ((uint64_t)(tick - start) + wait_ticks > timeout)) {
+            return XF_ERR_TIMEOUT;
+        }
+
+        err = xf_osal_delay(wait_ticks);
+        if (err != XF_OK) {
+            return err;
+        }
+
+        tick = xf_osal_kernel_get_tick_count();
+    }
+}
+
+uint32_t xf_osal_ratelimit_get_available(xf_osal_ratelimit_t *ratelimit)
+{
+    uint32_t now;
+    uint32_t offset;
+
+    if (ratelimit == NULL) {
+        return 0U;
+    }
+
+    now = xf_osal_kernel_get_tick_count() * ratelimit->tick_units;
+    offset = ratelimit_offset(ratelimit, xf_osal_atomic_load(&ratelimit->tat), now);
+
+    return (ratelimit->tolerance - offset) / ratelimit->token_units;
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static uint32_t ratelimit_gcd(uint32_t a, uint32_t b)
+{
+    uint32_t t;
+
+    while (b != 0U) {
+        t = a % b;
+        a = b;
+        b = t;
+    }
+
+    return a;
+}
+
+/**
+ * @brief 理论时刻超前当前时刻的单位数，即已取用但尚未补回的令牌量。
+ *
+ * 成功获取后超前量不会超过 tolerance, 此后只会随时间减小；
+ * 落后于当前时刻（桶已满）或超前量不合法（长时间空闲后计数回绕）时都视为桶满。
+ */
+static uint32_t ratelimit_offset(const xf_osal_ratelimit_t *ratelimit, uint32_t tat, uint32_t now)
+{
+    uint32_t offset = tat - now;
+
+    return (offset > ratelimit->tolerance) ? 0U : offset;
+}
+
+/**
+ * @brief 取走 cost 个单位的令牌。成功返回 0, 否则返回还需等待的单位数。
+ */
+static uint32_t ratelimit_take(xf_osal_ratelimit_t *ratelimit, uint32_t cost, uint32_t now)
+{
+    uint32_t old = xf_osal_atomic_load(&ratelimit->tat);
+    uint32_t offset;
+
+    do {
+        offset = ratelimit_offset(ratelimit, old, now);
+        if (cost > ratelimit->tolerance - offset) {
+            return offset - (ratelimit->tolerance - cost);
+        }
+    } while (!xf_osal_atomic_cas(&ratelimit->tat, &old, now + offset + cost));
+
+    return 0U;
+}
+
+#endif
@@ -0,0 +1,232 @@
+/**
+ * @file xf_osal_sched.c
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_osal.h"
+
+#if XF_OSAL_SCHED_IS_ENABLE
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Static Prototypes] ================================= */
+
+static uint32_t sched_deadline(const xf_osal_sched_task_t *task);
+static uint32_t sched_wcet(const xf_osal_sched_task_t *task);
+static uint32_t sched_rank(const xf_osal_sched_task_t *tasks, uint32_t count, uint32_t index);
+static uint32_t sched_levels(xf_osal_priority_t prio_low, xf_osal_priority_t prio_high, xf_osal_priority_t *level);
+static uint32_t sched_response(const xf_osal_sched_task_t *tasks, uint32_t count, uint32_t index);
+
+/* ==================== [Static Variables] ================================== */
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+xf_err_t xf_osal_sched_analyze(xf_osal_sched_task_t *tasks, uint32_t count,
+                               xf_osal_priority_t prio_low, xf_osal_priority_t prio_high, bool apply)
+{
+    xf_osal_priority_t level[XF_OSAL_PRIORITY_ISR];
+    xf_err_t err = XF_OK;
+    uint32_t levels;
+    uint32_t rank;
+    uint32_t i;
+
+    if ((tasks == NULL) || (count == 0U) || (prio_low < XF_OSAL_PRIORITY_LOW)
+            || (prio_high >= XF_OSAL_PRIORITY_ISR) || (prio_low > prio_high)) {
+        return XF_ERR_INVALID_ARG;
+    }
+
+    for (i = 0U; i < count; i++) {
+        if (tasks[i].period == 0U) {
+            return XF_ERR_INVALID_ARG;
+        }
+    }
+
+    /* 截止时间单调：按截止时间从短到长依次分配，优先级不够时相邻线程共用 */
+    levels = sched_levels(prio_low, prio_high, level);
+    for (i = 0U; i < count; i++) {
+        rank = sched_rank(tasks, count, i);
+        if (count > levels) {
+            rank = (uint32_t)(((uint64_t)rank * levels) / count);
+        }
+        tasks[i].priority = level[rank];
+    }
+
+    for (i = 0U; i < count; i++) {
+        tasks[i].response = sched_response(tasks, count, i);
+        tasks[i].schedulable = (tasks[i].response <= sched_deadline(&tasks[i]));
+        if (!tasks[i].schedulable) {
+            err = XF_FAIL;
+        }
+    }
+
+    if (apply) {
+        for (i = 0U; i < count; i++) {
+            if (tasks[i].thread != NULL) {
+                (void)xf_osal_thread_set_priority(tasks[i].thread, tasks[i].priority);
+            }
+        }
+    }
+
+    return err;
+}
+
+void xf_osal_sched_exec_begin(xf_osal_sched_task_t *task)
+{
+    if (task == NULL) {
+        return;
+    }
+
+    task->exec_start = XF_OSAL_SCHED_TIMESTAMP();
+}
+
+void xf_osal_sched_exec_end(xf_osal_sched_task_t *task)
+{
+    uint32_t elapsed;
+
+    if (task == NULL) {
+        return;
+    }
+
+    elapsed = (uint32_t)XF_OSAL_SCHED_TIMESTAMP() - task->exec_start;
+    if (elapsed > task->observed_wcet) {
+        task->observed_wcet = elapsed;
+    }
+    task->exec_count++;
+}
+
+void xf_osal_sched_report(const xf_osal_sched_task_t *tasks, uint32_t count, xf_osal_sched_print_t print)
+{
+    uint64_t utilization = 0U;
+    uint32_t i;
+
+    if ((tasks == NULL) || (print == NULL)) {
+        return;
+    }
+
+    print("%-16s %10s %10s %10s %10s %5s %10s %s\n",
+          "name", "period", "deadline", "wcet", "observed", "prio", "response", "ok");
+
+    for (i = 0U; i < count; i++) {
+        print("%-16s %10lu %10lu %10lu %10lu %5d %10lu %s\n",
+              (tasks[i].name != NULL) ? tasks[i].name : "-",
+              (unsigned long)tasks[i].period, (unsigned long)sched_deadline(&tasks[i]),
+              (unsigned long)tasks[i].wcet, (unsigned long)tasks[i].observed_wcet,
+              (int)tasks[i].priority, (unsigned long)tasks[i].response,
+              tasks[i].schedulable ? "yes" : "NO");
+        if (tasks[i].period != 0U) {
+            utilization += ((uint64_t)sched_wcet(&tasks[i]) * 1000U) / tasks[i].period;
+        }
+    }
+
+    print("utilization %lu.%lu%%\n", (unsigned long)(utilization / 10U), (unsigned long)(utilization % 10U));
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static uint32_t sched_deadline(const xf_osal_sched_task_t *task)
+{
+    return (task->deadline != 0U) ? task->deadline : task->period;
+}
+
+/**
+ * @brief 分析使用的执行时间：预估值与实测值中较大者。
+ */
+static uint32_t sched_wcet(const xf_osal_sched_task_t *task)
+{
+    return (task->observed_wcet > task->wcet) ? task->observed_wcet : task->wcet;
+}
+
+/**
+ * @brief 截止时间更短（相同时周期更短，再相同时下标更小）的线程个数，即从 0 开始的排名。
+ */
+static uint32_t sched_rank(const xf_osal_sched_task_t *tasks, uint32_t count, uint32_t index)
+{
+    uint32_t deadline = sched_deadline(&tasks[index]);
+    uint32_t rank = 0U;
+    uint32_t other;
+    uint32_t i;
+
+    for (i = 0U; i < count; i++) {
+        if (i == index) {
+            continue;
+        }
+        other = sched_deadline(&tasks[i]);
+        if ((other < deadline)
+                || ((other == deadline) && (tasks[i].period < tasks[index].period))
+                || ((other == deadline) && (tasks[i].period == tasks[index].period) && (i < index))) {
+            rank++;
+        }
+    }
+
+    return rank;
+}
+
+/**
+ * @brief 区间内实际可区分的优先级，按从高到低写入 level, 返回个数。
+ *
+ * 对接层映射后落在同一 RTOS 优先级上的 xf_osal 优先级只取最高的一个。
+ */
+static uint32_t sched_levels(xf_osal_priority_t prio_low, xf_osal_priority_t prio_high, xf_osal_priority_t *level)
+{
+    xf_osal_priority_t effective;
+    xf_osal_priority_t last = XF_OSAL_PRIORITY_ERROR;
+    uint32_t levels = 0U;
+    int32_t prio;
+
+    for (prio = (int32_t)prio_high; prio >= (int32_t)prio_low; prio--) {
+        effective = xf_osal_thread_get_effective_priority((xf_osal_priority_t)prio);
+        if ((levels == 0U) || (effective != last)) {
+            level[levels] = (xf_osal_priority_t)prio;
+            levels++;
+            last = effective;
+        }
+    }
+
+    return levels;
+}
+
+/**
+ * @brief 迭代计算最坏响应时间，超过截止时间时返回当前迭代值。
+ */
+static uint32_t sched_response(const xf_osal_sched_task_t *tasks, uint32_t count, uint32_t index)
+{
+    uint64_t deadline = sched_deadline(&tasks[index]);
+    uint64_t response = sched_wcet(&tasks[index]);
+    xf_osal_priority_t prio = xf_osal_thread_get_effective_priority(tasks[index].priority);
+    uint64_t next;
+    uint32_t i;
+
+    for (;;) {
+        next = sched_wcet(&tasks[index]);
+        for (i = 0U; i < count; i++) {
+            /* 按实际生效的优先级比较，映射到同一 RTOS 优先级的线程互相计入干扰 */
+            if ((i == index) || (xf_osal_thread_get_effective_priority(tasks[i].priority) < prio)) {
+                continue;
+            }
+            /* 每个更高（或相同）优先级线程在 response 内最多到达 ceil(response / T) 次 */
+            next += ((response + tasks[i].period - 1U) / tasks[i].period) * sched_wcet(&tasks[i]);
+        }
+
+        if ((next == response) || (next > deadline)) {
+            response = next;
+            break;
+        }
+        response = next;
+    }
+
+    return (response > UINT32_MAX) ? UINT32_MAX : (uint32_t)response;
+}
+
+#endif
@@ -0,0 +1,530 @@
+/**
+ * @file xf_osal_trace.c
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include <string.h>
+
+/* 本文件调用原接口，不重定向到包装函数 */
+#define XF_OSAL_TRACE_SOURCE
+
+#include "xf_osal.h"
+#include "xf_osal_atomic.h"
+
+#if XF_OSAL_TRACE_WRAP_IS_ENABLE
+
+/* ==================== [Defines] =========================================== */
+
+#if XF_OSAL_TRACE_IS_ENABLE
+
+#if ((XF_OSAL_TRACE_RING_SIZE) == 0U) || (((XF_OSAL_TRACE_RING_SIZE) & ((XF_OSAL_TRACE_RING_SIZE) - 1U)) != 0U)
+#error "XF_OSAL_TRACE_RING_SIZE must be a power of 2"
+#endif
+
+#define TRACE_CALIBRATE_ROUNDS  (16U)
+
+#endif
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Static Prototypes] ================================= */
+
+static xf_err_t trace_record(xf_osal_trace_op_t op, const void *obj, uint32_t start, xf_err_t err);
+#if XF_OSAL_TRACE_IS_ENABLE
+static void trace_write(xf_osal_trace_op_t op, const void *obj, uint32_t start, uint32_t end, xf_err_t err);
+#endif
+#if XF_OSAL_LATENCY_IS_ENABLE
+static bool trace_is_blocking(xf_osal_trace_op_t op);
+#endif
+
+/* ==================== [Static Variables] ================================== */
+
+#if XF_OSAL_TRACE_IS_ENABLE
+static xf_osal_trace_buf_t s_trace_buf = {
+    .magic = XF_OSAL_TRACE_MAGIC,
+    .version = XF_OSAL_TRACE_VERSION,
+    .event_size = sizeof(xf_osal_trace_event_t),
+    .core_num = XF_OSAL_TRACE_CORE_NUM,
+    .ring_size = XF_OSAL_TRACE_RING_SIZE,
+};
+
+static volatile uint8_t s_trace_running = 0U;
+#endif
+
+/* ==================== [Macros] ============================================ */
+
+#define TRACE_BEGIN()           XF_OSAL_TRACE_TIMESTAMP()
+
+/* ==================== [Global Functions] ================================== */
+
+#if XF_OSAL_TRACE_IS_ENABLE
+void xf_osal_trace_start(void)
+{
+    s_trace_buf.timestamp_freq = XF_OSAL_TRACE_TIMESTAMP_FREQ();
+    xf_osal_atomic_store(&s_trace_running, 1U);
+}
+
+void xf_osal_trace_stop(void)
+{
+    xf_osal_atomic_store(&s_trace_running, 0U);
+}
+
+void xf_osal_trace_reset(void)
+{
+    uint32_t i;
+
+    for (i = 0U; i < XF_OSAL_TRACE_CORE_NUM; i++) {
+        memset(s_trace_buf.rings[i].events, 0, sizeof(s_trace_buf.rings[i].events));
+        xf_osal_atomic_store(&s_trace_buf.rings[i].head, 0U);
+    }
+}
+
+uint32_t xf_osal_trace_calibrate(void)
+{
+    uint8_t running = s_trace_running;
+    uint32_t total = 0U;
+    uint32_t start;
+    uint32_t i;
+
+    s_trace_running = 1U;
+    for (i = 0U; i < TRACE_CALIBRATE_ROUNDS; i++) {
+        start = XF_OSAL_TRACE_TIMESTAMP();
+        (void)trace_record(XF_OSAL_TRACE_OP_CALIBRATE, NULL, start, XF_OK);
+        total += XF_OSAL_TRACE_TIMESTAMP() - start;
+    }
+    s_trace_running = running;
+
+    s_trace_buf.overhead = total / TRACE_CALIBRATE_ROUNDS;
+
+    return s_trace_buf.overhead;
+}
+
+const xf_osal_trace_buf_t *xf_osal_trace_get_buffer(uint32_t *size)
+{
+    if (size != NULL) {
+        *size = sizeof(s_trace_buf);
+    }
+
+    return &s_trace_buf;
+}
+#endif
+
+#if XF_OSAL_THREAD_IS_ENABLE
+xf_err_t xf_osal_trace_thread_yield(void)
+{
+    uint32_t start = TRACE_BEGIN();
+    return trace_record(XF_OSAL_TRACE_OP_THREAD_YIELD, NULL, start, (xf_osal_thread_yield)());
+}
+
+xf_err_t xf_osal_trace_thread_suspend(xf_osal_thread_t thread)
+{
+    uint32_t start = TRACE_BEGIN();
+    return trace_record(XF_OSAL_TRACE_OP_THREAD_SUSPEND, thread, start, (xf_osal_thread_suspend)(thread));
+}
+
+xf_err_t xf_osal_trace_thread_resume(xf_osal_thread_t thread)
+{
+    uint32_t start = TRACE_BEGIN();
+    return trace_record(XF_OSAL_TRACE_OP_THREAD_RESUME, thread, start, (xf_osal_thread_resume)(thread));
+}
+
+xf_err_t xf_osal_trace_thread_notify_set(xf_osal_thread_t thread, uint32_t notify)
+{
+    uint32_t start = TRACE_BEGIN();
+    return trace_record(XF_OSAL_TRACE_OP_THREAD_NOTIFY_SET, thread, start,
+                        (xf_osal_thread_notify_set)(thread, notify));
+}
+
+xf_err_t xf_osal_trace_thread_notify_set_from_isr(xf_osal_thread_t thread, uint32_t notify)
+{
+    uint32_t start = TRACE_BEGIN();
+    return trace_record(XF_OSAL_TRACE_OP_THREAD_NOTIFY_SET_FROM_ISR, thread, start,
+                        (xf_osal_thread_notify_set_from_isr)(thread, notify));
+}
+
+xf_err_t xf_osal_trace_thread_notify_wait(uint32_t notify, uint32_t options, uint32_t timeout)
+{
+    uint32_t start = TRACE_BEGIN();
+    return trace_record(XF_OSAL_TRACE_OP_THREAD_NOTIFY_WAIT, NULL, start,
+                        (xf_osal_thread_notify_wait)(notify, options, timeout));
+}
+
+xf_err_t xf_osal_trace_delay(uint32_t ticks)
+{
+    uint32_t start = TRACE_BEGIN();
+    return trace_record(XF_OSAL_TRACE_OP_DELAY, NULL, start, (xf_osal_delay)(ticks));
+}
+
+xf_err_t xf_osal_trace_delay_until(uint32_t ticks)
+{
+    uint32_t start = TRACE_BEGIN();
+    return trace_record(XF_OSAL_TRACE_OP_DELAY_UNTIL, NULL, start, (xf_osal_delay_until)(ticks));
+}
+
+xf_err_t xf_osal_trace_delay_ms(uint32_t ms)
+{
+    uint32_t start = TRACE_BEGIN();
+    return trace_record(XF_OSAL_TRACE_OP_DELAY_MS, NULL, start, (xf_osal_delay_ms)(ms));
+}
+#endif
+
+#if XF_OSAL_TIMER_IS_ENABLE
+xf_err_t xf_osal_trace_timer_start(xf_osal_timer_t timer, uint32_t ticks)
+{
+    uint32_t start = TRACE_BEGIN();
+    return trace_record(XF_OSAL_TRACE_OP_TIMER_START, timer, start, (xf_osal_timer_start)(timer, ticks));
+}
+
+xf_err_t xf_osal_trace_timer_stop(xf_osal_timer_t timer)
+{
+    uint32_t start = TRACE_BEGIN();
+    return trace_record(XF_OSAL_TRACE_OP_TIMER_STOP, timer, start, (xf_osal_timer_stop)(timer));
+}
+#endif
+
+#if XF_OSAL_EVENT_IS_ENABLE
+xf_err_t xf_osal_trace_event_set(xf_osal_event_t event, uint32_t flags)
+{
+    uint32_t start = TRACE_BEGIN();
+    return trace_record(XF_OSAL_TRACE_OP_EVENT_SET, event, start, (xf_osal_event_set)(event, flags));
+}
+
+xf_err_t xf_osal_trace_event_set_from_isr(xf_osal_event_t event, uint32_t flags)
+{
+    uint32_t start = TRACE_BEGIN();
+    return trace_record(XF_OSAL_TRACE_OP_EVENT_SET_FROM_ISR, event, start,
+                        (xf_osal_event_set_from_isr)(event, flags));
+}
+
+xf_err_t xf_osal_trace_event_clear(xf_osal_event_t event, uint32_t flags)
+{
+    uint32_t start = TRACE_BEGIN();
+    return trace_record(XF_OSAL_TRACE_OP_EVENT_CLEAR, event, start, (xf_osal_event_clear)(event, flags));
+}
+
+xf_err_t xf_osal_trace_event_wait(xf_osal_event_t event, uint32_t flags, uint32_t options, uint32_t timeout)
+{
+    uint32_t start = TRACE_BEGIN();
+    return trace_record(XF_OSAL_TRACE_OP_EVENT_WAIT, event, start,
+                        (xf_osal_event_wait)(event, flags, options, timeout));
+}
+#endif
+
+#if XF_OSAL_MUTEX_IS_ENABLE
+xf_err_t xf_osal_trace_mutex_acquire(xf_osal_mutex_t mutex, uint32_t timeout)
+{
+#if XF_OSAL_MUTEX_PROFILE_IS_ENABLE
+    xf_osal_thread_t owner = xf_osal_mutex_get_owner(mutex);
+#endif
+    uint32_t start = TRACE_BEGIN();
+    xf_err_t err = (xf_osal_mutex_acquire)(mutex, timeout);
+
+#if XF_OSAL_MUTEX_PROFILE_IS_ENABLE
+    xf_osal_mutex_profile_on_acquire(mutex, owner, start, XF_OSAL_TRACE_TIMESTAMP(), err);
+#endif
+
+    return trace_record(XF_OSAL_TRACE_OP_MUTEX_ACQUIRE, mutex, start, err);
+}
+
+xf_err_t xf_osal_trace_mutex_release(xf_osal_mutex_t mutex)
+{
+    uint32_t start = TRACE_BEGIN();
+
+#if XF_OSAL_MUTEX_PROFILE_IS_ENABLE
+    xf_osal_mutex_profile_on_release(mutex, start);
+#endif
+
+    return trace_record(XF_OSAL_TRACE_OP_MUTEX_RELEASE, mutex, start, (xf_osal_mutex_release)(mutex));
+}
+#endif
+
+#if XF_OSAL_MUTEX_PROFILE_IS_ENABLE
+xf_osal_mutex_t xf_osal_trace_mutex_create(const xf_osal_mutex_attr_t *attr)
+{
+    xf_osal_mutex_t mutex = (xf_osal_mutex_create)(attr);
+
+    xf_osal_mutex_profile_on_create(mutex, (attr != NULL) ? attr->name : NULL);
+
+    return mutex;
+}
+
+xf_err_t xf_osal_trace_mutex_delete(xf_osal_mutex_t mutex)
+{
+    xf_err_t err = (xf_osal_mutex_delete)(mutex);
+
+    if (err == XF_OK) {
+        xf_osal_mutex_profile_on_delete(mutex);
+    }
+
+    return err;
+}
+#endif
+
+#if XF_OSAL_SEMAPHORE_IS_ENABLE
+xf_err_t xf_osal_trace_semaphore_acquire(xf_osal_semaphore_t semaphore, uint32_t timeout)
+{
+    uint32_t start = TRACE_BEGIN();
+    return trace_record(XF_OSAL_TRACE_OP_SEMAPHORE_ACQUIRE, semaphore, start,
+                        (xf_osal_semaphore_acquire)(semaphore, timeout));
+}
+
+xf_err_t xf_osal_trace_semaphore_release(xf_osal_semaphore_t semaphore)
+{
+    uint32_t start = TRACE_BEGIN();
+    return trace_record(XF_OSAL_TRACE_OP_SEMAPHORE_RELEASE, semaphore, start,
+                        (xf_osal_semaphore_release)(semaphore));
+}
+
+xf_err_t xf_osal_trace_semaphore_acquire_from_isr(xf_osal_semaphore_t semaphore)
+{
+    uint32_t start = TRACE_BEGIN();
+    return trace_record(XF_OSAL_TRACE_OP_SEMAPHORE_ACQUIRE_FROM_ISR, semaphore, start,
+                        (xf_osal_semaphore_acquire_from_isr)(semaphore));
+}
+
+xf_err_t xf_osal_trace_semaphore_release_from_isr(xf_osal_semaphore_t semaphore)
+{
+    uint32_t start = TRACE_BEGIN();
+    return trace_record(XF_OSAL_TRACE_OP_SEMAPHORE_RELEASE_FROM_ISR, semaphore, start,
+                        (xf_osal_semaphore_release_from_isr)(semaphore));
+}
+
+xf_err_t xf_osal_trace_semaphore_acquire_n(xf_osal_semaphore_t semaphore, uint32_t n, uint32_t timeout)
+{
+    uint32_t start = TRACE_BEGIN();
+    return trace_record(XF_OSAL_TRACE_OP_SEMAPHORE_ACQUIRE_N, semaphore, start,
+                        (xf_osal_semaphore_acquire_n)(semaphore, n, timeout));
+}
+
+xf_err_t xf_osal_trace_semaphore_release_n(xf_osal_semaphore_t semaphore, uint32_t n)
+{
+    uint32_t start = TRACE_BEGIN();
+    return trace_record(XF_OSAL_TRACE_OP_SEMAPHORE_RELEASE_N, semaphore, start,
+                        (xf_osal_semaphore_release_n)(semaphore, n));
+}
+#endif
+
+#if XF_OSAL_QUEUE_IS_ENABLE
+xf_err_t xf_osal_trace_queue_put(xf_osal_queue_t queue, const void *msg_ptr, uint8_t msg_prio, uint32_t timeout)
+{
+    uint32_t start = TRACE_BEGIN();
+    return trace_record(XF_OSAL_TRACE_OP_QUEUE_PUT, queue, start,
+                        (xf_osal_queue_put)(queue, msg_ptr, msg_prio, timeout));
+}
+
+xf_err_t xf_osal_trace_queue_get(xf_osal_queue_t queue, void *msg_ptr, uint8_t *msg_prio, uint32_t timeout)
+{
+    uint32_t start = TRACE_BEGIN();
+    return trace_record(XF_OSAL_TRACE_OP_QUEUE_GET, queue, start,
+                        (xf_osal_queue_get)(queue, msg_ptr, msg_prio, timeout));
+}
+
+xf_err_t xf_osal_trace_queue_put_from_isr(xf_osal_queue_t queue, const void *msg_ptr, uint8_t msg_prio)
+{
+    uint32_t start = TRACE_BEGIN();
+    return trace_record(XF_OSAL_TRACE_OP_QUEUE_PUT_FROM_ISR, queue, start,
+                        (xf_osal_queue_put_from_isr)(queue, msg_ptr, msg_prio));
+}
+
+xf_err_t xf_osal_trace_queue_get_from_isr(xf_osal_queue_t queue, void *msg_ptr, uint8_t *msg_prio)
+{
+    uint32_t start = TRACE_BEGIN();
+    return trace_record(XF_OSAL_TRACE_OP_QUEUE_GET_FROM_ISR, queue, start,
+                        (xf_osal_queue_get_from_isr)(queue, msg_ptr, msg_prio));
+}
+
+xf_err_t xf_osal_trace_queue_peek(xf_osal_queue_t queue, void *msg_ptr, uint32_t timeout)
+{
+    uint32_t start = TRACE_BEGIN();
+    return trace_record(XF_OSAL_TRACE_OP_QUEUE_PEEK, queue, start, (xf_osal_queue_peek)(queue, msg_ptr, timeout));
+}
+#endif
+
+#if XF_OSAL_COND_IS_ENABLE
+xf_err_t xf_osal_trace_cond_wait(xf_osal_cond_t cond, xf_osal_mutex_t mutex)
+{
+    uint32_t start = TRACE_BEGIN();
+    xf_err_t err;
+#if XF_OSAL_MUTEX_PROFILE_IS_ENABLE
+    uint32_t now;
+
+    /* 等待期间互斥锁被释放，不计入持有时间 */
+    xf_osal_mutex_profile_on_release(mutex, start);
+#endif
+
+    err = (xf_osal_cond_wait)(cond, mutex);
+
+#if XF_OSAL_MUTEX_PROFILE_IS_ENABLE
+    now = XF_OSAL_TRACE_TIMESTAMP();
+    xf_osal_mutex_profile_on_acquire(mutex, NULL, now, now, XF_OK);
+#endif
+
+    return trace_record(XF_OSAL_TRACE_OP_COND_WAIT, cond, start, err);
+}
+
+xf_err_t xf_osal_trace_cond_timedwait(xf_osal_cond_t cond, xf_osal_mutex_t mutex, uint32_t timeout)
+{
+    uint32_t start = TRACE_BEGIN();
+    xf_err_t err;
+#if XF_OSAL_MUTEX_PROFILE_IS_ENABLE
+    uint32_t now;
+
+    xf_osal_mutex_profile_on_release(mutex, start);
+#endif
+
+    err = (xf_osal_cond_timedwait)(cond, mutex, timeout);
+
+#if XF_OSAL_MUTEX_PROFILE_IS_ENABLE
+    now = XF_OSAL_TRACE_TIMESTAMP();
+    xf_osal_mutex_profile_on_acquire(mutex, NULL, now, now, XF_OK);
+#endif
+
+    return trace_record(XF_OSAL_TRACE_OP_COND_TIMEDWAIT, cond, start, err);
+}
+
+xf_err_t xf_osal_trace_cond_signal(xf_osal_cond_t cond)
+{
+    uint32_t start = TRACE_BEGIN();
+    return trace_record(XF_OSAL_TRACE_OP_COND_SIGNAL, cond, start, (xf_osal_cond_signal)(cond));
+}
+
+xf_err_t xf_osal_trace_cond_broadcast(xf_osal_cond_t cond)
+{
+    uint32_t start = TRACE_BEGIN();
+    return trace_record(XF_OSAL_TRACE_OP_COND_BROADCAST, cond, start, (xf_osal_cond_broadcast)(cond));
+}
+#endif
+
+#if XF_OSAL_MSGBUF_IS_ENABLE
+xf_err_t xf_osal_trace_msgbuf_send(xf_osal_msgbuf_t msgbuf, const void *msg_ptr, uint32_t msg_len, uint32_t timeout)
+{
+    uint32_t start = TRACE_BEGIN();
+    return trace_record(XF_OSAL_TRACE_OP_MSGBUF_SEND, msgbuf, start,
+                        (xf_osal_msgbuf_send)(msgbuf, msg_ptr, msg_len, timeout));
+}
+
+xf_err_t xf_osal_trace_msgbuf_receive(
+    xf_osal_msgbuf_t msgbuf, void *buf, uint32_t buf_size, uint32_t *msg_len, uint32_t timeout)
+{
+    uint32_t start = TRACE_BEGIN();
+    return trace_record(XF_OSAL_TRACE_OP_MSGBUF_RECEIVE, msgbuf, start,
+                        (xf_osal_msgbuf_receive)(msgbuf, buf, buf_size, msg_len, timeout));
+}
+#endif
+
+#if XF_OSAL_STREAMBUF_IS_ENABLE
+xf_err_t xf_osal_trace_streambuf_send(
+    xf_osal_streambuf_t streambuf, const void *data, uint32_t len, uint32_t *sent, uint32_t timeout)
+{
+    uint32_t start = TRACE_BEGIN();
+    return trace_record(XF_OSAL_TRACE_OP_STREAMBUF_SEND, streambuf, start,
+                        (xf_osal_streambuf_send)(streambuf, data, len, sent, timeout));
+}
+
+xf_err_t xf_osal_trace_streambuf_receive(
+    xf_osal_streambuf_t streambuf, void *buf, uint32_t buf_size, uint32_t *received, uint32_t timeout)
+{
+    uint32_t start = TRACE_BEGIN();
+    return trace_record(XF_OSAL_TRACE_OP_STREAMBUF_RECEIVE, streambuf, start,
+                        (xf_osal_streambuf_receive)(streambuf, buf, buf_size, received, timeout));
+}
+#endif
+
+#if XF_OSAL_SELECT_IS_ENABLE
+xf_err_t xf_osal_trace_select(xf_osal_select_t select, void **ready, uint32_t timeout)
+{
+    uint32_t start = TRACE_BEGIN();
+    return trace_record(XF_OSAL_TRACE_OP_SELECT, select, start, (xf_osal_select)(select, ready, timeout));
+}
+#endif
+
+/* ==================== [Static Functions] ================================== */
+
+/**
+ * @brief 记录一次调用并原样返回 err.
+ */
+static xf_err_t trace_record(xf_osal_trace_op_t op, const void *obj, uint32_t start, xf_err_t err)
+{
+#if XF_OSAL_TRACE_IS_ENABLE || XF_OSAL_LATENCY_IS_ENABLE
+    uint32_t end = XF_OSAL_TRACE_TIMESTAMP();
+#else
+    /* 只开启互斥锁竞争分析时，统计在包装函数中完成 */
+    (void)op;
+    (void)obj;
+    (void)start;
+#endif
+
+#if XF_OSAL_LATENCY_IS_ENABLE
+    if (trace_is_blocking(op)) {
+        xf_osal_latency_record(obj, end - start);
+    }
+#endif
+
+#if XF_OSAL_TRACE_IS_ENABLE
+    if (s_trace_running != 0U) {
+        trace_write(op, obj, start, end, err);
+    }
+#endif
+
+    return err;
+}
+
+#if XF_OSAL_TRACE_IS_ENABLE
+/**
+ * @brief 写入一条记录。
+ *
+ * 通过原子加预留槽位，多个线程或中断同时写入同一个环形缓冲区时互不覆盖；
+ * 环形缓冲区满后覆盖最旧的记录。
+ */
+static void trace_write(xf_osal_trace_op_t op, const void *obj, uint32_t start, uint32_t end, xf_err_t err)
+{
+    xf_osal_trace_ring_t *ring;
+    xf_osal_trace_event_t *ev;
+    uint32_t idx;
+
+    ring = &s_trace_buf.rings[XF_OSAL_TRACE_CORE_ID()];
+    idx = xf_osal_atomic_fetch_add(&ring->head, 1U) & (XF_OSAL_TRACE_RING_SIZE - 1U);
+    ev = &ring->events[idx];
+
+    ev->timestamp = start;
+    ev->duration = end - start;
+#if XF_OSAL_THREAD_IS_ENABLE
+    ev->thread = (uint32_t)(uintptr_t)xf_osal_thread_get_current();
+#else
+    ev->thread = 0U;
+#endif
+    ev->obj = (uint32_t)(uintptr_t)obj;
+    ev->op = (uint16_t)op;
+    ev->result = (int16_t)err;
+}
+#endif
+
+#if XF_OSAL_LATENCY_IS_ENABLE
+/**
+ * @brief 计入阻塞时间直方图的操作，见 xf_osal_latency.h.
+ */
+static bool trace_is_blocking(xf_osal_trace_op_t op)
+{
+    switch (op) {
+    case XF_OSAL_TRACE_OP_MUTEX_ACQUIRE:
+    case XF_OSAL_TRACE_OP_SEMAPHORE_ACQUIRE:
+    case XF_OSAL_TRACE_OP_SEMAPHORE_ACQUIRE_N:
+    case XF_OSAL_TRACE_OP_QUEUE_PUT:
+    case XF_OSAL_TRACE_OP_QUEUE_GET:
+    case XF_OSAL_TRACE_OP_EVENT_WAIT:
+        return true;
+    default:
+        return false;
+    }
+}
+#endif
+
+#endif
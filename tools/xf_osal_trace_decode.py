@@ -0,0 +1,183 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+将 xf_osal_trace 缓冲区导出文件转换为 Chrome Trace Event JSON.
+
+导出：停止记录后，用调试器把 xf_osal_trace_get_buffer() 返回的整个缓冲区保存为二进制文件，例如
+    (gdb) dump binary memory trace.bin &s_trace_buf ((char *)&s_trace_buf) + sizeof(s_trace_buf)
+
+转换：
+    python3 xf_osal_trace_decode.py trace.bin -o trace.json
+
+生成的文件可在 chrome://tracing 或 https://ui.perfetto.dev 打开，
+每个核一个进程，每个线程一行，每次调用一个区间。
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+MAGIC = 0x52544658
+VERSION = 1
+
+HEADER_FMT = "<IHHIIII"
+RING_HEAD_FMT = "<II"
+EVENT_FMT = "<IIIIHh"
+
+# 与 xf_osal_trace.h 中的 xf_osal_trace_op_t 保持一致
+OPS = {
+    0: "calibrate",
+    1: "thread_yield",
+    2: "thread_suspend",
+    3: "thread_resume",
+    4: "thread_notify_set",
+    5: "thread_notify_set_from_isr",
+    6: "thread_notify_wait",
+    7: "delay",
+    8: "delay_until",
+    9: "delay_ms",
+    16: "timer_start",
+    17: "timer_stop",
+    24: "event_set",
+    25: "event_set_from_isr",
+    26: "event_clear",
+    27: "event_wait",
+    32: "mutex_acquire",
+    33: "mutex_release",
+    40: "semaphore_acquire",
+    41: "semaphore_release",
+    42: "semaphore_acquire_from_isr",
+    43: "semaphore_release_from_isr",
+    44: "semaphore_acquire_n",
+    45: "semaphore_release_n",
+    48: "queue_put",
+    49: "queue_get",
+    50: "queue_put_from_isr",
+    51: "queue_get_from_isr",
+    52: "queue_peek",
+    56: "cond_wait",
+    57: "cond_timedwait",
+    58: "cond_signal",
+    59: "cond_broadcast",
+    64: "msgbuf_send",
+    65: "msgbuf_receive",
+    66: "streambuf_send",
+    67: "streambuf_receive",
+    72: "select",
+}
+
+OP_CALIBRATE = 0
+
+
+def parse(data):
+    """解析缓冲区，返回 (header, rings)，rings 中每个核的记录按写入先后排列。"""
+    if len(data) < struct.calcsize(HEADER_FMT):
+        raise ValueError("file too short")
+
+    magic, version, event_size, core_num, ring_size, freq, overhead = \
+        struct.unpack_from(HEADER_FMT, data, 0)
+    if magic != MAGIC:
+        raise ValueError("bad magic 0x%08x, not a xf_osal trace buffer" % magic)
+    if version != VERSION:
+        raise ValueError("unsupported version %d" % version)
+    if event_size != struct.calcsize(EVENT_FMT):
+        raise ValueError("unexpected event size %d" % event_size)
+
+    header = {"core_num": core_num, "ring_size": ring_size, "freq": freq, "overhead": overhead}
+
+    rings = []
+    offset = struct.calcsize(HEADER_FMT)
+    ring_bytes = struct.calcsize(RING_HEAD_FMT) + ring_size * event_size
+    if len(data) < offset + core_num * ring_bytes:
+        raise ValueError("file too short for %d ring(s) of %d events" % (core_num, ring_size))
+
+    for _ in range(core_num):
+        head, _reserved = struct.unpack_from(RING_HEAD_FMT, data, offset)
+        base = offset + struct.calcsize(RING_HEAD_FMT)
+
+        if head <= ring_size:
+            order = range(head)
+        else:
+            first = head % ring_size
+            order = [(first + i) % ring_size for i in range(ring_size)]
+
+        events = [struct.unpack_from(EVENT_FMT, data, base + i * event_size) for i in order]
+        rings.append(events)
+        offset += ring_bytes
+
+    return header, rings
+
+
+def to_chrome(header, rings, freq, raw):
+    """转换为 Chrome Trace Event 格式。时间戳按 32 位回绕，展开为相对于最早记录的时间。"""
+    scale = 1e6 / freq
+    overhead = 0 if raw else header["overhead"]
+
+    firsts = [events[0][0] for events in rings if events]
+    if not firsts:
+        return []
+    base = firsts[0]
+
+    def offset(timestamp):
+        # 相对 base 的有符号差值，要求整个跟踪跨度小于半个回绕周期
+        return ((timestamp - base + 0x80000000) & 0xFFFFFFFF) - 0x80000000
+
+    origin = min(offset(e[0]) for events in rings for e in events)
+
+    trace = []
+    for core, events in enumerate(rings):
+        for timestamp, duration, thread, obj, op, result in events:
+            if op == OP_CALIBRATE:
+                continue
+            duration = max(duration - overhead, 0)
+            trace.append({
+                "name": OPS.get(op, "op_%d" % op),
+                "cat": "xf_osal",
+                "ph": "X",
+                "ts": (offset(timestamp) - origin) * scale,
+                "dur": duration * scale,
+                "pid": core,
+                "tid": "0x%08x" % thread,
+                "args": {"obj": "0x%08x" % obj, "result": result},
+            })
+
+    trace.sort(key=lambda e: e["ts"])
+    return trace
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert a xf_osal trace dump to Chrome Trace Event JSON.")
+    parser.add_argument("input", help="binary dump of the buffer returned by xf_osal_trace_get_buffer()")
+    parser.add_argument("-o", "--output", default="-", help="output JSON file (default: stdout)")
+    parser.add_argument("--freq", type=int, default=0, help="override the timestamp frequency in Hz")
+    parser.add_argument("--raw", action="store_true", help="do not subtract the calibrated overhead")
+    args = parser.parse_args()
+
+    with open(args.input, "rb") as f:
+        data = f.read()
+
+    try:
+        header, rings = parse(data)
+    except ValueError as e:
+        sys.exit("error: %s" % e)
+
+    freq = args.freq or header["freq"]
+    if freq == 0:
+        sys.exit("error: timestamp frequency unknown, trace was never started; pass --freq")
+
+    result = {
+        "traceEvents": to_chrome(header, rings, freq, args.raw),
+        "displayTimeUnit": "ns",
+        "otherData": {"timestamp_freq": freq, "overhead": header["overhead"]},
+    }
+
+    if args.output == "-":
+        json.dump(result, sys.stdout)
+    else:
+        with open(args.output, "w") as f:
+            json.dump(result, f)
+
+
+if __name__ == "__main__":
+    main()
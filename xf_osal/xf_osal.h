@@ -53,6 +53,67 @@
 #include "xf_osal_queue.h"
 #endif
 
+#if XF_OSAL_MSGBUF_IS_ENABLE
+#include "xf_osal_msgbuf.h"
+#endif
+
+#if XF_OSAL_STREAMBUF_IS_ENABLE
+#include "xf_osal_streambuf.h"
+#endif
+
+#if XF_OSAL_COND_IS_ENABLE
+#include "xf_osal_cond.h"
+#endif
+
+#if XF_OSAL_LWSEM_IS_ENABLE
+#include "xf_osal_lwsem.h"
+#endif
+
+#if XF_OSAL_SELECT_IS_ENABLE
+#include "xf_osal_select.h"
+#endif
+
+#if XF_OSAL_BROADCAST_IS_ENABLE
+#include "xf_osal_broadcast.h"
+#endif
+
+#if XF_OSAL_CORO_IS_ENABLE
+#include "xf_osal_coro.h"
+#endif
+
+#if XF_OSAL_PERIODIC_IS_ENABLE
+#include "xf_osal_periodic.h"
+#endif
+
+#if XF_OSAL_SCHED_IS_ENABLE
+#include "xf_osal_sched.h"
+#endif
+
+#if XF_OSAL_RATELIMIT_IS_ENABLE
+#include "xf_osal_ratelimit.h"
+#endif
+
+/*
+ * 内联模式下由对接层提供热点接口的 static inline 实现，见 xf_osal_port.h.
+ * 对接层源文件自身定义 XF_OSAL_PORT_SOURCE, 不受此影响。
+ */
+#if XF_OSAL_INLINE_IS_ENABLE && !defined(XF_OSAL_PORT_SOURCE)
+#include "xf_osal_port.h"
+#endif
+
+#if XF_OSAL_LATENCY_IS_ENABLE
+#include "xf_osal_latency.h"
+#endif
+
+#if XF_OSAL_MUTEX_PROFILE_IS_ENABLE
+#include "xf_osal_mutex_profile.h"
+#endif
+
+/* 调用跟踪把操作接口重定向到包装函数，必须放在所有模块头文件之后 */
+#if XF_OSAL_TRACE_WRAP_IS_ENABLE
+#include "xf_osal_trace.h"
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
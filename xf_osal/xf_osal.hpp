@@ -0,0 +1,719 @@
+/**
+ * @file xf_osal.hpp
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief xf_osal 的 C++ 封装：静态内存的线程、互斥锁、消息队列与 RAII 锁。
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * 除 Task 的协程帧外，所有类只是 C 接口的内联转发，不从堆上分配内存：
+ *
+ * - xf_osal::Thread<StackSize>   栈与控制块随对象静态分配。
+ * - xf_osal::Mutex               控制块随对象静态分配。
+ * - xf_osal::Queue<T, N>         控制块与 N 个 T 的消息内存随对象静态分配，
+ *                                按类型收发，消息大小由编译器保证。
+ * - xf_osal::lock_guard, xf_osal::unique_lock   作用域内持有 xf_osal_mutex_t.
+ * - xf_osal::Task                C++20 协程，在 xf_osal_coro.h 的执行器上运行，
+ *                                可 co_await queue_get(), semaphore_acquire(), event_wait(), sleep().
+ *
+ * 控制块大小由对接层 xf_osal_port.h 中的 XF_OSAL_PORT_*_CB_SIZE 提供，
+ * 对接层未提供时 Thread, Mutex, Queue 不可用，lock_guard 与 unique_lock 不受影响。
+ *
+ * 对象的创建在 create() / start() 中完成，而不在构造函数中，
+ * 以便将对象定义为全局变量，待内核初始化后再创建。
+ *
+ * 典型用法：
+ *
+ * @code
+ * struct sample_t { uint32_t id; int16_t value; };
+ *
+ * static xf_osal::Queue<sample_t, 8> s_samples;
+ * static xf_osal::Mutex s_lock;
+ * static xf_osal::Thread<1024> s_worker;
+ *
+ * static void worker(void *arg)
+ * {
+ *     sample_t sample;
+ *     while (s_samples.get(sample) == XF_OK) {
+ *         xf_osal::lock_guard guard(s_lock);
+ *         ...
+ *     }
+ * }
+ *
+ * s_samples.create("samples");
+ * s_lock.create("lock");
+ * s_worker.start(worker, NULL, "worker");
+ * @endcode
+ */
+
+#ifndef __XF_OSAL_HPP__
+#define __XF_OSAL_HPP__
+
+#ifndef __cplusplus
+#error "xf_osal.hpp requires a C++11 compiler"
+#endif
+
+/* ==================== [Includes] ========================================== */
+
+#include <type_traits>
+
+#include "xf_osal.h"
+#include "xf_osal_port.h"
+
+#if XF_OSAL_CORO_IS_ENABLE && defined(__cpp_impl_coroutine)
+#include <coroutine>
+#define XF_OSAL_CPP_CORO_IS_ENABLE (1)
+#else
+#define XF_OSAL_CPP_CORO_IS_ENABLE (0)
+#endif
+
+/**
+ * @cond XFAPI_USER
+ * @ingroup group_xf_osal
+ * @defgroup group_xf_osal_cpp cpp
+ * @brief xf_osal 的 C++ 封装。
+ * @endcond
+ * @{
+ */
+
+namespace xf_osal
+{
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+#if XF_OSAL_MUTEX_IS_ENABLE
+
+/**
+ * @brief 作用域锁，构造时一直等待获取互斥锁，析构时释放。
+ */
+class lock_guard
+{
+public:
+    explicit lock_guard(xf_osal_mutex_t mutex) : m_mutex(mutex)
+    {
+        (void)xf_osal_mutex_acquire(m_mutex, XF_OSAL_WAIT_FOREVER);
+    }
+
+    ~lock_guard()
+    {
+        (void)xf_osal_mutex_release(m_mutex);
+    }
+
+    lock_guard(const lock_guard &) = delete;
+    lock_guard &operator=(const lock_guard &) = delete;
+
+private:
+    xf_osal_mutex_t m_mutex;
+};
+
+/**
+ * @brief 可超时、可提前释放的作用域锁，析构时若仍持有则释放。
+ */
+class unique_lock
+{
+public:
+    /**
+     * @brief 一直等待获取互斥锁。
+     */
+    explicit unique_lock(xf_osal_mutex_t mutex) : m_mutex(mutex), m_owns(false)
+    {
+        (void)lock(XF_OSAL_WAIT_FOREVER);
+    }
+
+    /**
+     * @brief 在超时时间内获取互斥锁，是否成功见 owns_lock().
+     *
+     * @param mutex   互斥锁句柄。
+     * @param timeout 超时值，单位 ticks. 为 0 时只尝试一次。
+     */
+    unique_lock(xf_osal_mutex_t mutex, uint32_t timeout) : m_mutex(mutex), m_owns(false)
+    {
+        (void)lock(timeout);
+    }
+
+    ~unique_lock()
+    {
+        if (m_owns) {
+            (void)xf_osal_mutex_release(m_mutex);
+        }
+    }
+
+    unique_lock(const unique_lock &) = delete;
+    unique_lock &operator=(const unique_lock &) = delete;
+
+    unique_lock(unique_lock &&other) : m_mutex(other.m_mutex), m_owns(other.m_owns)
+    {
+        other.m_owns = false;
+    }
+
+    /**
+     * @brief 获取互斥锁。已持有时返回 XF_FAIL.
+     */
+    xf_err_t lock(uint32_t timeout = XF_OSAL_WAIT_FOREVER)
+    {
+        xf_err_t err;
+
+        if (m_owns) {
+            return XF_FAIL;
+        }
+
+        err = xf_osal_mutex_acquire(m_mutex, timeout);
+        m_owns = (err == XF_OK);
+
+        return err;
+    }
+
+    /**
+     * @brief 提前释放互斥锁。未持有时返回 XF_FAIL.
+     */
+    xf_err_t unlock()
+    {
+        if (!m_owns) {
+            return XF_FAIL;
+        }
+
+        m_owns = false;
+
+        return xf_osal_mutex_release(m_mutex);
+    }
+
+    bool owns_lock() const
+    {
+        return m_owns;
+    }
+
+    explicit operator bool() const
+    {
+        return m_owns;
+    }
+
+    xf_osal_mutex_t mutex() const
+    {
+        return m_mutex;
+    }
+
+private:
+    xf_osal_mutex_t m_mutex;
+    bool            m_owns;
+};
+
+#if defined(XF_OSAL_PORT_MUTEX_CB_SIZE)
+
+/**
+ * @brief 控制块静态分配的互斥锁，可隐式转换为 xf_osal_mutex_t.
+ */
+class Mutex
+{
+public:
+    Mutex() : m_handle(NULL) {}
+
+    ~Mutex()
+    {
+        (void)destroy();
+    }
+
+    Mutex(const Mutex &) = delete;
+    Mutex &operator=(const Mutex &) = delete;
+
+    /**
+     * @brief 创建互斥锁。
+     *
+     * @param name      名称。
+     * @param attr_bits 属性位，见 @ref XF_OSAL_MUTEX_RECURSIVE 等。
+     * @return xf_err_t
+     *      - XF_OK                 成功
+     *      - XF_FAIL               已创建或创建失败
+     */
+    xf_err_t create(const char *name = NULL, uint32_t attr_bits = 0U)
+    {
+        xf_osal_mutex_attr_t attr = {};
+
+        if (m_handle != NULL) {
+            return XF_FAIL;
+        }
+
+        attr.name      = name;
+        attr.attr_bits = attr_bits;
+        attr.cb_mem    = m_cb;
+        attr.cb_size   = sizeof(m_cb);
+        m_handle = xf_osal_mutex_create(&attr);
+
+        return (m_handle != NULL) ? XF_OK : XF_FAIL;
+    }
+
+    /**
+     * @brief 删除互斥锁，未创建时直接返回 XF_OK.
+     */
+    xf_err_t destroy()
+    {
+        xf_err_t err = XF_OK;
+
+        if (m_handle != NULL) {
+            err = xf_osal_mutex_delete(m_handle);
+            if (err == XF_OK) {
+                m_handle = NULL;
+            }
+        }
+
+        return err;
+    }
+
+    xf_err_t lock(uint32_t timeout = XF_OSAL_WAIT_FOREVER)
+    {
+        return xf_osal_mutex_acquire(m_handle, timeout);
+    }
+
+    xf_err_t unlock()
+    {
+        return xf_osal_mutex_release(m_handle);
+    }
+
+    xf_osal_thread_t owner() const
+    {
+        return xf_osal_mutex_get_owner(m_handle);
+    }
+
+    xf_osal_mutex_t handle() const
+    {
+        return m_handle;
+    }
+
+    operator xf_osal_mutex_t() const
+    {
+        return m_handle;
+    }
+
+private:
+    xf_osal_mutex_t m_handle;
+    alignas(8) uint8_t m_cb[XF_OSAL_PORT_MUTEX_CB_SIZE];
+};
+
+#endif // XF_OSAL_PORT_MUTEX_CB_SIZE
+
+#endif // XF_OSAL_MUTEX_IS_ENABLE
+
+#if XF_OSAL_QUEUE_IS_ENABLE && defined(XF_OSAL_PORT_QUEUE_CB_SIZE)
+
+/**
+ * @brief 控制块与消息内存静态分配的消息队列，按值收发 T.
+ *
+ * 消息以 memcpy 方式复制，T 必须可平凡复制。
+ *
+ * @tparam T 消息类型。
+ * @tparam N 队列中的最大消息数。
+ */
+template <typename T, uint32_t N>
+class Queue
+{
+    static_assert(N > 0U, "Queue length must not be zero");
+    static_assert(std::is_trivially_copyable<T>::value, "Queue message type must be trivially copyable");
+
+public:
+    Queue() : m_handle(NULL) {}
+
+    ~Queue()
+    {
+        (void)destroy();
+    }
+
+    Queue(const Queue &) = delete;
+    Queue &operator=(const Queue &) = delete;
+
+    /**
+     * @brief 创建消息队列。
+     *
+     * @param name      名称。
+     * @param attr_bits 属性位，见 @ref XF_OSAL_QUEUE_OVERWRITE (此时 N 必须为 1).
+     * @return xf_err_t
+     *      - XF_OK                 成功
+     *      - XF_FAIL               已创建或创建失败
+     */
+    xf_err_t create(const char *name = NULL, uint32_t attr_bits = 0U)
+    {
+        xf_osal_queue_attr_t attr = {};
+
+        if (m_handle != NULL) {
+            return XF_FAIL;
+        }
+
+        attr.name      = name;
+        attr.attr_bits = attr_bits;
+        attr.cb_mem    = m_cb;
+        attr.cb_size   = sizeof(m_cb);
+        attr.mq_mem    = m_mq;
+        attr.mq_size   = sizeof(m_mq);
+        m_handle = xf_osal_queue_create(N, sizeof(T), &attr);
+
+        return (m_handle != NULL) ? XF_OK : XF_FAIL;
+    }
+
+    /**
+     * @brief 删除消息队列，未创建时直接返回 XF_OK.
+     */
+    xf_err_t destroy()
+    {
+        xf_err_t err = XF_OK;
+
+        if (m_handle != NULL) {
+            err = xf_osal_queue_delete(m_handle);
+            if (err == XF_OK) {
+                m_handle = NULL;
+            }
+        }
+
+        return err;
+    }
+
+    xf_err_t put(const T &msg, uint32_t timeout = XF_OSAL_WAIT_FOREVER, uint8_t prio = 0U)
+    {
+        return xf_osal_queue_put(m_handle, &msg, prio, timeout);
+    }
+
+    xf_err_t get(T &msg, uint32_t timeout = XF_OSAL_WAIT_FOREVER)
+    {
+        return xf_osal_queue_get(m_handle, &msg, NULL, timeout);
+    }
+
+    xf_err_t put_from_isr(const T &msg, uint8_t prio = 0U)
+    {
+        return xf_osal_queue_put_from_isr(m_handle, &msg, prio);
+    }
+
+    xf_err_t get_from_isr(T &msg)
+    {
+        return xf_osal_queue_get_from_isr(m_handle, &msg, NULL);
+    }
+
+    xf_err_t peek(T &msg, uint32_t timeout = 0U)
+    {
+        return xf_osal_queue_peek(m_handle, &msg, timeout);
+    }
+
+    uint32_t count() const
+    {
+        return xf_osal_queue_get_count(m_handle);
+    }
+
+    static constexpr uint32_t capacity()
+    {
+        return N;
+    }
+
+    xf_err_t reset()
+    {
+        return xf_osal_queue_reset(m_handle);
+    }
+
+    xf_osal_queue_t handle() const
+    {
+        return m_handle;
+    }
+
+private:
+    xf_osal_queue_t m_handle;
+    alignas(8) uint8_t m_cb[XF_OSAL_PORT_QUEUE_CB_SIZE];
+    alignas(T) uint8_t m_mq[XF_OSAL_PORT_QUEUE_MEM_SIZE(N, sizeof(T))];
+};
+
+#endif // XF_OSAL_QUEUE_IS_ENABLE && XF_OSAL_PORT_QUEUE_CB_SIZE
+
+#if XF_OSAL_THREAD_IS_ENABLE && defined(XF_OSAL_PORT_THREAD_CB_SIZE)
+
+/**
+ * @brief 栈与控制块静态分配的线程。
+ *
+ * 析构时不删除线程，对象的生命周期必须覆盖线程的运行期，一般定义为全局或静态变量。
+ *
+ * @tparam StackSize 栈大小（单位字节），须为 8 的倍数。
+ */
+template <uint32_t StackSize>
+class Thread
+{
+    static_assert((StackSize > 0U) && ((StackSize % 8U) == 0U), "Thread stack size must be a non-zero multiple of 8");
+
+public:
+    Thread() : m_handle(NULL) {}
+
+    Thread(const Thread &) = delete;
+    Thread &operator=(const Thread &) = delete;
+
+    /**
+     * @brief 创建并启动线程。
+     *
+     * @param func     线程入口函数。
+     * @param argument 传给入口函数的参数。
+     * @param name     名称。
+     * @param priority 优先级。
+     * @param affinity_mask 允许运行的处理器核掩码，0 为不限制。
+     * @return xf_err_t
+     *      - XF_OK                 成功
+     *      - XF_FAIL               已启动或创建失败
+     */
+    xf_err_t start(xf_osal_thread_func_t func, void *argument = NULL, const char *name = NULL,
+                   xf_osal_priority_t priority = XF_OSAL_PRIORITY_NORMOL, uint32_t affinity_mask = 0U)
+    {
+        xf_osal_thread_attr_t attr = {};
+
+        if (m_handle != NULL) {
+            return XF_FAIL;
+        }
+
+        attr.name       = name;
+        attr.cb_mem     = m_cb;
+        attr.cb_size    = sizeof(m_cb);
+        attr.stack_mem  = m_stack;
+        attr.stack_size = sizeof(m_stack);
+        attr.priority   = priority;
+        attr.affinity_mask = affinity_mask;
+        m_handle = xf_osal_thread_create(func, argument, &attr);
+
+        return (m_handle != NULL) ? XF_OK : XF_FAIL;
+    }
+
+    xf_err_t notify(uint32_t flags)
+    {
+        return xf_osal_thread_notify_set(m_handle, flags);
+    }
+
+    xf_err_t set_priority(xf_osal_priority_t priority)
+    {
+        return xf_osal_thread_set_priority(m_handle, priority);
+    }
+
+    xf_err_t set_affinity(uint32_t mask)
+    {
+        return xf_osal_thread_set_affinity(m_handle, mask);
+    }
+
+    uint32_t stack_space() const
+    {
+        return xf_osal_thread_get_stack_space(m_handle);
+    }
+
+    xf_osal_thread_t handle() const
+    {
+        return m_handle;
+    }
+
+private:
+    xf_osal_thread_t m_handle;
+    alignas(8) uint8_t m_cb[XF_OSAL_PORT_THREAD_CB_SIZE];
+    alignas(8) uint8_t m_stack[StackSize];
+};
+
+#endif // XF_OSAL_THREAD_IS_ENABLE && XF_OSAL_PORT_THREAD_CB_SIZE
+
+#if XF_OSAL_CPP_CORO_IS_ENABLE
+
+/**
+ * @brief C++20 协程，由 xf_osal_coro_exec_t 执行器运行。
+ *
+ * 协程帧由编译器分配（默认使用 operator new），其中包含一个 xf_osal_coro_t,
+ * 执行完毕后由执行器销毁。与 C 接口不同，局部变量在 co_await 前后保持有效。
+ *
+ * @code
+ * static xf_osal::Task session(xf_osal_queue_t rx)
+ * {
+ *     msg_t msg;
+ *     while (co_await xf_osal::queue_get(rx, &msg, 1000) == XF_OK) {
+ *         handle(&msg);
+ *     }
+ * }
+ *
+ * session(rx).spawn(&s_exec);
+ * @endcode
+ */
+class Task
+{
+public:
+    struct promise_type {
+        xf_osal_coro_t coro = {};
+
+        Task get_return_object()
+        {
+            return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        std::suspend_always final_suspend() noexcept
+        {
+            return {};
+        }
+
+        void return_void() {}
+
+        void unhandled_exception() {}
+    };
+
+    using handle_type = std::coroutine_handle<promise_type>;
+
+    Task(Task &&other) noexcept : m_handle(other.m_handle)
+    {
+        other.m_handle = nullptr;
+    }
+
+    ~Task()
+    {
+        if (m_handle) {
+            m_handle.destroy();
+        }
+    }
+
+    Task(const Task &) = delete;
+    Task &operator=(const Task &) = delete;
+
+    /**
+     * @brief 交给执行器运行，成功后协程帧的所有权转移给执行器。
+     *
+     * @param exec 执行器。
+     * @return xf_err_t 见 xf_osal_coro_spawn().
+     */
+    xf_err_t spawn(xf_osal_coro_exec_t *exec)
+    {
+        xf_err_t err;
+
+        if (!m_handle) {
+            return XF_FAIL;
+        }
+
+        err = xf_osal_coro_spawn(exec, &m_handle.promise().coro, resume, m_handle.address(), destroy);
+        if (err == XF_OK) {
+            m_handle = nullptr;
+        }
+
+        return err;
+    }
+
+private:
+    explicit Task(handle_type handle) : m_handle(handle) {}
+
+    static xf_osal_coro_status_t resume(xf_osal_coro_t *coro, void *arg)
+    {
+        handle_type handle = handle_type::from_address(arg);
+
+        (void)coro;
+        handle.resume();
+
+        /* 挂起在等待操作上时执行器根据登记的等待类型处理，此处不必区分 */
+        return handle.done() ? XF_OSAL_CORO_STATUS_DONE : XF_OSAL_CORO_STATUS_YIELD;
+    }
+
+    static void destroy(xf_osal_coro_t *coro, void *arg)
+    {
+        (void)coro;
+        handle_type::from_address(arg).destroy();
+    }
+
+    handle_type m_handle;
+};
+
+/**
+ * @brief 等待操作的 awaiter, 由 queue_get() 等函数返回，co_await 的结果为 xf_err_t.
+ *
+ * @tparam Op 以 xf_osal_coro_t * 为参数、返回是否已完成的可调用对象。
+ */
+template <typename Op>
+class Awaiter
+{
+public:
+    explicit Awaiter(Op op) : m_op(op), m_coro(nullptr) {}
+
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    bool await_suspend(Task::handle_type handle) noexcept
+    {
+        m_coro = &handle.promise().coro;
+        /* 能立即完成时不挂起 */
+        return !m_op(m_coro);
+    }
+
+    xf_err_t await_resume() const noexcept
+    {
+        return xf_osal_coro_result(m_coro);
+    }
+
+private:
+    Op              m_op;
+    xf_osal_coro_t *m_coro;
+};
+
+/**
+ * @brief 让出执行权，执行器运行完其他协程后继续。
+ */
+inline std::suspend_always yield()
+{
+    return {};
+}
+
+/**
+ * @brief 等待一段时间，见 xf_osal_coro_sleep().
+ */
+inline auto sleep(uint32_t ticks)
+{
+    return Awaiter([ticks](xf_osal_coro_t *coro) {
+        return xf_osal_coro_sleep(coro, ticks);
+    });
+}
+
+#if XF_OSAL_QUEUE_IS_ENABLE
+/**
+ * @brief 等待从消息队列取出一条消息，见 xf_osal_coro_queue_get().
+ */
+template <typename T>
+inline auto queue_get(xf_osal_queue_t queue, T *msg, uint32_t timeout = XF_OSAL_WAIT_FOREVER)
+{
+    return Awaiter([queue, msg, timeout](xf_osal_coro_t *coro) {
+        return xf_osal_coro_queue_get(coro, queue, msg, timeout);
+    });
+}
+#endif
+
+#if XF_OSAL_SEMAPHORE_IS_ENABLE
+/**
+ * @brief 等待获取一个信号量令牌，见 xf_osal_coro_semaphore_acquire().
+ */
+inline auto semaphore_acquire(xf_osal_semaphore_t semaphore, uint32_t timeout = XF_OSAL_WAIT_FOREVER)
+{
+    return Awaiter([semaphore, timeout](xf_osal_coro_t *coro) {
+        return xf_osal_coro_semaphore_acquire(coro, semaphore, timeout);
+    });
+}
+#endif
+
+#if XF_OSAL_EVENT_IS_ENABLE
+/**
+ * @brief 等待事件标志，见 xf_osal_coro_event_wait().
+ */
+inline auto event_wait(xf_osal_event_t event, uint32_t flags, uint32_t options = XF_OSAL_WAIT_ANY,
+                       uint32_t timeout = XF_OSAL_WAIT_FOREVER)
+{
+    return Awaiter([event, flags, options, timeout](xf_osal_coro_t *coro) {
+        return xf_osal_coro_event_wait(coro, event, flags, options, timeout);
+    });
+}
+#endif
+
+#endif // XF_OSAL_CPP_CORO_IS_ENABLE
+
+/* ==================== [Global Prototypes] ================================= */
+
+/* ==================== [Macros] ============================================ */
+
+} /* namespace xf_osal */
+
+/**
+ * End of defgroup group_xf_osal_cpp cpp
+ * @}
+ */
+
+#endif // __XF_OSAL_HPP__
@@ -0,0 +1,68 @@
+/**
+ * @file xf_osal_atomic.h
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief xf_osal 内部使用的原子操作。
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * 默认使用 GCC/Clang 的 __atomic 内建函数。没有独占访问指令的架构（如 Cortex-M0）
+ * 上编译器会生成 __atomic_*_4 库函数调用，需由平台提供；
+ * 也可在 xf_osal_config.h 中自行定义以下宏（例如用关中断实现）。
+ */
+
+#ifndef __XF_OSAL_ATOMIC_H__
+#define __XF_OSAL_ATOMIC_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_osal_def.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/**
+ * @brief 原子读取。
+ */
+#ifndef xf_osal_atomic_load
+#define xf_osal_atomic_load(ptr)                __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#endif
+
+/**
+ * @brief 原子写入。
+ */
+#ifndef xf_osal_atomic_store
+#define xf_osal_atomic_store(ptr, val)          __atomic_store_n((ptr), (val), __ATOMIC_RELEASE)
+#endif
+
+/**
+ * @brief 原子加，返回加之前的值。
+ */
+#ifndef xf_osal_atomic_fetch_add
+#define xf_osal_atomic_fetch_add(ptr, val)      __atomic_fetch_add((ptr), (val), __ATOMIC_ACQ_REL)
+#endif
+
+/**
+ * @brief 比较并交换。*ptr 等于 *expected 时写入 desired 并返回非 0,
+ *        否则将 *ptr 的当前值写回 *expected 并返回 0.
+ */
+#ifndef xf_osal_atomic_cas
+#define xf_osal_atomic_cas(ptr, expected, desired) \
+    __atomic_compare_exchange_n((ptr), (expected), (desired), 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+#endif
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Global Prototypes] ================================= */
+
+/* ==================== [Macros] ============================================ */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif // __XF_OSAL_ATOMIC_H__
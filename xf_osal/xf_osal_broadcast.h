@@ -0,0 +1,201 @@
+/**
+ * @file xf_osal_broadcast.h
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief 广播通道，一个发布者写入的消息被所有订阅者读取。
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * 所有订阅者共享同一个环形缓冲区，每条消息只写入一次，
+ * 每个订阅者持有独立的读游标，内存与拷贝次数不随订阅者数量增长。
+ *
+ * - 发布从不阻塞：环形缓冲区满时覆盖最旧的消息。
+ * - 订阅者读得太慢、游标落后超过缓冲区容量时，丢失的消息数会被记录，
+ *   游标跳到仍保留的最旧消息。
+ *
+ * 典型用法：
+ *
+ * @code
+ * static frame_t s_ring[8];
+ * static xf_osal_broadcast_t s_bc;
+ * xf_osal_broadcast_init(&s_bc, s_ring, sizeof(frame_t), 8);
+ *
+ * // 订阅者线程
+ * xf_osal_broadcast_sub_t sub;
+ * xf_osal_broadcast_subscribe(&s_bc, &sub);
+ * for (;;) {
+ *     frame_t frame;
+ *     uint32_t lost;
+ *     if (xf_osal_broadcast_receive(&sub, &frame, &lost, XF_OSAL_WAIT_FOREVER) == XF_OK) {
+ *         ...
+ *     }
+ * }
+ * @endcode
+ */
+
+#if XF_OSAL_BROADCAST_IS_ENABLE || defined(__DOXYGEN__)
+
+#ifndef __XF_OSAL_BROADCAST_H__
+#define __XF_OSAL_BROADCAST_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_osal_def.h"
+#include "xf_osal_mutex.h"
+#include "xf_osal_cond.h"
+
+/**
+ * @cond XFAPI_USER
+ * @ingroup group_xf_osal
+ * @defgroup group_xf_osal_broadcast broadcast
+ * @brief 广播通道，一个发布者写入的消息被所有订阅者读取。
+ * @endcond
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/**
+ * @brief 广播通道对象，由调用者分配，不要直接访问成员。
+ */
+typedef struct _xf_osal_broadcast_t {
+    uint8_t        *buf;        /*!< 环形缓冲区 */
+    uint32_t        msg_size;   /*!< 消息大小（单位字节） */
+    uint32_t        msg_count;  /*!< 环形缓冲区可保存的消息数 */
+    uint32_t        head;       /*!< 已发布的消息总数，即下一条消息的序号 */
+    uint32_t        head_slot;  /*!< 下一条消息写入的槽位，在 msg_count 处回绕 */
+    xf_osal_mutex_t mutex;      /*!< 保护缓冲区与游标 */
+    xf_osal_cond_t  cond;       /*!< 有新消息时唤醒所有订阅者 */
+} xf_osal_broadcast_t;
+
+/**
+ * @brief 订阅者对象，由调用者分配，不要直接访问成员。
+ *
+ * 每个订阅者对象只能由一个线程读取。
+ */
+typedef struct _xf_osal_broadcast_sub_t {
+    xf_osal_broadcast_t *bc;        /*!< 所订阅的广播通道 */
+    uint32_t             cursor;    /*!< 下一条要读取的消息序号 */
+    uint32_t             overrun;   /*!< 累计丢失的消息数 */
+} xf_osal_broadcast_sub_t;
+
+/* ==================== [Global Prototypes] ================================= */
+
+/**
+ * @brief 初始化广播通道。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @param bc        广播通道对象。
+ * @param buf       环形缓冲区，大小不得小于 msg_size * msg_count 字节。
+ * @param msg_size  消息大小（单位字节）。
+ * @param msg_count 环形缓冲区可保存的消息数。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_NO_MEM         无法创建互斥锁或条件变量
+ *      - XF_ERR_INVALID_ARG    无效参数
+ */
+xf_err_t xf_osal_broadcast_init(xf_osal_broadcast_t *bc, void *buf, uint32_t msg_size, uint32_t msg_count);
+
+/**
+ * @brief 反初始化广播通道。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ * @note 调用前应确保没有订阅者阻塞在 xf_osal_broadcast_receive() 中。
+ *
+ * @param bc 广播通道对象。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_RESOURCE       仍有订阅者在等待
+ *      - XF_ERR_INVALID_ARG    无效参数
+ */
+xf_err_t xf_osal_broadcast_deinit(xf_osal_broadcast_t *bc);
+
+/**
+ * @brief 订阅广播通道，只能读到订阅之后发布的消息。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @param bc  广播通道对象。
+ * @param sub 订阅者对象。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    无效参数
+ */
+xf_err_t xf_osal_broadcast_subscribe(xf_osal_broadcast_t *bc, xf_osal_broadcast_sub_t *sub);
+
+/**
+ * @brief 发布一条消息，环形缓冲区满时覆盖最旧的消息，并唤醒所有等待的订阅者。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @param bc      广播通道对象。
+ * @param msg_ptr 指向消息的指针，长度为初始化时的 msg_size.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    无效参数
+ *      - XF_ERR_ISR            禁止在中断服务函数中调用
+ */
+xf_err_t xf_osal_broadcast_publish(xf_osal_broadcast_t *bc, const void *msg_ptr);
+
+/**
+ * @brief 读取订阅者的下一条消息，如果没有新消息，则等待直至有新消息或超时。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @param sub           订阅者对象。从 @ref xf_osal_broadcast_subscribe() 初始化。
+ * @param[out] msg_ptr  接收消息的缓冲区，大小不得小于 msg_size.
+ * @param[out] lost     返回本次读取前因读得太慢而丢失的消息数，可为 NULL.
+ * @param timeout       超时时间，单位 tick.
+ *      - 如需以 ms 为单位，请配合 @ref xf_osal_kernel_ms_to_ticks() 使用。
+ *      - 一直等待，直到有新消息（等待语义）：填入 @ref XF_OSAL_WAIT_FOREVER.
+ *      - 尝试读取（尝试语义），无论成功与否都立刻返回：填入 0.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_TIMEOUT        超时，没有新消息
+ *      - XF_ERR_RESOURCE       未指定超时时没有新消息
+ *      - XF_ERR_INVALID_ARG    无效参数
+ *      - XF_ERR_ISR            禁止在中断服务函数中调用
+ */
+xf_err_t xf_osal_broadcast_receive(
+    xf_osal_broadcast_sub_t *sub, void *msg_ptr, uint32_t *lost, uint32_t timeout);
+
+/**
+ * @brief 获取订阅者尚未读取、且仍保留在环形缓冲区中的消息数。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @param sub 订阅者对象。
+ * @return uint32_t 待读取的消息数。
+ */
+uint32_t xf_osal_broadcast_get_pending(xf_osal_broadcast_sub_t *sub);
+
+/**
+ * @brief 获取订阅者累计丢失的消息数。
+ *
+ * @param sub 订阅者对象。
+ * @return uint32_t 累计丢失的消息数。
+ */
+uint32_t xf_osal_broadcast_get_overrun(const xf_osal_broadcast_sub_t *sub);
+
+/* ==================== [Macros] ============================================ */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/**
+ * End of defgroup group_xf_osal_broadcast broadcast
+ * @}
+ */
+
+#endif // __XF_OSAL_BROADCAST_H__
+
+#endif // XF_OSAL_BROADCAST_IS_ENABLE
@@ -0,0 +1,183 @@
+/**
+ * @file xf_osal_cond.h
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief 条件变量，配合互斥锁等待某个条件成立。
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * 典型用法：
+ *
+ * @code
+ * xf_osal_mutex_acquire(mutex, XF_OSAL_WAIT_FOREVER);
+ * while (!condition) {
+ *     xf_osal_cond_wait(cond, mutex);
+ * }
+ * // 使用共享数据
+ * xf_osal_mutex_release(mutex);
+ * @endcode
+ *
+ * - 等待时原子地释放互斥锁，被唤醒后重新获取互斥锁再返回。
+ * - xf_osal_cond_signal() 只唤醒一个等待线程（优先级最高、等待最久者），
+ *   不会引起惊群。
+ * - 与大多数实现一致，被唤醒后条件不一定成立，调用者需在循环中重新检查条件。
+ */
+
+#if XF_OSAL_COND_IS_ENABLE || defined(__DOXYGEN__)
+
+#ifndef __XF_OSAL_COND_H__
+#define __XF_OSAL_COND_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_osal_def.h"
+#include "xf_osal_mutex.h"
+
+/**
+ * @cond XFAPI_USER
+ * @ingroup group_xf_osal
+ * @defgroup group_xf_osal_cond cond
+ * @brief 条件变量，配合互斥锁等待某个条件成立。
+ * @endcond
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/**
+ * @brief 条件变量控制块大小（单位字节），静态分配时 cb_size 不得小于该值。
+ */
+#define XF_OSAL_COND_CB_SIZE        (sizeof(void *) * 4U)
+
+/* ==================== [Typedefs] ========================================== */
+
+/**
+ * @brief 条件变量句柄。
+ */
+typedef void *xf_osal_cond_t;
+
+/**
+ * @brief 条件变量的属性结构。
+ */
+typedef struct _xf_osal_cond_attr_t {
+    const char *name;       /*!< 条件变量的名称，指向可读字符串。默认值: NULL. */
+    uint32_t    attr_bits;  /*!< 属性位，保留，默认值: 0. */
+    void       *cb_mem;     /*!< 控制块的内存，默认值: NULL, 即自动动态分配内存。 */
+    uint32_t    cb_size;    /*!< 控制块内存大小（单位字节），不使用静态分配时设为默认值: 0.
+                             *   使用静态分配时不得小于 @ref XF_OSAL_COND_CB_SIZE.
+                             */
+} xf_osal_cond_attr_t;
+
+/* ==================== [Global Prototypes] ================================= */
+
+/**
+ * @brief 创建并初始化条件变量。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @param attr 条件变量属性。填入 NULL 时使用默认属性。
+ * @return xf_osal_cond_t
+ *      - NULL                  创建失败
+ *      - (OTHER)               条件变量句柄
+ */
+xf_osal_cond_t xf_osal_cond_create(const xf_osal_cond_attr_t *attr);
+
+/**
+ * @brief 释放互斥锁并等待条件变量被通知，返回前重新获取互斥锁。
+ *
+ * 等价于 `xf_osal_cond_timedwait(cond, mutex, XF_OSAL_WAIT_FOREVER)`.
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ * @note 调用前当前线程必须已持有 mutex. 递归互斥锁只能持有一层。
+ *
+ * @param cond  条件变量句柄。从 @ref xf_osal_cond_create() 获取。
+ * @param mutex 保护条件的互斥锁。从 @ref xf_osal_mutex_create() 获取。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_RESOURCE       当前线程未持有互斥锁
+ *      - XF_ERR_INVALID_ARG    无效参数
+ *      - XF_ERR_ISR            禁止在中断服务函数中调用
+ */
+xf_err_t xf_osal_cond_wait(xf_osal_cond_t cond, xf_osal_mutex_t mutex);
+
+/**
+ * @brief 释放互斥锁并等待条件变量被通知，超时返回，返回前重新获取互斥锁。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ * @note 调用前当前线程必须已持有 mutex. 无论成功与否，返回时均已重新持有 mutex.
+ *
+ * @param cond      条件变量句柄。从 @ref xf_osal_cond_create() 获取。
+ * @param mutex     保护条件的互斥锁。从 @ref xf_osal_mutex_create() 获取。
+ * @param timeout   超时时间，单位 tick.
+ *      - 如需以 ms 为单位，请配合 @ref xf_osal_kernel_ms_to_ticks() 使用。
+ *      - 一直等待，直到被通知：填入 @ref XF_OSAL_WAIT_FOREVER.
+ * @return xf_err_t
+ *      - XF_OK                 成功，被 xf_osal_cond_signal() 或 xf_osal_cond_broadcast() 唤醒
+ *      - XF_ERR_TIMEOUT        超时
+ *      - XF_ERR_RESOURCE       timeout 为 0 时未被通知，或当前线程未持有互斥锁
+ *      - XF_ERR_INVALID_ARG    无效参数
+ *      - XF_ERR_ISR            禁止在中断服务函数中调用
+ */
+xf_err_t xf_osal_cond_timedwait(xf_osal_cond_t cond, xf_osal_mutex_t mutex, uint32_t timeout);
+
+/**
+ * @brief 唤醒一个等待该条件变量的线程。
+ *
+ * 唤醒等待线程中优先级最高者，同优先级时唤醒等待最久者。没有等待线程时无作用。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @param cond 条件变量句柄。从 @ref xf_osal_cond_create() 获取。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    无效参数
+ *      - XF_ERR_ISR            禁止在中断服务函数中调用
+ */
+xf_err_t xf_osal_cond_signal(xf_osal_cond_t cond);
+
+/**
+ * @brief 唤醒所有等待该条件变量的线程。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @param cond 条件变量句柄。从 @ref xf_osal_cond_create() 获取。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    无效参数
+ *      - XF_ERR_ISR            禁止在中断服务函数中调用
+ */
+xf_err_t xf_osal_cond_broadcast(xf_osal_cond_t cond);
+
+/**
+ * @brief 删除条件变量。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @param cond 条件变量句柄。从 @ref xf_osal_cond_create() 获取。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_RESOURCE       仍有线程在等待该条件变量
+ *      - XF_ERR_INVALID_ARG    无效参数
+ *      - XF_ERR_ISR            禁止在中断服务函数中调用
+ */
+xf_err_t xf_osal_cond_delete(xf_osal_cond_t cond);
+
+/* ==================== [Macros] ============================================ */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/**
+ * End of defgroup group_xf_osal_cond cond
+ * @}
+ */
+
+#endif // __XF_OSAL_COND_H__
+
+#endif // XF_OSAL_COND_IS_ENABLE
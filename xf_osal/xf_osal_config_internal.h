@@ -64,6 +64,182 @@ extern "C" {
 #define XF_OSAL_QUEUE_IS_ENABLE (0)
 #endif
 
+#if (!defined(XF_OSAL_MSGBUF_ENABLE) || (XF_OSAL_MSGBUF_ENABLE) || defined(__DOXYGEN__))
+#define XF_OSAL_MSGBUF_IS_ENABLE (1)
+#else
+#define XF_OSAL_MSGBUF_IS_ENABLE (0)
+#endif
+
+#if (!defined(XF_OSAL_STREAMBUF_ENABLE) || (XF_OSAL_STREAMBUF_ENABLE) || defined(__DOXYGEN__))
+#define XF_OSAL_STREAMBUF_IS_ENABLE (1)
+#else
+#define XF_OSAL_STREAMBUF_IS_ENABLE (0)
+#endif
+
+/* 条件变量依赖互斥锁 */
+#if ((!defined(XF_OSAL_COND_ENABLE) || (XF_OSAL_COND_ENABLE)) && XF_OSAL_MUTEX_IS_ENABLE) || defined(__DOXYGEN__)
+#define XF_OSAL_COND_IS_ENABLE (1)
+#else
+#define XF_OSAL_COND_IS_ENABLE (0)
+#endif
+
+/* 轻量信号量依赖信号量 */
+#if ((!defined(XF_OSAL_LWSEM_ENABLE) || (XF_OSAL_LWSEM_ENABLE)) && XF_OSAL_SEMAPHORE_IS_ENABLE) || defined(__DOXYGEN__)
+#define XF_OSAL_LWSEM_IS_ENABLE (1)
+#else
+#define XF_OSAL_LWSEM_IS_ENABLE (0)
+#endif
+
+/* 广播通道依赖条件变量 */
+#if ((!defined(XF_OSAL_BROADCAST_ENABLE) || (XF_OSAL_BROADCAST_ENABLE)) && XF_OSAL_COND_IS_ENABLE) || defined(__DOXYGEN__)
+#define XF_OSAL_BROADCAST_IS_ENABLE (1)
+#else
+#define XF_OSAL_BROADCAST_IS_ENABLE (0)
+#endif
+
+/* 等待集合依赖消息队列、信号量或事件中的至少一个 */
+#if ((!defined(XF_OSAL_SELECT_ENABLE) || (XF_OSAL_SELECT_ENABLE)) \
+        && (XF_OSAL_QUEUE_IS_ENABLE || XF_OSAL_SEMAPHORE_IS_ENABLE || XF_OSAL_EVENT_IS_ENABLE)) \
+        || defined(__DOXYGEN__)
+#define XF_OSAL_SELECT_IS_ENABLE (1)
+#else
+#define XF_OSAL_SELECT_IS_ENABLE (0)
+#endif
+
+/* 协程执行器依赖内核与线程 */
+#if ((!defined(XF_OSAL_CORO_ENABLE) || (XF_OSAL_CORO_ENABLE)) && XF_OSAL_KERNEL_IS_ENABLE && XF_OSAL_THREAD_IS_ENABLE) \
+        || defined(__DOXYGEN__)
+#define XF_OSAL_CORO_IS_ENABLE (1)
+#else
+#define XF_OSAL_CORO_IS_ENABLE (0)
+#endif
+
+/* 周期线程依赖内核与线程 */
+#if ((!defined(XF_OSAL_PERIODIC_ENABLE) || (XF_OSAL_PERIODIC_ENABLE)) && XF_OSAL_KERNEL_IS_ENABLE && XF_OSAL_THREAD_IS_ENABLE) \
+        || defined(__DOXYGEN__)
+#define XF_OSAL_PERIODIC_IS_ENABLE (1)
+#else
+#define XF_OSAL_PERIODIC_IS_ENABLE (0)
+#endif
+
+/* 可调度性分析依赖内核与线程 */
+#if ((!defined(XF_OSAL_SCHED_ENABLE) || (XF_OSAL_SCHED_ENABLE)) && XF_OSAL_KERNEL_IS_ENABLE && XF_OSAL_THREAD_IS_ENABLE) \
+        || defined(__DOXYGEN__)
+#define XF_OSAL_SCHED_IS_ENABLE (1)
+#else
+#define XF_OSAL_SCHED_IS_ENABLE (0)
+#endif
+
+/* 限速器依赖内核与线程 */
+#if ((!defined(XF_OSAL_RATELIMIT_ENABLE) || (XF_OSAL_RATELIMIT_ENABLE)) && XF_OSAL_KERNEL_IS_ENABLE && XF_OSAL_THREAD_IS_ENABLE) \
+        || defined(__DOXYGEN__)
+#define XF_OSAL_RATELIMIT_IS_ENABLE (1)
+#else
+#define XF_OSAL_RATELIMIT_IS_ENABLE (0)
+#endif
+
+/**
+ * @brief 调用跟踪记录器，见 xf_osal_trace.h. 依赖内核模块，默认关闭。
+ */
+#if ((defined(XF_OSAL_TRACE_ENABLE) && (XF_OSAL_TRACE_ENABLE)) && XF_OSAL_KERNEL_IS_ENABLE) || defined(__DOXYGEN__)
+#define XF_OSAL_TRACE_IS_ENABLE (1)
+#else
+#define XF_OSAL_TRACE_IS_ENABLE (0)
+#endif
+
+/**
+ * @brief 阻塞时间直方图，见 xf_osal_latency.h. 依赖内核模块，默认关闭。
+ */
+#if ((defined(XF_OSAL_LATENCY_ENABLE) && (XF_OSAL_LATENCY_ENABLE)) && XF_OSAL_KERNEL_IS_ENABLE) || defined(__DOXYGEN__)
+#define XF_OSAL_LATENCY_IS_ENABLE (1)
+#else
+#define XF_OSAL_LATENCY_IS_ENABLE (0)
+#endif
+
+/**
+ * @brief 互斥锁竞争分析，见 xf_osal_mutex_profile.h. 依赖内核、线程与互斥锁模块，默认关闭。
+ */
+#if ((defined(XF_OSAL_MUTEX_PROFILE_ENABLE) && (XF_OSAL_MUTEX_PROFILE_ENABLE)) \
+        && XF_OSAL_KERNEL_IS_ENABLE && XF_OSAL_THREAD_IS_ENABLE && XF_OSAL_MUTEX_IS_ENABLE) \
+        || defined(__DOXYGEN__)
+#define XF_OSAL_MUTEX_PROFILE_IS_ENABLE (1)
+#else
+#define XF_OSAL_MUTEX_PROFILE_IS_ENABLE (0)
+#endif
+
+/* 调用跟踪包装函数，供调用跟踪、阻塞时间直方图与互斥锁竞争分析共用 */
+#if XF_OSAL_TRACE_IS_ENABLE || XF_OSAL_LATENCY_IS_ENABLE || XF_OSAL_MUTEX_PROFILE_IS_ENABLE
+#define XF_OSAL_TRACE_WRAP_IS_ENABLE (1)
+#else
+#define XF_OSAL_TRACE_WRAP_IS_ENABLE (0)
+#endif
+
+/**
+ * @brief 内联快速路径。
+ *
+ * 开启后，信号量、互斥锁、消息队列的热点接口由对接层头文件 xf_osal_port.h
+ * 以 static inline 形式直接提供，省去一次函数调用。默认关闭。
+ * 开启调用跟踪、阻塞时间直方图或互斥锁竞争分析时不生效，以便所有调用都经过跟踪包装函数。
+ */
+#if ((defined(XF_OSAL_INLINE_ENABLE) && (XF_OSAL_INLINE_ENABLE)) && !XF_OSAL_TRACE_WRAP_IS_ENABLE) || defined(__DOXYGEN__)
+#define XF_OSAL_INLINE_IS_ENABLE (1)
+#else
+#define XF_OSAL_INLINE_IS_ENABLE (0)
+#endif
+
+/**
+ * @brief 参数检查。
+ *
+ * 关闭后，快速路径不再检查句柄、指针等参数是否为 NULL，
+ * 可在发布配置中设为 0 以减小开销。默认开启。
+ */
+#if (!defined(XF_OSAL_CHECK_ARGS_ENABLE) || (XF_OSAL_CHECK_ARGS_ENABLE) || defined(__DOXYGEN__))
+#define XF_OSAL_CHECK_ARGS_IS_ENABLE (1)
+#else
+#define XF_OSAL_CHECK_ARGS_IS_ENABLE (0)
+#endif
+
+/**
+ * @brief 分配跟踪钩子，见 xf_osal_kernel_set_alloc_hook(). 依赖内核模块，默认关闭。
+ */
+#if ((defined(XF_OSAL_ALLOC_HOOK_ENABLE) && (XF_OSAL_ALLOC_HOOK_ENABLE)) && XF_OSAL_KERNEL_IS_ENABLE) || defined(__DOXYGEN__)
+#define XF_OSAL_ALLOC_HOOK_IS_ENABLE (1)
+#else
+#define XF_OSAL_ALLOC_HOOK_IS_ENABLE (0)
+#endif
+
+/**
+ * @brief 空闲与睡眠钩子，见 xf_osal_kernel_set_idle_hook(). 依赖内核模块，默认关闭。
+ *
+ * 开启后对接层会接管 RTOS 的空闲钩子（FreeRTOS 的 vApplicationIdleHook()），
+ * 应用程序不得再自行定义。
+ */
+#if ((defined(XF_OSAL_IDLE_HOOK_ENABLE) && (XF_OSAL_IDLE_HOOK_ENABLE)) && XF_OSAL_KERNEL_IS_ENABLE) || defined(__DOXYGEN__)
+#define XF_OSAL_IDLE_HOOK_IS_ENABLE (1)
+#else
+#define XF_OSAL_IDLE_HOOK_IS_ENABLE (0)
+#endif
+
+/**
+ * @brief 控制块对象池大小。
+ *
+ * 未指定 cb_mem 创建对象时，先从对应类型的对象池中取控制块，池空后才从堆上分配，
+ * 避免频繁创建、删除短生命周期对象时产生堆碎片。为 0 时不使用对象池（默认）。
+ *
+ * @note 由对接层实现，不支持的对接层忽略该配置，见 @ref xf_osal_kernel_get_pool_stats().
+ */
+#ifndef XF_OSAL_SEMAPHORE_POOL_SIZE
+#define XF_OSAL_SEMAPHORE_POOL_SIZE (0)
+#endif
+
+#ifndef XF_OSAL_MUTEX_POOL_SIZE
+#define XF_OSAL_MUTEX_POOL_SIZE     (0)
+#endif
+
+#ifndef XF_OSAL_EVENT_POOL_SIZE
+#define XF_OSAL_EVENT_POOL_SIZE     (0)
+#endif
+
 /* ==================== [Typedefs] ========================================== */
 
 /* ==================== [Global Prototypes] ================================= */
@@ -0,0 +1,420 @@
+/**
+ * @file xf_osal_coro.h
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief 无栈协程执行器，在一个线程上运行大量协程。
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * 每个协程只占用一个 xf_osal_coro_t (几十字节) 与调用者自己的会话状态，没有独立的栈，
+ * 适合大量并发会话各自等待消息队列、信号量、事件或定时的场景。
+ *
+ * 协程函数每次被执行器调用时从上次挂起处继续，挂起点用以下宏标记：
+ *
+ * - XF_OSAL_CORO_BEGIN() / XF_OSAL_CORO_END()  包住整个函数体；
+ * - XF_OSAL_CORO_YIELD()                       让出执行权，下一轮继续；
+ * - XF_OSAL_CORO_AWAIT()                       等待 xf_osal_coro_queue_get() 等操作完成，
+ *                                              之后用 xf_osal_coro_result() 取结果。
+ *
+ * 协程函数的局部变量在挂起后 @b 不 保留，需要跨挂起点的状态应保存在 arg 指向的结构体中；
+ * 挂起宏依赖 switch, 不能放在协程函数内另一个 switch 中。
+ *
+ * 典型用法：
+ *
+ * @code
+ * typedef struct {
+ *     xf_osal_coro_t  coro;
+ *     xf_osal_queue_t rx;
+ *     msg_t           msg;
+ * } session_t;
+ *
+ * static xf_osal_coro_status_t session_run(xf_osal_coro_t *coro, void *arg)
+ * {
+ *     session_t *s = (session_t *)arg;
+ *
+ *     XF_OSAL_CORO_BEGIN(coro);
+ *     for (;;) {
+ *         XF_OSAL_CORO_AWAIT(coro, xf_osal_coro_queue_get(coro, s->rx, &s->msg, 1000));
+ *         if (xf_osal_coro_result(coro) != XF_OK) {
+ *             break;
+ *         }
+ *         handle(&s->msg);
+ *     }
+ *     XF_OSAL_CORO_END(coro);
+ * }
+ *
+ * static xf_osal_coro_exec_t s_exec;
+ *
+ * static void exec_thread(void *arg)
+ * {
+ *     xf_osal_coro_exec_run(&s_exec);
+ * }
+ *
+ * xf_osal_coro_exec_init(&s_exec, 1);
+ * xf_osal_coro_spawn(&s_exec, &s->coro, session_run, s, NULL);
+ * @endcode
+ *
+ * @warning 对象的写入接口（xf_osal_queue_put()、xf_osal_semaphore_release()、xf_osal_event_set() 等）
+ *          @b 不会 唤醒执行器。执行器在没有可运行的协程时阻塞在线程通知上，直到最近的超时时间；
+ *          生产者必须在写入后调用 xf_osal_coro_notify(), 否则等待该对象的协程要到 poll_ticks
+ *          轮询或等待超时才会恢复，poll_ticks 为 0 时只能等到超时。
+ *
+ * 生产者向被等待的对象写入后调用 xf_osal_coro_notify(), 执行器立即被唤醒，
+ * 并且只重试等待该对象的协程：
+ *
+ * @code
+ * xf_osal_queue_put(s->rx_queue, &msg, 0, 0);
+ * xf_osal_coro_notify(s->rx_queue);
+ * @endcode
+ *
+ * 无法修改生产者（如第三方驱动直接写入对象）时，可设置 poll_ticks 作为后备，
+ * 执行器最长每 poll_ticks 重试一次所有等待对象的协程。
+ *
+ * C++20 可使用 xf_osal.hpp 中基于 co_await 的 xf_osal::Task.
+ */
+
+#if XF_OSAL_CORO_IS_ENABLE || defined(__DOXYGEN__)
+
+#ifndef __XF_OSAL_CORO_H__
+#define __XF_OSAL_CORO_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_osal_def.h"
+#include "xf_osal_thread.h"
+
+#if XF_OSAL_QUEUE_IS_ENABLE
+#include "xf_osal_queue.h"
+#endif
+
+#if XF_OSAL_SEMAPHORE_IS_ENABLE
+#include "xf_osal_semaphore.h"
+#endif
+
+#if XF_OSAL_EVENT_IS_ENABLE
+#include "xf_osal_event.h"
+#endif
+
+/**
+ * @cond XFAPI_USER
+ * @ingroup group_xf_osal
+ * @defgroup group_xf_osal_coro coro
+ * @brief 无栈协程执行器，在一个线程上运行大量协程。
+ * @endcond
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/**
+ * @brief 执行器线程用于唤醒的线程通知位，执行器线程不应再把该位用于其他用途。
+ *
+ * 默认使用 bit29, 避开 CMSIS-OS2 对接层内部使用的 bit30 (XF_CMSIS_WAKE_FLAG).
+ */
+#ifndef XF_OSAL_CORO_WAKE_FLAG
+#define XF_OSAL_CORO_WAKE_FLAG      (1UL << 29)
+#endif
+
+/* ==================== [Typedefs] ========================================== */
+
+/**
+ * @brief 协程函数的返回值，由挂起宏返回，一般无需直接使用。
+ */
+typedef enum _xf_osal_coro_status_t {
+    XF_OSAL_CORO_STATUS_YIELD = 0,  /*!< 让出执行权，下一轮继续执行 */
+    XF_OSAL_CORO_STATUS_WAIT,       /*!< 等待已登记的操作完成或超时 */
+    XF_OSAL_CORO_STATUS_DONE,       /*!< 执行完毕 */
+} xf_osal_coro_status_t;
+
+typedef struct _xf_osal_coro_t xf_osal_coro_t;
+
+/**
+ * @brief 协程函数。
+ *
+ * @param coro 协程对象。
+ * @param arg  xf_osal_coro_spawn() 传入的参数。
+ * @return xf_osal_coro_status_t 由挂起宏返回。
+ */
+typedef xf_osal_coro_status_t (*xf_osal_coro_func_t)(xf_osal_coro_t *coro, void *arg);
+
+/**
+ * @brief 协程执行完毕时在执行器线程中调用，之后执行器不再访问协程对象，可以在此释放或复用。
+ *
+ * @param coro 协程对象。
+ * @param arg  xf_osal_coro_spawn() 传入的参数。
+ */
+typedef void (*xf_osal_coro_done_cb_t)(xf_osal_coro_t *coro, void *arg);
+
+/**
+ * @brief 协程对象，由调用者分配（可嵌入会话结构体中），不要直接访问成员。
+ *
+ * 首次提交前须清零（静态变量或 memset），执行完毕后可再次提交。
+ */
+struct _xf_osal_coro_t {
+    xf_osal_coro_t         *next;       /*!< 所在链表的下一个协程 */
+    xf_osal_coro_func_t     func;       /*!< 协程函数 */
+    xf_osal_coro_done_cb_t  done;       /*!< 执行完毕回调 */
+    void                   *arg;        /*!< 协程函数参数 */
+    void                   *obj;        /*!< 等待的对象 */
+    void                   *msg;        /*!< 等待消息队列时的消息缓冲区 */
+    uint32_t                flags;      /*!< 等待事件时的标志 */
+    uint32_t                options;    /*!< 等待事件时的选项 */
+    uint32_t                deadline;   /*!< 超时时刻（tick） */
+    xf_err_t                result;     /*!< 最近一次等待的结果 */
+    uint32_t                line;       /*!< 恢复点，0 为函数开头 */
+    uint8_t                 wait;       /*!< 等待类型 */
+    uint8_t                 timed;      /*!< 是否有超时时刻 */
+    uint8_t                 state;      /*!< 协程状态 */
+};
+
+/**
+ * @brief 执行器，由调用者分配，不要直接访问成员。
+ */
+typedef struct _xf_osal_coro_exec_t {
+    xf_osal_coro_t             *volatile pending;   /*!< 其他线程提交、尚未取出的协程 */
+    xf_osal_coro_t             *ready_head;         /*!< 可运行的协程 */
+    xf_osal_coro_t             *ready_tail;
+    xf_osal_coro_t             *wait_head;          /*!< 等待中的协程，按登记顺序 */
+    xf_osal_coro_t            **wait_tail;
+    struct _xf_osal_coro_exec_t *next_exec;         /*!< 已初始化执行器链表 */
+    xf_osal_thread_t volatile   thread;             /*!< 运行执行器的线程 */
+    uint32_t                    poll_ticks;         /*!< 后备轮询间隔 */
+    uint32_t                    poll_last;          /*!< 上次轮询的时刻 */
+    volatile uint32_t           watch;              /*!< 等待中的对象掩码 */
+    volatile uint32_t           signaled;           /*!< 已通知的对象掩码 */
+    volatile uint32_t           stop;               /*!< 请求退出 */
+    volatile uint32_t           count;              /*!< 尚未执行完毕的协程数 */
+} xf_osal_coro_exec_t;
+
+/* ==================== [Global Prototypes] ================================= */
+
+/**
+ * @brief 初始化执行器。
+ *
+ * 执行器会登记到供 xf_osal_coro_notify() 查找的全局链表中，之后须一直有效
+ * （通常为静态变量），并且只能初始化一次。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @param exec       执行器。
+ * @param poll_ticks 后备轮询间隔：有协程等待对象时，最长每隔多少 tick 重试一次全部等待对象。
+ *                   所有生产者都调用 xf_osal_coro_notify() 时填 0, 不轮询。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    无效参数
+ */
+xf_err_t xf_osal_coro_exec_init(xf_osal_coro_exec_t *exec, uint32_t poll_ticks);
+
+/**
+ * @brief 在当前线程中运行执行器，直到调用 xf_osal_coro_exec_stop().
+ *
+ * @note @b 禁止 在中断服务函数中调用。一个执行器只能由一个线程运行。
+ *
+ * @param exec 执行器。
+ * @return xf_err_t
+ *      - XF_OK                 已停止，未执行完毕的协程保留在执行器中
+ *      - XF_ERR_INVALID_ARG    无效参数
+ *      - XF_ERR_ISR            禁止在中断服务函数中调用
+ */
+xf_err_t xf_osal_coro_exec_run(xf_osal_coro_exec_t *exec);
+
+/**
+ * @brief 请求执行器在当前一轮结束后从 xf_osal_coro_exec_run() 返回。
+ *
+ * @note @b 可以 在中断服务函数中调用。
+ *
+ * @param exec 执行器。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    无效参数
+ */
+xf_err_t xf_osal_coro_exec_stop(xf_osal_coro_exec_t *exec);
+
+/**
+ * @brief 唤醒执行器，立即检查等待中的协程。
+ *
+ * @note @b 可以 在中断服务函数中调用。
+ *
+ * @param exec 执行器。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    无效参数
+ */
+xf_err_t xf_osal_coro_exec_wake(xf_osal_coro_exec_t *exec);
+
+/**
+ * @brief 通知对象已写入，唤醒有协程在等待该对象的执行器。
+ *
+ * 执行器只重试等待该对象的协程（以及散列到同一位的其他对象）。
+ * 没有协程在等待该对象时只遍历一遍执行器链表，开销很小。
+ *
+ * @note @b 可以 在中断服务函数中调用。
+ *
+ * @param obj 刚写入的消息队列、信号量或事件句柄。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    无效参数
+ */
+xf_err_t xf_osal_coro_notify(const void *obj);
+
+/**
+ * @brief 获取执行器中尚未执行完毕的协程数。
+ *
+ * @param exec 执行器。
+ * @return uint32_t 协程数。
+ */
+uint32_t xf_osal_coro_exec_get_count(xf_osal_coro_exec_t *exec);
+
+/**
+ * @brief 把协程交给执行器，从协程函数开头开始执行。
+ *
+ * @note @b 可以 在中断服务函数中调用。
+ *
+ * @param exec 执行器。
+ * @param coro 协程对象，执行完毕前须保持有效。
+ * @param func 协程函数。
+ * @param arg  协程函数参数。
+ * @param done 执行完毕回调，可以为 NULL.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_RESOURCE       协程对象已在某个执行器中
+ *      - XF_ERR_INVALID_ARG    无效参数
+ */
+xf_err_t xf_osal_coro_spawn(xf_osal_coro_exec_t *exec, xf_osal_coro_t *coro,
+                            xf_osal_coro_func_t func, void *arg, xf_osal_coro_done_cb_t done);
+
+/**
+ * @brief 获取最近一次等待的结果，与对应阻塞接口的返回值相同。
+ *
+ * @param coro 协程对象。
+ * @return xf_err_t 等待结果。
+ */
+xf_err_t xf_osal_coro_result(const xf_osal_coro_t *coro);
+
+/*
+ * 以下等待操作只能在协程函数中、配合 XF_OSAL_CORO_AWAIT() 使用。
+ * 操作能立即完成（或 timeout 为 0）时返回 true, 协程不挂起；
+ * 否则登记等待并返回 false, 由执行器在完成或超时后恢复协程。
+ * 执行器只在 xf_osal_coro_notify()、poll_ticks 轮询或超时时重试等待，
+ * 对象本身的写入接口不会通知执行器。
+ * timeout 的含义与对应阻塞接口相同，单位 tick.
+ */
+
+/**
+ * @brief 等待一段时间。
+ *
+ * @param coro  协程对象。
+ * @param ticks 等待的 tick 数，为 0 时立即完成。
+ * @return bool 是否已完成。
+ */
+bool xf_osal_coro_sleep(xf_osal_coro_t *coro, uint32_t ticks);
+
+#if XF_OSAL_QUEUE_IS_ENABLE || defined(__DOXYGEN__)
+/**
+ * @brief 等待从消息队列取出一条消息，见 xf_osal_queue_get().
+ *
+ * @note 写入方须在写入后调用 xf_osal_coro_notify(), 否则协程要到轮询或超时才会恢复。
+ *
+ * @param coro    协程对象。
+ * @param queue   消息队列句柄。
+ * @param msg     消息缓冲区，须在等待期间保持有效（不能是协程函数的局部变量）。
+ * @param timeout 超时时间。
+ * @return bool 是否已完成。
+ */
+bool xf_osal_coro_queue_get(xf_osal_coro_t *coro, xf_osal_queue_t queue, void *msg, uint32_t timeout);
+#endif
+
+#if XF_OSAL_SEMAPHORE_IS_ENABLE || defined(__DOXYGEN__)
+/**
+ * @brief 等待获取一个信号量令牌，见 xf_osal_semaphore_acquire().
+ *
+ * @note 写入方须在写入后调用 xf_osal_coro_notify(), 否则协程要到轮询或超时才会恢复。
+ *
+ * @param coro      协程对象。
+ * @param semaphore 信号量句柄。
+ * @param timeout   超时时间。
+ * @return bool 是否已完成。
+ */
+bool xf_osal_coro_semaphore_acquire(xf_osal_coro_t *coro, xf_osal_semaphore_t semaphore, uint32_t timeout);
+#endif
+
+#if XF_OSAL_EVENT_IS_ENABLE || defined(__DOXYGEN__)
+/**
+ * @brief 等待事件标志，见 xf_osal_event_wait().
+ *
+ * @note 写入方须在写入后调用 xf_osal_coro_notify(), 否则协程要到轮询或超时才会恢复。
+ *
+ * @param coro    协程对象。
+ * @param event   事件句柄。
+ * @param flags   需要等待的标志。
+ * @param options 标志选项。
+ * @param timeout 超时时间。
+ * @return bool 是否已完成。
+ */
+bool xf_osal_coro_event_wait(xf_osal_coro_t *coro, xf_osal_event_t event,
+                             uint32_t flags, uint32_t options, uint32_t timeout);
+#endif
+
+/* ==================== [Macros] ============================================ */
+
+/**
+ * @brief 协程函数体开始。
+ */
+#define XF_OSAL_CORO_BEGIN(coro)        switch ((coro)->line) { case 0U:
+
+/**
+ * @brief 协程函数体结束，协程执行完毕。
+ */
+#define XF_OSAL_CORO_END(coro)          } (coro)->line = 0U; return XF_OSAL_CORO_STATUS_DONE
+
+/**
+ * @brief 提前结束协程。
+ */
+#define XF_OSAL_CORO_EXIT(coro)                                                     \
+    do {                                                                            \
+        (coro)->line = 0U;                                                          \
+        return XF_OSAL_CORO_STATUS_DONE;                                            \
+    } while (0)
+
+/**
+ * @brief 让出执行权，执行器运行完其他协程后从此处继续。
+ */
+#define XF_OSAL_CORO_YIELD(coro)                                                    \
+    do {                                                                            \
+        (coro)->line = __LINE__;                                                    \
+        return XF_OSAL_CORO_STATUS_YIELD;                                           \
+    case __LINE__:;                                                                 \
+    } while (0)
+
+/**
+ * @brief 执行等待操作，未能立即完成时挂起，完成或超时后从此处继续。
+ *
+ * @param coro 协程对象。
+ * @param op   xf_osal_coro_sleep() 等等待操作。
+ */
+#define XF_OSAL_CORO_AWAIT(coro, op)                                                \
+    do {                                                                            \
+        (coro)->line = __LINE__;                                                    \
+        if (!(op)) {                                                                \
+            return XF_OSAL_CORO_STATUS_WAIT;                                        \
+        }                                                                           \
+    case __LINE__:;                                                                 \
+    } while (0)
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/**
+ * End of defgroup group_xf_osal_coro coro
+ * @}
+ */
+
+#endif // __XF_OSAL_CORO_H__
+
+#endif // XF_OSAL_CORO_IS_ENABLE
@@ -38,6 +38,19 @@ extern "C" {
 
 /* ==================== [Typedefs] ========================================== */
 
+/**
+ * @brief 内核对象类型。 @ref xf_osal_kernel_get_pool_stats().
+ */
+typedef enum _xf_osal_obj_type_t {
+    XF_OSAL_OBJ_THREAD      = 0,    /*!< 线程. */
+    XF_OSAL_OBJ_TIMER,              /*!< 软件定时器. */
+    XF_OSAL_OBJ_EVENT,              /*!< 事件. */
+    XF_OSAL_OBJ_MUTEX,              /*!< 互斥锁. */
+    XF_OSAL_OBJ_SEMAPHORE,          /*!< 信号量. */
+    XF_OSAL_OBJ_QUEUE,              /*!< 消息队列. */
+    XF_OSAL_OBJ_MAX,                /*!< 类型数量. */
+} xf_osal_obj_type_t;
+
 /* ==================== [Global Prototypes] ================================= */
 
 /* ==================== [Macros] ============================================ */
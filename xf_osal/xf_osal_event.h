@@ -104,6 +104,22 @@ xf_osal_event_t xf_osal_event_create(const xf_osal_event_attr_t *attr);
  */
 xf_err_t xf_osal_event_set(xf_osal_event_t event, uint32_t flags);
 
+/**
+ * @brief 在中断服务函数中设置指定的事件标志。
+ *
+ * 与 xf_osal_event_set() 相同，但跳过中断上下文判断。
+ *
+ * @note @b 只能 在中断服务函数中调用。
+ *
+ * @param event 事件句柄。从 @ref xf_osal_event_create() 获取。
+ * @param flags 需要设置的标志。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_RESOURCE       无法设置（如 FreeRTOS 定时器命令队列已满）
+ *      - XF_ERR_INVALID_ARG    无效参数，句柄无效或 flags 设置了最高位
+ */
+xf_err_t xf_osal_event_set_from_isr(xf_osal_event_t event, uint32_t flags);
+
 /**
  * @brief 清除指定的事件标志。
  *
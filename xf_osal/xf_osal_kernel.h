@@ -56,6 +56,103 @@ typedef enum _xf_osal_state_t {
     XF_OSAL_RESERVED        = 0x7FFFFFFF, /*!< 防止枚举缩小编译器优化. */
 } xf_osal_state_t;
 
+/**
+ * @brief 控制块对象池使用统计。 @ref xf_osal_kernel_get_pool_stats().
+ */
+typedef struct _xf_osal_pool_stats_t {
+    uint32_t                capacity;   /*!< 对象池容量（控制块个数）. */
+    uint32_t                used;       /*!< 当前从对象池取出的控制块个数. */
+    uint32_t                peak;       /*!< used 的历史最大值. */
+    uint32_t                fallback;   /*!< 对象池已空、改为从堆上分配的次数. */
+} xf_osal_pool_stats_t;
+
+/**
+ * @brief 堆使用统计。 @ref xf_osal_kernel_get_heap_stats().
+ *
+ * 对接层无法获得的字段填 0.
+ */
+typedef struct _xf_osal_heap_stats_t {
+    uint32_t                free_size;          /*!< 当前空闲字节数. */
+    uint32_t                min_free_size;      /*!< 历史最小空闲字节数. */
+    uint32_t                largest_free_block; /*!< 最大空闲块字节数，远小于 free_size 时说明碎片严重. */
+    uint32_t                alloc_count;        /*!< 累计成功分配次数. */
+    uint32_t                free_count;         /*!< 累计释放次数. */
+} xf_osal_heap_stats_t;
+
+/**
+ * @brief 延迟执行的函数，见 @ref xf_osal_kernel_defer().
+ *
+ * @param arg1 提交时传入的第一个参数。
+ * @param arg2 提交时传入的第二个参数。
+ */
+typedef void (*xf_osal_defer_func_t)(void *arg1, uint32_t arg2);
+
+/**
+ * @brief 延迟执行队列统计。 @ref xf_osal_kernel_get_defer_stats().
+ */
+typedef struct _xf_osal_defer_stats_t {
+    uint32_t                capacity;   /*!< 队列容量（对接层无法得知时为 0）. */
+    uint32_t                overflow;   /*!< 队列已满、提交失败的累计次数. */
+} xf_osal_defer_stats_t;
+
+#if XF_OSAL_ALLOC_HOOK_IS_ENABLE || defined(__DOXYGEN__)
+
+/**
+ * @brief 分配跟踪钩子的操作类型。
+ */
+typedef enum _xf_osal_alloc_op_t {
+    XF_OSAL_ALLOC_OP_ALLOC  = 0,    /*!< 创建对象时从堆上分配了内存. */
+    XF_OSAL_ALLOC_OP_FREE   = 1,    /*!< 删除对象，若此前记录过该对象的分配，其内存已归还. */
+} xf_osal_alloc_op_t;
+
+/**
+ * @brief 分配跟踪钩子。
+ *
+ * 在创建、删除线程、软件定时器、事件、互斥锁、信号量、消息队列时，于调用线程中被调用。
+ * 钩子内 @b 禁止 再创建或删除 xf_osal 对象。
+ *
+ * @param op    操作类型。
+ * @param type  对象类型。
+ * @param obj   对象句柄，与创建接口返回的句柄相同。
+ * @param name  对象名称，可能为 NULL; XF_OSAL_ALLOC_OP_FREE 时总为 NULL.
+ * @param size  XF_OSAL_ALLOC_OP_ALLOC 时为从堆上分配的字节数（对接层无法得知时为 0）;
+ *              XF_OSAL_ALLOC_OP_FREE 时为 0.
+ */
+typedef void (*xf_osal_alloc_hook_t)(xf_osal_alloc_op_t op, xf_osal_obj_type_t type,
+                                     void *obj, const char *name, uint32_t size);
+
+#endif /* XF_OSAL_ALLOC_HOOK_IS_ENABLE */
+
+#if XF_OSAL_IDLE_HOOK_IS_ENABLE || defined(__DOXYGEN__)
+
+/**
+ * @brief 空闲钩子，在空闲线程中每轮循环调用一次。
+ *
+ * 钩子内 @b 禁止 调用任何可能阻塞的接口。
+ */
+typedef void (*xf_osal_idle_hook_t)(void);
+
+/**
+ * @brief 睡眠钩子，在空闲线程中、调度器暂停期间调用，用于关闭与恢复外设时钟等。
+ */
+typedef struct _xf_osal_sleep_hooks_t {
+    /**
+     * @brief 进入低功耗前调用。
+     *
+     * @param expected_ticks 预计睡眠的滴答数，可改小；置 0 则取消本次睡眠（例如外设仍在工作）。
+     */
+    void (*pre_sleep)(uint32_t *expected_ticks);
+    /**
+     * @brief 唤醒后调用。
+     *
+     * @param expected_ticks 经 pre_sleep 修改后的预计睡眠滴答数，
+     *                       实际睡眠可能因中断提前结束。
+     */
+    void (*post_sleep)(uint32_t expected_ticks);
+} xf_osal_sleep_hooks_t;
+
+#endif /* XF_OSAL_IDLE_HOOK_IS_ENABLE */
+
 /* ==================== [Global Prototypes] ================================= */
 
 /**
@@ -107,8 +204,176 @@ xf_err_t xf_osal_kernel_lock(void);
 xf_err_t xf_osal_kernel_unlock(void);
 
 /**
- * @todo - 添加挂起与恢复 kernel 相关 API，以供低功耗设备使用无滴答操作。
+ * @brief 获取某类内核对象的控制块对象池使用统计。
+ *
+ * 对象池大小由 XF_OSAL_SEMAPHORE_POOL_SIZE 等配置指定，
+ * 可据此调整配置：peak 接近 capacity 或 fallback 不为 0 时应加大对象池。
+ *
+ * @note @b 可以 在中断服务函数中调用。
+ *
+ * @param type  对象类型，见 @ref xf_osal_obj_type_t.
+ * @param stats 返回统计信息。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    无效参数
+ *      - XF_ERR_NOT_SUPPORTED  对接层不支持该类型的对象池
+ */
+xf_err_t xf_osal_kernel_get_pool_stats(xf_osal_obj_type_t type, xf_osal_pool_stats_t *stats);
+
+/**
+ * @brief 获取堆使用统计。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @param stats 返回统计信息。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    无效参数
+ *      - XF_ERR_ISR            禁止在中断服务函数中调用
+ *      - XF_ERR_NOT_SUPPORTED  对接层或所用的堆实现不支持
  */
+xf_err_t xf_osal_kernel_get_heap_stats(xf_osal_heap_stats_t *stats);
+
+#if XF_OSAL_ALLOC_HOOK_IS_ENABLE || defined(__DOXYGEN__)
+/**
+ * @brief 设置分配跟踪钩子，用于统计各对象占用的堆内存。
+ *
+ * 需开启 XF_OSAL_ALLOC_HOOK_ENABLE.
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @param hook 钩子函数，填入 NULL 时取消。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_ISR            禁止在中断服务函数中调用
+ */
+xf_err_t xf_osal_kernel_set_alloc_hook(xf_osal_alloc_hook_t hook);
+#endif
+
+/**
+ * @brief 启动延迟执行的工作线程。
+ *
+ * 在调度器启动前后均可调用，重复调用直接返回 XF_OK. 启动前提交的函数保留在队列中，
+ * 工作线程启动后依次执行。FreeRTOS 对接层使用定时器服务线程，无需启动。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_NO_MEM         无法创建工作线程
+ *      - XF_ERR_ISR            禁止在中断服务函数中调用
+ */
+xf_err_t xf_osal_kernel_defer_init(void);
+
+/**
+ * @brief 提交一个函数到高优先级的工作线程中执行，用于把中断中的耗时处理推迟到线程中完成。
+ *
+ * 多个中断源共用一个工作线程，无需为每个中断源各建一个处理线程。
+ * 队列容量有限，已满时立即返回失败并计入 xf_osal_defer_stats_t::overflow, 不会阻塞。
+ *
+ * - FreeRTOS 对接层基于 xTimerPendFunctionCall(), 在定时器服务线程中执行，
+ *   与软件定时器回调共用 configTIMER_QUEUE_LENGTH 长度的命令队列；
+ * - 其他对接层使用无锁环形队列与 @ref xf_osal_kernel_defer_init() 启动的工作线程。
+ *
+ * 同一工作线程中的函数按提交顺序依次执行，函数中不应长时间阻塞。
+ *
+ * @note @b 可以 在中断服务函数中调用。
+ *
+ * @param func 要执行的函数。
+ * @param arg1 传给函数的第一个参数。
+ * @param arg2 传给函数的第二个参数。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_RESOURCE       队列已满
+ *      - XF_ERR_INVALID_ARG    无效参数
+ *      - XF_ERR_NOT_SUPPORTED  对接层不支持（如 FreeRTOS 未开启 INCLUDE_xTimerPendFunctionCall）
+ */
+xf_err_t xf_osal_kernel_defer(xf_osal_defer_func_t func, void *arg1, uint32_t arg2);
+
+/**
+ * @brief 获取延迟执行队列统计，overflow 不为 0 时应加大队列或减少提交。
+ *
+ * @note @b 可以 在中断服务函数中调用。
+ *
+ * @param stats 返回统计信息。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    无效参数
+ */
+xf_err_t xf_osal_kernel_get_defer_stats(xf_osal_defer_stats_t *stats);
+
+#if XF_OSAL_IDLE_HOOK_IS_ENABLE || defined(__DOXYGEN__)
+/**
+ * @brief 设置空闲钩子。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @param hook 空闲钩子，为 NULL 时取消。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_ISR            禁止在中断服务函数中调用
+ */
+xf_err_t xf_osal_kernel_set_idle_hook(xf_osal_idle_hook_t hook);
+
+/**
+ * @brief 设置睡眠钩子。
+ *
+ * 钩子只在 RTOS 决定进入低功耗时调用：
+ * - FreeRTOS 需开启 configUSE_TICKLESS_IDLE, 并在 FreeRTOSConfig.h 中把
+ *   configPRE_SLEEP_PROCESSING / configPOST_SLEEP_PROCESSING 指向
+ *   xf_osal_port_pre_sleep() / xf_osal_port_post_sleep();
+ * - CMSIS-OS2 需在空闲线程中调用 xf_cmsis_idle_process().
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @param hooks 睡眠钩子，为 NULL 时取消。内容会被复制。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_ISR            禁止在中断服务函数中调用
+ */
+xf_err_t xf_osal_kernel_set_sleep_hooks(const xf_osal_sleep_hooks_t *hooks);
+
+/**
+ * @brief 获取距离下一次唤醒（最近的超时或软件定时器到期）的滴答数。
+ *
+ * 数值在每次准备进入低功耗时由内核计算并记录，只在睡眠窗口内（睡眠钩子中，
+ * 或 xf_osal_kernel_suspend() 与 xf_osal_kernel_resume() 之间）有效。
+ *
+ * @note @b 可以 在中断服务函数中调用。
+ *
+ * @return uint32_t 距离下一次唤醒的滴答数，睡眠窗口之外返回 XF_OSAL_WAIT_FOREVER.
+ */
+uint32_t xf_osal_kernel_get_next_wakeup(void);
+#endif
+
+/**
+ * @brief 暂停 RTOS 内核调度与滴答中断，用于在空闲线程中自行实现无滴答睡眠。
+ *
+ * 返回后应在 sleep_ticks 个滴答内用低功耗定时器唤醒，
+ * 醒来后以实际睡眠的滴答数调用 @ref xf_osal_kernel_resume().
+ *
+ * @note @b 禁止 在中断服务函数中调用，只应在空闲线程中调用。
+ *
+ * @param[out] sleep_ticks 可以睡眠的最长滴答数，没有任何超时时为 XF_OSAL_WAIT_FOREVER.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    无效参数
+ *      - XF_ERR_NOT_SUPPORTED  对接层不支持（FreeRTOS 通过 portSUPPRESS_TICKS_AND_SLEEP 与睡眠钩子实现）
+ */
+xf_err_t xf_osal_kernel_suspend(uint32_t *sleep_ticks);
+
+/**
+ * @brief 恢复 @ref xf_osal_kernel_suspend() 暂停的内核调度，并补偿睡眠期间的滴答。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @param sleep_ticks 实际睡眠的滴答数。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_NOT_SUPPORTED  对接层不支持
+ */
+xf_err_t xf_osal_kernel_resume(uint32_t sleep_ticks);
+
 
 /**
  * @brief 获取 RTOS 内核滴答计数。
@@ -119,6 +384,17 @@ xf_err_t xf_osal_kernel_unlock(void);
  */
 uint32_t xf_osal_kernel_get_tick_count(void);
 
+/**
+ * @brief 在中断服务函数中获取 RTOS 内核滴答计数。
+ *
+ * 与 xf_osal_kernel_get_tick_count() 相同，但跳过中断上下文判断。
+ *
+ * @note @b 只能 在中断服务函数中调用。
+ *
+ * @return uint32_t RTOS 内核当前滴答计数。
+ */
+uint32_t xf_osal_kernel_get_tick_count_from_isr(void);
+
 /**
  * @brief 获取 RTOS 内核滴答频率。
  *
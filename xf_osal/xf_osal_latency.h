@@ -0,0 +1,182 @@
+/**
+ * @file xf_osal_latency.h
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief 阻塞时间直方图，统计线程在各个同步对象上等待了多久。
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * 开启 XF_OSAL_LATENCY_ENABLE 后，通过 xf_osal_latency_attach() 登记的对象，
+ * 其以下调用的耗时（含阻塞时间）按 2 的幂分桶计入该对象的直方图：
+ *
+ * - xf_osal_mutex_acquire()
+ * - xf_osal_semaphore_acquire(), xf_osal_semaphore_acquire_n()
+ * - xf_osal_queue_get(), xf_osal_queue_put()
+ * - xf_osal_event_wait()
+ *
+ * 未登记的对象不统计。时间单位与 XF_OSAL_TRACE_TIMESTAMP() 相同，见 xf_osal_trace.h.
+ *
+ * 典型用法：
+ *
+ * @code
+ * xf_osal_latency_attach(s_uart_mutex, "uart");
+ * xf_osal_latency_attach(s_rx_queue, "rx");
+ * ...
+ * xf_osal_latency_dump(printf);
+ * @endcode
+ */
+
+#if XF_OSAL_LATENCY_IS_ENABLE || defined(__DOXYGEN__)
+
+#ifndef __XF_OSAL_LATENCY_H__
+#define __XF_OSAL_LATENCY_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_osal_def.h"
+
+/**
+ * @cond XFAPI_USER
+ * @ingroup group_xf_osal
+ * @defgroup group_xf_osal_latency latency
+ * @brief 阻塞时间直方图，统计线程在各个同步对象上等待了多久。
+ * @endcond
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/**
+ * @brief 可同时登记的对象数。每个对象约占 150 字节。
+ */
+#ifndef XF_OSAL_LATENCY_OBJ_NUM
+#define XF_OSAL_LATENCY_OBJ_NUM         (16U)
+#endif
+
+/**
+ * @brief 直方图桶数。桶 0 为耗时 0, 桶 i (i >= 1) 为耗时 [2^(i-1), 2^i - 1].
+ */
+#define XF_OSAL_LATENCY_BUCKET_NUM      (33U)
+
+/* ==================== [Typedefs] ========================================== */
+
+/**
+ * @brief 单个对象的统计结果。
+ *
+ * 百分位数取所在桶的上界（不超过 max），误差不超过 2 倍。
+ */
+typedef struct _xf_osal_latency_stats_t {
+    const void *obj;                                /*!< 对象句柄 */
+    const char *name;                               /*!< 登记时的名称 */
+    uint32_t    count;                              /*!< 统计的调用次数 */
+    uint32_t    p50;                                /*!< 中位数 */
+    uint32_t    p99;                                /*!< 99 百分位数 */
+    uint32_t    max;                                /*!< 最大值 */
+    uint32_t    buckets[XF_OSAL_LATENCY_BUCKET_NUM]; /*!< 直方图 */
+} xf_osal_latency_stats_t;
+
+/**
+ * @brief 遍历回调。
+ *
+ * @param stats     对象的统计结果。
+ * @param user_data 用户数据。
+ */
+typedef void (*xf_osal_latency_walk_cb_t)(const xf_osal_latency_stats_t *stats, void *user_data);
+
+/**
+ * @brief 输出函数，格式与 printf 相同。
+ */
+typedef int (*xf_osal_latency_print_t)(const char *format, ...);
+
+/* ==================== [Global Prototypes] ================================= */
+
+/**
+ * @brief 登记对象，开始统计其阻塞时间。对象已登记时只更新名称。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @param obj  对象句柄，如 xf_osal_mutex_t, xf_osal_semaphore_t, xf_osal_queue_t, xf_osal_event_t.
+ * @param name 名称，只保存指针，须在登记期间保持有效。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_NO_MEM         已登记 XF_OSAL_LATENCY_OBJ_NUM 个对象
+ *      - XF_ERR_INVALID_ARG    无效参数
+ */
+xf_err_t xf_osal_latency_attach(const void *obj, const char *name);
+
+/**
+ * @brief 取消登记对象。删除对象前应先取消登记，否则之后创建在同一地址的对象会沿用其统计。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @param obj 对象句柄。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    对象未登记
+ */
+xf_err_t xf_osal_latency_detach(const void *obj);
+
+/**
+ * @brief 获取单个对象的统计结果。
+ *
+ * @param obj        对象句柄。
+ * @param[out] stats 返回统计结果。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    无效参数或对象未登记
+ */
+xf_err_t xf_osal_latency_get_stats(const void *obj, xf_osal_latency_stats_t *stats);
+
+/**
+ * @brief 遍历所有已登记的对象。
+ *
+ * @param cb        遍历回调。
+ * @param user_data 传给回调的用户数据。
+ * @return uint32_t 遍历的对象数。
+ */
+uint32_t xf_osal_latency_walk(xf_osal_latency_walk_cb_t cb, void *user_data);
+
+/**
+ * @brief 按名称逐行输出所有已登记对象的调用次数、p50、p99 与最大值。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @param print 输出函数，如 printf.
+ */
+void xf_osal_latency_dump(xf_osal_latency_print_t print);
+
+/**
+ * @brief 清空所有对象的统计，保留登记。
+ */
+void xf_osal_latency_reset(void);
+
+/**
+ * @brief 把一次调用的耗时计入对象的直方图，对象未登记时忽略。
+ *
+ * @note 由 xf_osal_trace.h 中的包装函数调用，一般无需直接调用。
+ * @note @b 可以 在中断服务函数中调用。
+ *
+ * @param obj      对象句柄。
+ * @param duration 耗时（时间戳单位）。
+ */
+void xf_osal_latency_record(const void *obj, uint32_t duration);
+
+/* ==================== [Macros] ============================================ */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/**
+ * End of defgroup group_xf_osal_latency latency
+ * @}
+ */
+
+#endif // __XF_OSAL_LATENCY_H__
+
+#endif // XF_OSAL_LATENCY_IS_ENABLE
@@ -0,0 +1,180 @@
+/**
+ * @file xf_osal_lwsem.h
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief 轻量信号量，无竞争时不进入内核。
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * 令牌计数保存在原子整数中：有令牌且无人等待时，获取与释放只需一次 CAS,
+ * 只有线程确实需要阻塞或被唤醒时才使用底层的 xf_osal_semaphore.
+ *
+ * 计数为负时表示等待的线程数。
+ */
+
+#if XF_OSAL_LWSEM_IS_ENABLE || defined(__DOXYGEN__)
+
+#ifndef __XF_OSAL_LWSEM_H__
+#define __XF_OSAL_LWSEM_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_osal_def.h"
+#include "xf_osal_atomic.h"
+#include "xf_osal_semaphore.h"
+
+/**
+ * @cond XFAPI_USER
+ * @ingroup group_xf_osal
+ * @defgroup group_xf_osal_lwsem lwsem
+ * @brief 轻量信号量，无竞争时不进入内核。
+ * @endcond
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/**
+ * @brief 轻量信号量对象，由调用者分配（可嵌入其他结构体中），不要直接访问成员。
+ */
+typedef struct _xf_osal_lwsem_t {
+    volatile int32_t    count;      /*!< 可用令牌数，为负时表示等待的线程数 */
+    int32_t             max_count;  /*!< 最大令牌数 */
+    xf_osal_semaphore_t sema;       /*!< 阻塞与唤醒使用的底层信号量 */
+} xf_osal_lwsem_t;
+
+/* ==================== [Global Prototypes] ================================= */
+
+/**
+ * @brief 初始化轻量信号量。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @param lwsem         轻量信号量对象。
+ * @param max_count     可用令牌的最大数量，不超过 INT32_MAX.
+ * @param initial_count 可用令牌的初始数量。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_NO_MEM         无法创建底层信号量
+ *      - XF_ERR_INVALID_ARG    无效参数
+ */
+xf_err_t xf_osal_lwsem_init(xf_osal_lwsem_t *lwsem, uint32_t max_count, uint32_t initial_count);
+
+/**
+ * @brief 反初始化轻量信号量，删除底层信号量。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @param lwsem 轻量信号量对象。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_RESOURCE       仍有线程在等待
+ *      - XF_ERR_INVALID_ARG    无效参数
+ */
+xf_err_t xf_osal_lwsem_deinit(xf_osal_lwsem_t *lwsem);
+
+/**
+ * @brief 获取令牌的慢速路径，由 xf_osal_lwsem_acquire() 在没有可用令牌时调用。
+ */
+xf_err_t xf_osal_lwsem_acquire_slow(xf_osal_lwsem_t *lwsem, uint32_t timeout);
+
+/**
+ * @brief 唤醒一个等待线程，由 xf_osal_lwsem_release() 在有线程等待时调用。
+ */
+xf_err_t xf_osal_lwsem_wake(xf_osal_lwsem_t *lwsem);
+
+/**
+ * @brief 获取一个令牌，如果没有可用令牌则等待，直至超时。
+ *
+ * @note 如果 timeout 为 0，则 @b 可以 在中断服务函数中调用。
+ *
+ * @param lwsem   轻量信号量对象。
+ * @param timeout 超时时间，单位 tick.
+ *      - 如需以 ms 为单位，请配合 @ref xf_osal_kernel_ms_to_ticks() 使用。
+ *      - 一直等待，直到获取到令牌：填入 @ref XF_OSAL_WAIT_FOREVER.
+ *      - 尝试获取，无论成功与否都立刻返回：填入 0.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_TIMEOUT        超时，指定时间内无法获取令牌
+ *      - XF_ERR_RESOURCE       未指定超时时无法获取令牌
+ */
+static inline xf_err_t xf_osal_lwsem_acquire(xf_osal_lwsem_t *lwsem, uint32_t timeout)
+{
+    int32_t old = xf_osal_atomic_load(&lwsem->count);
+
+    while (old > 0) {
+        if (xf_osal_atomic_cas(&lwsem->count, &old, old - 1)) {
+            return XF_OK;
+        }
+    }
+
+    if (timeout == 0U) {
+        return XF_ERR_RESOURCE;
+    }
+
+    return xf_osal_lwsem_acquire_slow(lwsem, timeout);
+}
+
+/**
+ * @brief 释放一个令牌，有线程等待时唤醒其中一个。
+ *
+ * @note @b 可以 在中断服务函数中调用。
+ *
+ * @param lwsem 轻量信号量对象。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_RESOURCE       无法释放（已达到最大令牌计数）
+ */
+static inline xf_err_t xf_osal_lwsem_release(xf_osal_lwsem_t *lwsem)
+{
+    int32_t old = xf_osal_atomic_load(&lwsem->count);
+
+    do {
+        if (old >= lwsem->max_count) {
+            return XF_ERR_RESOURCE;
+        }
+    } while (!xf_osal_atomic_cas(&lwsem->count, &old, old + 1));
+
+    if (old < 0) {
+        return xf_osal_lwsem_wake(lwsem);
+    }
+
+    return XF_OK;
+}
+
+/**
+ * @brief 获取当前可用令牌数。
+ *
+ * @note @b 可以 在中断服务函数中调用。
+ *
+ * @param lwsem 轻量信号量对象。
+ * @return uint32_t 可用令牌的数量。
+ */
+static inline uint32_t xf_osal_lwsem_get_count(xf_osal_lwsem_t *lwsem)
+{
+    int32_t count = xf_osal_atomic_load(&lwsem->count);
+
+    return (count > 0) ? (uint32_t)count : 0U;
+}
+
+/* ==================== [Macros] ============================================ */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/**
+ * End of defgroup group_xf_osal_lwsem lwsem
+ * @}
+ */
+
+#endif // __XF_OSAL_LWSEM_H__
+
+#endif // XF_OSAL_LWSEM_IS_ENABLE
@@ -0,0 +1,213 @@
+/**
+ * @file xf_osal_msgbuf.h
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief 消息缓冲区，传递长度可变的消息。
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * 与消息队列不同，每条消息只占用其实际长度加上长度前缀（sizeof(size_t) 字节）的空间，
+ * 适合长度差异很大的日志、协议帧等数据。
+ *
+ * @note 消息缓冲区假定只有一个写者和一个读者（线程或中断），
+ *       多个线程同时写入或同时读取时，需要调用者自行加锁。
+ */
+
+#if XF_OSAL_MSGBUF_IS_ENABLE || defined(__DOXYGEN__)
+
+#ifndef __XF_OSAL_MSGBUF_H__
+#define __XF_OSAL_MSGBUF_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_osal_def.h"
+
+/**
+ * @cond XFAPI_USER
+ * @ingroup group_xf_osal
+ * @defgroup group_xf_osal_msgbuf msgbuf
+ * @brief 消息缓冲区，传递长度可变的消息。
+ * @endcond
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/**
+ * @brief 消息缓冲区句柄。
+ */
+typedef void *xf_osal_msgbuf_t;
+
+/**
+ * @brief 消息缓冲区的属性结构。
+ */
+typedef struct _xf_osal_msgbuf_attr_t {
+    const char *name;       /*!< 消息缓冲区的名称，指向可读字符串。默认值: NULL. */
+    uint32_t    attr_bits;  /*!< 属性位，保留，默认值: 0. */
+    void       *cb_mem;     /*!< 控制块的内存，默认值: NULL, 即自动动态分配内存。 */
+    uint32_t    cb_size;    /*!< 控制块内存大小（单位字节），不使用静态分配时设为默认值: 0. */
+    void       *buf_mem;    /*!< 用于存储数据的内存，默认值: NULL, 即自动动态分配内存。 */
+    uint32_t    buf_size;   /*!< 数据内存大小（单位字节），不得小于 size + 1. 不使用静态分配时设为默认值: 0. */
+} xf_osal_msgbuf_attr_t;
+
+/* ==================== [Global Prototypes] ================================= */
+
+/**
+ * @brief 创建并初始化消息缓冲区。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @param size 缓冲区总大小（单位字节）。每条消息占用 消息长度 + sizeof(size_t) 字节。
+ * @param attr 消息缓冲区属性。填入 NULL 时使用默认属性。
+ * @return xf_osal_msgbuf_t
+ *      - NULL                  创建失败
+ *      - (OTHER)               消息缓冲区句柄
+ */
+xf_osal_msgbuf_t xf_osal_msgbuf_create(uint32_t size, const xf_osal_msgbuf_attr_t *attr);
+
+/**
+ * @brief 写入一条消息，如果剩余空间不足，则超时。
+ *
+ * @note 如果 timeout 为 0，则 @b 可以 在中断服务函数中调用。
+ *
+ * @param msgbuf    消息缓冲区句柄。从 @ref xf_osal_msgbuf_create() 获取。
+ * @param msg_ptr   指向消息内容的指针。
+ * @param msg_len   消息长度（单位字节），不得为 0.
+ * @param timeout   超时时间，单位 tick.
+ *      - 如需以 ms 为单位，请配合 @ref xf_osal_kernel_ms_to_ticks() 使用。
+ *      - 一直等待，直到成功写入消息（等待语义）：填入 @ref XF_OSAL_WAIT_FOREVER.
+ *      - 尝试写入消息（尝试语义），无论成功与否都立刻返回：填入 0.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_TIMEOUT        超时，无法在给定时间内写入消息
+ *      - XF_ERR_RESOURCE       缓冲区中没有足够的空间
+ *      - XF_ERR_INVALID_ARG    无效参数
+ *      - XF_ERR_NOT_SUPPORTED  对接层不支持
+ */
+xf_err_t xf_osal_msgbuf_send(
+    xf_osal_msgbuf_t msgbuf, const void *msg_ptr, uint32_t msg_len, uint32_t timeout);
+
+/**
+ * @brief 读取一条消息，如果缓冲区为空，则超时。
+ *
+ * @note 如果 timeout 为 0，则 @b 可以 在中断服务函数中调用。
+ *
+ * @param msgbuf        消息缓冲区句柄。从 @ref xf_osal_msgbuf_create() 获取。
+ * @param[out] buf      接收消息的缓冲区。
+ * @param buf_size      接收缓冲区大小（单位字节）。
+ * @param[out] msg_len  返回读到的消息长度，可为 NULL.
+ * @param timeout       超时时间，单位 tick.
+ *      - 如需以 ms 为单位，请配合 @ref xf_osal_kernel_ms_to_ticks() 使用。
+ *      - 一直等待，直到成功读取消息（等待语义）：填入 @ref XF_OSAL_WAIT_FOREVER.
+ *      - 尝试读取消息（尝试语义），无论成功与否都立刻返回：填入 0.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_TIMEOUT        超时，无法在给定时间内读取消息
+ *      - XF_ERR_RESOURCE       缓冲区中没有消息
+ *      - XF_ERR_NO_MEM         接收缓冲区小于下一条消息，消息保留在缓冲区中
+ *      - XF_ERR_INVALID_ARG    无效参数
+ *      - XF_ERR_NOT_SUPPORTED  对接层不支持
+ */
+xf_err_t xf_osal_msgbuf_receive(
+    xf_osal_msgbuf_t msgbuf, void *buf, uint32_t buf_size, uint32_t *msg_len, uint32_t timeout);
+
+/**
+ * @brief 在中断服务函数中尝试写入一条消息。
+ *
+ * 等价于在中断中调用 timeout 为 0 的 xf_osal_msgbuf_send(), 但跳过中断上下文判断。
+ *
+ * @note @b 只能 在中断服务函数中调用。
+ *
+ * @param msgbuf    消息缓冲区句柄。从 @ref xf_osal_msgbuf_create() 获取。
+ * @param msg_ptr   指向消息内容的指针。
+ * @param msg_len   消息长度（单位字节），不得为 0.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_RESOURCE       缓冲区中没有足够的空间
+ *      - XF_ERR_INVALID_ARG    无效参数
+ *      - XF_ERR_NOT_SUPPORTED  对接层不支持
+ */
+xf_err_t xf_osal_msgbuf_send_from_isr(xf_osal_msgbuf_t msgbuf, const void *msg_ptr, uint32_t msg_len);
+
+/**
+ * @brief 在中断服务函数中尝试读取一条消息。
+ *
+ * 等价于在中断中调用 timeout 为 0 的 xf_osal_msgbuf_receive(), 但跳过中断上下文判断。
+ *
+ * @note @b 只能 在中断服务函数中调用。
+ *
+ * @param msgbuf        消息缓冲区句柄。从 @ref xf_osal_msgbuf_create() 获取。
+ * @param[out] buf      接收消息的缓冲区。
+ * @param buf_size      接收缓冲区大小（单位字节）。
+ * @param[out] msg_len  返回读到的消息长度，可为 NULL.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_RESOURCE       缓冲区中没有消息
+ *      - XF_ERR_NO_MEM         接收缓冲区小于下一条消息
+ *      - XF_ERR_INVALID_ARG    无效参数
+ *      - XF_ERR_NOT_SUPPORTED  对接层不支持
+ */
+xf_err_t xf_osal_msgbuf_receive_from_isr(
+    xf_osal_msgbuf_t msgbuf, void *buf, uint32_t buf_size, uint32_t *msg_len);
+
+/**
+ * @brief 获取缓冲区剩余空间（单位字节）。
+ *
+ * 可写入的最长消息为 剩余空间 - sizeof(size_t).
+ *
+ * @note @b 可以 在中断服务函数中调用。
+ *
+ * @param msgbuf 消息缓冲区句柄。从 @ref xf_osal_msgbuf_create() 获取。
+ * @return uint32_t 剩余空间。
+ */
+uint32_t xf_osal_msgbuf_get_space(xf_osal_msgbuf_t msgbuf);
+
+/**
+ * @brief 将消息缓冲区重置为初始空状态。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ * @note 只有没有线程阻塞在该缓冲区上时才能重置。
+ *
+ * @param msgbuf 消息缓冲区句柄。从 @ref xf_osal_msgbuf_create() 获取。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_RESOURCE       有线程阻塞在该缓冲区上
+ *      - XF_ERR_INVALID_ARG    无效参数
+ *      - XF_ERR_ISR            禁止在中断服务函数中调用
+ */
+xf_err_t xf_osal_msgbuf_reset(xf_osal_msgbuf_t msgbuf);
+
+/**
+ * @brief 删除消息缓冲区。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @param msgbuf 消息缓冲区句柄。从 @ref xf_osal_msgbuf_create() 获取。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    无效参数
+ *      - XF_ERR_ISR            禁止在中断服务函数中调用
+ */
+xf_err_t xf_osal_msgbuf_delete(xf_osal_msgbuf_t msgbuf);
+
+/* ==================== [Macros] ============================================ */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/**
+ * End of defgroup group_xf_osal_msgbuf msgbuf
+ * @}
+ */
+
+#endif // __XF_OSAL_MSGBUF_H__
+
+#endif // XF_OSAL_MSGBUF_IS_ENABLE
@@ -187,6 +187,11 @@ xf_err_t xf_osal_mutex_delete(xf_osal_mutex_t mutex);
 
 /* ==================== [Macros] ============================================ */
 
+#if XF_OSAL_INLINE_IS_ENABLE && !defined(XF_OSAL_PORT_SOURCE)
+#define xf_osal_mutex_acquire(mutex, timeout) xf_osal_port_mutex_acquire((mutex), (timeout))
+#define xf_osal_mutex_release(mutex)          xf_osal_port_mutex_release((mutex))
+#endif
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -0,0 +1,146 @@
+/**
+ * @file xf_osal_mutex_profile.h
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief 互斥锁竞争分析，统计每个互斥锁的获取、竞争、等待与持有时间。
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * 开启 XF_OSAL_MUTEX_PROFILE_ENABLE 后，通过 xf_osal_mutex_create() 创建的互斥锁自动登记，
+ * xf_osal_mutex_delete() 时取消登记，每个互斥锁统计：
+ *
+ * - 成功获取次数，其中获取时已被其他线程持有（竞争）的次数，超时或失败的次数；
+ * - 累计与最大等待时间；
+ * - 累计与最大持有时间，以及最大持有时间对应的线程。
+ *
+ * 时间单位与 XF_OSAL_TRACE_TIMESTAMP() 相同，见 xf_osal_trace.h.
+ * 递归获取只统计最外层。在 xf_osal_cond_wait() 中等待的时间不计入持有时间，
+ * 返回时重新获取计为一次获取。
+ *
+ * xf_osal_mutex_profile_report() 按累计等待时间从大到小输出，优先拆分排在前面的锁。
+ */
+
+#if XF_OSAL_MUTEX_PROFILE_IS_ENABLE || defined(__DOXYGEN__)
+
+#ifndef __XF_OSAL_MUTEX_PROFILE_H__
+#define __XF_OSAL_MUTEX_PROFILE_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_osal_def.h"
+#include "xf_osal_thread.h"
+#include "xf_osal_mutex.h"
+
+/**
+ * @cond XFAPI_USER
+ * @ingroup group_xf_osal
+ * @defgroup group_xf_osal_mutex_profile mutex_profile
+ * @brief 互斥锁竞争分析，统计每个互斥锁的获取、竞争、等待与持有时间。
+ * @endcond
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/**
+ * @brief 可同时统计的互斥锁数，超出后创建的互斥锁不统计。
+ */
+#ifndef XF_OSAL_MUTEX_PROFILE_NUM
+#define XF_OSAL_MUTEX_PROFILE_NUM       (16U)
+#endif
+
+/* ==================== [Typedefs] ========================================== */
+
+/**
+ * @brief 单个互斥锁的统计结果。
+ */
+typedef struct _xf_osal_mutex_profile_stats_t {
+    xf_osal_mutex_t     mutex;              /*!< 互斥锁句柄 */
+    const char         *name;               /*!< 创建时属性中的名称 */
+    uint32_t            acquire_count;      /*!< 成功获取次数 */
+    uint32_t            contended_count;    /*!< 获取时已被其他线程持有的次数 */
+    uint32_t            fail_count;         /*!< 超时或失败次数 */
+    uint32_t            max_wait;           /*!< 最大等待时间 */
+    uint64_t            total_wait;         /*!< 累计等待时间，含失败的获取 */
+    uint32_t            max_hold;           /*!< 最大持有时间 */
+    uint64_t            total_hold;         /*!< 累计持有时间 */
+    xf_osal_thread_t    longest_holder;     /*!< 最大持有时间对应的线程 */
+} xf_osal_mutex_profile_stats_t;
+
+/**
+ * @brief 输出函数，格式与 printf 相同。
+ */
+typedef int (*xf_osal_mutex_profile_print_t)(const char *format, ...);
+
+/* ==================== [Global Prototypes] ================================= */
+
+/**
+ * @brief 获取单个互斥锁的统计结果。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @param mutex      互斥锁句柄。
+ * @param[out] stats 返回统计结果。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    无效参数或互斥锁未登记
+ */
+xf_err_t xf_osal_mutex_profile_get_stats(xf_osal_mutex_t mutex, xf_osal_mutex_profile_stats_t *stats);
+
+/**
+ * @brief 获取所有互斥锁的统计结果，按累计等待时间从大到小排列。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @param[out] stats 返回统计结果的数组。
+ * @param max_count  数组长度。
+ * @return uint32_t 写入的个数。
+ */
+uint32_t xf_osal_mutex_profile_snapshot(xf_osal_mutex_profile_stats_t *stats, uint32_t max_count);
+
+/**
+ * @brief 按累计等待时间从大到小逐行输出所有互斥锁的统计结果。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @param print 输出函数，如 printf.
+ */
+void xf_osal_mutex_profile_report(xf_osal_mutex_profile_print_t print);
+
+/**
+ * @brief 清空所有互斥锁的统计，保留登记。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ */
+void xf_osal_mutex_profile_reset(void);
+
+/*
+ * 以下由 xf_osal_trace.h 中的包装函数调用，一般无需直接调用。
+ * 时间参数为 XF_OSAL_TRACE_TIMESTAMP() 的读数。
+ */
+
+void xf_osal_mutex_profile_on_create(xf_osal_mutex_t mutex, const char *name);
+void xf_osal_mutex_profile_on_delete(xf_osal_mutex_t mutex);
+void xf_osal_mutex_profile_on_acquire(
+    xf_osal_mutex_t mutex, xf_osal_thread_t prev_owner, uint32_t start, uint32_t end, xf_err_t err);
+void xf_osal_mutex_profile_on_release(xf_osal_mutex_t mutex, uint32_t now);
+
+/* ==================== [Macros] ============================================ */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/**
+ * End of defgroup group_xf_osal_mutex_profile mutex_profile
+ * @}
+ */
+
+#endif // __XF_OSAL_MUTEX_PROFILE_H__
+
+#endif // XF_OSAL_MUTEX_PROFILE_IS_ENABLE
@@ -0,0 +1,195 @@
+/**
+ * @file xf_osal_periodic.h
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief 周期线程，按绝对截止时刻无漂移地周期执行回调，并统计超时与抖动。
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * 每个周期的截止时刻由上一截止时刻加上周期得到，与回调耗时无关，不会累积漂移。
+ * 回调结束时已经错过下一截止时刻即为一次超时（overrun），之后按策略处理：
+ *
+ * - XF_OSAL_PERIODIC_CATCH_UP  立即连续执行错过的周期，总执行次数不变；
+ * - XF_OSAL_PERIODIC_SKIP      丢弃错过的周期，对齐到原相位上的下一截止时刻。
+ *
+ * 典型用法：
+ *
+ * @code
+ * static xf_osal_periodic_t s_ctrl;
+ *
+ * static void ctrl_loop(void *arg)
+ * {
+ *     pid_update();
+ * }
+ *
+ * xf_osal_periodic_attr_t attr = {0};
+ * attr.thread.name = "ctrl";
+ * attr.thread.priority = XF_OSAL_PRIORITY_HIGH;
+ * attr.policy = XF_OSAL_PERIODIC_SKIP;
+ * xf_osal_periodic_create(&s_ctrl, xf_osal_kernel_ms_to_ticks(5), ctrl_loop, NULL, &attr);
+ * @endcode
+ */
+
+#if XF_OSAL_PERIODIC_IS_ENABLE || defined(__DOXYGEN__)
+
+#ifndef __XF_OSAL_PERIODIC_H__
+#define __XF_OSAL_PERIODIC_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_osal_def.h"
+#include "xf_osal_thread.h"
+
+/**
+ * @cond XFAPI_USER
+ * @ingroup group_xf_osal
+ * @defgroup group_xf_osal_periodic periodic
+ * @brief 周期线程，按绝对截止时刻无漂移地周期执行回调，并统计超时与抖动。
+ * @endcond
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/**
+ * @brief 抖动直方图的桶数。桶 0 为 0 tick, 桶 n 为 [2^(n-1), 2^n) tick, 最后一个桶包含更大的值。
+ */
+#define XF_OSAL_PERIODIC_JITTER_BUCKETS     (8U)
+
+/* ==================== [Typedefs] ========================================== */
+
+/**
+ * @brief 超时后的处理策略。
+ */
+typedef enum _xf_osal_periodic_policy_t {
+    XF_OSAL_PERIODIC_CATCH_UP = 0,  /*!< 立即连续执行错过的周期 */
+    XF_OSAL_PERIODIC_SKIP,          /*!< 丢弃错过的周期，保持相位 */
+} xf_osal_periodic_policy_t;
+
+/**
+ * @brief 周期回调，在周期线程中执行。
+ *
+ * @param arg xf_osal_periodic_create() 传入的参数。
+ */
+typedef void (*xf_osal_periodic_func_t)(void *arg);
+
+/**
+ * @brief 周期线程属性。
+ */
+typedef struct _xf_osal_periodic_attr_t {
+    xf_osal_thread_attr_t       thread;     /*!< 周期线程的属性，全 0 时使用默认属性 */
+    xf_osal_periodic_policy_t   policy;     /*!< 超时后的处理策略，默认值: XF_OSAL_PERIODIC_CATCH_UP. */
+} xf_osal_periodic_attr_t;
+
+/**
+ * @brief 运行统计。
+ */
+typedef struct _xf_osal_periodic_stats_t {
+    uint32_t    run_count;      /*!< 回调执行次数 */
+    uint32_t    overrun_count;  /*!< 回调结束时已错过下一截止时刻的次数 */
+    uint32_t    skip_count;     /*!< XF_OSAL_PERIODIC_SKIP 策略下丢弃的周期数 */
+    uint32_t    max_jitter;     /*!< 回调开始时刻与截止时刻的最大偏差（tick） */
+    uint32_t    jitter_hist[XF_OSAL_PERIODIC_JITTER_BUCKETS];   /*!< 偏差分布，见 XF_OSAL_PERIODIC_JITTER_BUCKETS */
+} xf_osal_periodic_stats_t;
+
+/**
+ * @brief 周期线程对象，由调用者分配，不要直接访问成员。
+ */
+typedef struct _xf_osal_periodic_t {
+    xf_osal_periodic_func_t     func;
+    void                       *arg;
+    xf_osal_thread_t            thread;
+    uint32_t                    period;
+    uint32_t                    deadline;   /*!< 下一截止时刻（tick） */
+    xf_osal_periodic_policy_t   policy;
+    volatile uint32_t           stop;       /*!< 请求停止 */
+    volatile uint32_t           running;    /*!< 周期线程尚未退出 */
+    xf_osal_periodic_stats_t    stats;
+} xf_osal_periodic_t;
+
+/* ==================== [Global Prototypes] ================================= */
+
+/**
+ * @brief 创建周期线程，第一次回调在一个周期之后执行。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @param periodic 周期线程对象，删除前须保持有效。
+ * @param period   周期（tick），不能为 0.
+ * @param func     周期回调。
+ * @param arg      回调参数。
+ * @param attr     属性，填入 NULL 时使用默认属性。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_FAIL               创建线程失败
+ *      - XF_ERR_ISR            禁止在中断服务函数中调用
+ *      - XF_ERR_INVALID_ARG    无效参数
+ */
+xf_err_t xf_osal_periodic_create(xf_osal_periodic_t *periodic, uint32_t period,
+                                 xf_osal_periodic_func_t func, void *arg,
+                                 const xf_osal_periodic_attr_t *attr);
+
+/**
+ * @brief 停止并删除周期线程。
+ *
+ * 不会打断正在执行的回调：周期线程在下一次醒来时退出，因此最多阻塞约一个周期。
+ * 周期线程阻塞在 xf_osal_delay_until() 中，不会被提前唤醒（线程通知的标志位留给回调使用），
+ * 删除者以 xf_osal_delay(1) 轮询它是否已退出，最长约为一个周期加上正在执行的回调的剩余时间，
+ * 期间删除者每个 tick 被唤醒一次。周期很长时应先让回调自行结束工作，再在合适的时机删除。
+ * 返回后 periodic 可以释放或复用。在回调中调用时只请求停止，立即返回，
+ * 此时须等回调返回后才能释放 periodic.
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @param periodic 周期线程对象。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_ISR            禁止在中断服务函数中调用
+ *      - XF_ERR_INVALID_ARG    无效参数
+ */
+xf_err_t xf_osal_periodic_delete(xf_osal_periodic_t *periodic);
+
+/**
+ * @brief 获取运行统计。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @param periodic 周期线程对象。
+ * @param[out] stats 运行统计。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    无效参数
+ */
+xf_err_t xf_osal_periodic_get_stats(xf_osal_periodic_t *periodic, xf_osal_periodic_stats_t *stats);
+
+/**
+ * @brief 清空运行统计。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @param periodic 周期线程对象。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    无效参数
+ */
+xf_err_t xf_osal_periodic_reset_stats(xf_osal_periodic_t *periodic);
+
+/* ==================== [Macros] ============================================ */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/**
+ * End of defgroup group_xf_osal_periodic periodic
+ * @}
+ */
+
+#endif // __XF_OSAL_PERIODIC_H__
+
+#endif // XF_OSAL_PERIODIC_IS_ENABLE
@@ -33,6 +33,20 @@ extern "C" {
 
 /* ==================== [Defines] =========================================== */
 
+/**
+ * @brief 消息队列邮箱（覆盖写）属性。
+ *
+ * @details
+ *
+ * - 邮箱只能容纳 **一条** 消息，创建时 msg_count 必须为 1, 否则创建失败。
+ * - 放入消息时如果邮箱已满，则 **覆盖** 旧消息，因此放入总是立即成功，timeout 被忽略。
+ * - 适合只关心最新值的场景，如传感器读数；配合 @ref xf_osal_queue_peek()
+ *   可让多个读者读取最新值而不取走。
+ *
+ * @note 并非所有平台都支持所有属性，需见具体实现。
+ */
+#define XF_OSAL_QUEUE_OVERWRITE        0x00000001U
+
 /* ==================== [Typedefs] ========================================== */
 
 /**
@@ -45,7 +59,7 @@ typedef void *xf_osal_queue_t;
  */
 typedef struct _xf_osal_queue_attr_t {
     const char *name;       /*!< 消息队列的名称，指向可读字符串。默认值: NULL. */
-    uint32_t    attr_bits;  /*!< 属性位，保留，默认值: 0. */
+    uint32_t    attr_bits;  /*!< 属性位，见 @ref XF_OSAL_QUEUE_OVERWRITE. 默认值: 0. */
     void       *cb_mem;     /*!< 控制块的内存，默认值: NULL, 即自动动态分配内存。 */
     uint32_t    cb_size;    /*!< 控制块内存大小（单位字节），不使用静态分配时设为默认值: 0. */
     void       *mq_mem;     /*!< 用于存储数据的内存，默认值: NULL, 即自动动态分配内存。 */
@@ -113,6 +127,63 @@ xf_err_t xf_osal_queue_put(
 xf_err_t xf_osal_queue_get(
     xf_osal_queue_t queue, void *msg_ptr, uint8_t *msg_prio, uint32_t timeout);
 
+/**
+ * @brief 在中断服务函数中尝试将消息放入队列。
+ *
+ * 等价于在中断中调用 timeout 为 0 的 xf_osal_queue_put(), 但跳过中断上下文判断。
+ *
+ * @note @b 只能 在中断服务函数中调用。
+ *
+ * @param queue     队列句柄。从 @ref xf_osal_queue_create() 获取。
+ * @param msg_ptr   指向缓冲区的指针，其中包含要放入队列的消息。
+ * @param msg_prio  消息优先级。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_RESOURCE       队列中没有足够的空间
+ *      - XF_ERR_INVALID_ARG    无效参数
+ */
+xf_err_t xf_osal_queue_put_from_isr(xf_osal_queue_t queue, const void *msg_ptr, uint8_t msg_prio);
+
+/**
+ * @brief 在中断服务函数中尝试从队列获取消息。
+ *
+ * 等价于在中断中调用 timeout 为 0 的 xf_osal_queue_get(), 但跳过中断上下文判断。
+ *
+ * @note @b 只能 在中断服务函数中调用。
+ *
+ * @param queue         队列句柄。从 @ref xf_osal_queue_create() 获取。
+ * @param[out] msg_ptr  指向从队列获取消息的缓冲区的指针。
+ * @param[out] msg_prio 指向消息优先级缓冲区的指针或 NULL。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_RESOURCE       队列中没有数据
+ *      - XF_ERR_INVALID_ARG    无效参数
+ */
+xf_err_t xf_osal_queue_get_from_isr(xf_osal_queue_t queue, void *msg_ptr, uint8_t *msg_prio);
+
+/**
+ * @brief 读取队首消息但不将其移出队列，如果队列为空，则超时。
+ *
+ * 常与 @ref XF_OSAL_QUEUE_OVERWRITE 配合，多个读者可同时读取邮箱中的最新值。
+ *
+ * @note 如果 timeout 为 0，则 @b 可以 在中断服务函数中调用。
+ * @note 部分对接层只支持读取邮箱模式的队列，其他队列返回 XF_ERR_NOT_SUPPORTED.
+ *
+ * @param queue         队列句柄。从 @ref xf_osal_queue_create() 获取。
+ * @param[out] msg_ptr  指向接收消息的缓冲区的指针。
+ * @param timeout       超时时间，单位 tick.
+ *      - 如需以 ms 为单位，请配合 @ref xf_osal_kernel_ms_to_ticks() 使用。
+ *      - 一直等待，直到队列中有消息（等待语义）：填入 @ref XF_OSAL_WAIT_FOREVER.
+ *      - 尝试读取消息（尝试语义），无论成功与否都立刻返回：填入 0.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_TIMEOUT        超时，无法在给定时间内读取消息
+ *      - XF_ERR_RESOURCE       队列中没有数据
+ *      - XF_ERR_INVALID_ARG    无效参数
+ *      - XF_ERR_NOT_SUPPORTED  对接层不支持
+ */
+xf_err_t xf_osal_queue_peek(xf_osal_queue_t queue, void *msg_ptr, uint32_t timeout);
+
 /**
  * @brief 获取消息队列中排队的消息数。
  *
@@ -145,6 +216,13 @@ xf_err_t xf_osal_queue_delete(xf_osal_queue_t queue);
 
 /* ==================== [Macros] ============================================ */
 
+#if XF_OSAL_INLINE_IS_ENABLE && !defined(XF_OSAL_PORT_SOURCE)
+#define xf_osal_queue_put(queue, msg_ptr, msg_prio, timeout) xf_osal_port_queue_put((queue), (msg_ptr), (msg_prio), (timeout))
+#define xf_osal_queue_get(queue, msg_ptr, msg_prio, timeout) xf_osal_port_queue_get((queue), (msg_ptr), (msg_prio), (timeout))
+#define xf_osal_queue_put_from_isr(queue, msg_ptr, msg_prio) xf_osal_port_queue_put_from_isr((queue), (msg_ptr), (msg_prio))
+#define xf_osal_queue_get_from_isr(queue, msg_ptr, msg_prio) xf_osal_port_queue_get_from_isr((queue), (msg_ptr), (msg_prio))
+#endif
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
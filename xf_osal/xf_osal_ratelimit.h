@@ -0,0 +1,148 @@
+/**
+ * @file xf_osal_ratelimit.h
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief 令牌桶限速器，限制生产者的平均速率与突发量。
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * 令牌以 rate 个每秒的速率产生，桶中最多积攒 burst 个。令牌不由定时器补充，
+ * 而是在获取时根据 xf_osal_kernel_get_tick_count() 与上次状态惰性计算，空闲时没有任何开销。
+ *
+ * 实现上等价于 GCRA（generic cell rate algorithm）：只保存一个“桶被取空的理论时刻”，
+ * 以一次 CAS 更新，因此非阻塞获取 @b 可以 在中断服务函数中调用。
+ *
+ * 内部时间单位为 1 / (rate 与 tick 频率的最小公倍数) 秒，以 32 位回绕计数。
+ * 连续空闲约 2^32 个内部单位后，有 (burst / 2^32) 量级的概率把满桶误判为部分取空，
+ * 此时最多多等待 burst / rate 秒。
+ *
+ * 典型用法：
+ *
+ * @code
+ * static xf_osal_ratelimit_t s_tx_limit;
+ *
+ * xf_osal_ratelimit_init(&s_tx_limit, 100, 10);   // 平均 100 包/秒，最多连续 10 包
+ *
+ * for (;;) {
+ *     if (xf_osal_ratelimit_acquire(&s_tx_limit, 1, xf_osal_kernel_ms_to_ticks(50)) == XF_OK) {
+ *         xf_osal_queue_put(s_tx_queue, &pkt, 0, XF_OSAL_WAIT_FOREVER);
+ *     }
+ * }
+ * @endcode
+ */
+
+#if XF_OSAL_RATELIMIT_IS_ENABLE || defined(__DOXYGEN__)
+
+#ifndef __XF_OSAL_RATELIMIT_H__
+#define __XF_OSAL_RATELIMIT_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_osal_def.h"
+
+/**
+ * @cond XFAPI_USER
+ * @ingroup group_xf_osal
+ * @defgroup group_xf_osal_ratelimit ratelimit
+ * @brief 令牌桶限速器，限制生产者的平均速率与突发量。
+ * @endcond
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/**
+ * @brief 限速器对象，由调用者分配（可嵌入其他结构体中），不要直接访问成员。
+ */
+typedef struct _xf_osal_ratelimit_t {
+    volatile uint32_t   tat;            /*!< 桶被取空的理论时刻（内部单位） */
+    uint32_t            tick_units;     /*!< 每个 tick 的内部单位数 */
+    uint32_t            token_units;    /*!< 每个令牌的内部单位数 */
+    uint32_t            tolerance;      /*!< burst 个令牌的内部单位数 */
+    uint32_t            burst;          /*!< 最大突发令牌数 */
+} xf_osal_ratelimit_t;
+
+/* ==================== [Global Prototypes] ================================= */
+
+/**
+ * @brief 初始化限速器，初始时桶是满的。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @param ratelimit 限速器对象。
+ * @param rate      每秒产生的令牌数，不能为 0.
+ * @param burst     桶容量，即最多可连续获取的令牌数，不能为 0.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    无效参数，或 burst 过大（内部单位超出 INT32_MAX）
+ */
+xf_err_t xf_osal_ratelimit_init(xf_osal_ratelimit_t *ratelimit, uint32_t rate, uint32_t burst);
+
+/**
+ * @brief 尝试获取令牌，不等待。
+ *
+ * @note @b 可以 在中断服务函数中调用。
+ *
+ * @param ratelimit 限速器对象。
+ * @param tokens    令牌数，不超过 burst.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_RESOURCE       可用令牌不足
+ *      - XF_ERR_INVALID_ARG    无效参数
+ */
+xf_err_t xf_osal_ratelimit_try_acquire(xf_osal_ratelimit_t *ratelimit, uint32_t tokens);
+
+/**
+ * @brief 获取令牌，令牌不足时休眠到恰好积攒够为止，直至超时。
+ *
+ * 按当前速率计算出超时前无法积攒够时立即返回 XF_ERR_TIMEOUT, 不会空等到超时。
+ * 醒来后令牌被其他生产者取走时重新计算并继续等待；大量小额获取可能使大额获取一直等待。
+ *
+ * @note 如果 timeout 为 0，则 @b 可以 在中断服务函数中调用。
+ *
+ * @param ratelimit 限速器对象。
+ * @param tokens    令牌数，不超过 burst.
+ * @param timeout   超时时间，单位 tick.
+ *      - 如需以 ms 为单位，请配合 @ref xf_osal_kernel_ms_to_ticks() 使用。
+ *      - 一直等待，直到获取到令牌：填入 @ref XF_OSAL_WAIT_FOREVER.
+ *      - 尝试获取，无论成功与否都立刻返回：填入 0.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_TIMEOUT        超时，指定时间内无法获取令牌
+ *      - XF_ERR_RESOURCE       未指定超时时可用令牌不足
+ *      - XF_ERR_ISR            指定超时时禁止在中断服务函数中调用
+ *      - XF_ERR_INVALID_ARG    无效参数
+ */
+xf_err_t xf_osal_ratelimit_acquire(xf_osal_ratelimit_t *ratelimit, uint32_t tokens, uint32_t timeout);
+
+/**
+ * @brief 获取当前可用令牌数。
+ *
+ * @note @b 可以 在中断服务函数中调用。
+ *
+ * @param ratelimit 限速器对象。
+ * @return uint32_t 可用令牌的数量。
+ */
+uint32_t xf_osal_ratelimit_get_available(xf_osal_ratelimit_t *ratelimit);
+
+/* ==================== [Macros] ============================================ */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/**
+ * End of defgroup group_xf_osal_ratelimit ratelimit
+ * @}
+ */
+
+#endif // __XF_OSAL_RATELIMIT_H__
+
+#endif // XF_OSAL_RATELIMIT_IS_ENABLE
@@ -0,0 +1,171 @@
+/**
+ * @file xf_osal_sched.h
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief 周期线程的可调度性分析与优先级分配。
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * 按截止时间单调（deadline-monotonic，截止时间等于周期时即速率单调）规则分配优先级：
+ * 截止时间越短优先级越高；再用响应时间分析（RTA）逐个计算最坏响应时间
+ *
+ *     R = C + Σ ceil(R / Tj) * Cj    (j 为优先级不低于自身的其他线程)
+ *
+ * 迭代至收敛，R 不超过截止时间即可调度。
+ *
+ * 执行时间 C 取预估值 wcet 与运行时实测最大值中较大者。实测值由
+ * xf_osal_sched_exec_begin() / xf_osal_sched_exec_end() 包住每次执行得到，
+ * 其中包含被更高优先级线程抢占的时间，因此偏保守。
+ *
+ * 所有时间的单位与 XF_OSAL_SCHED_TIMESTAMP() 相同，默认为 tick;
+ * 执行时间远小于 tick 时应把它改为微秒或周期计数器，并同样以该单位填写周期与截止时间。
+ *
+ * 典型用法：
+ *
+ * @code
+ * static xf_osal_sched_task_t s_tasks[] = {
+ *     { .name = "ctrl",  .period = 5,   .wcet = 1 },
+ *     { .name = "comm",  .period = 20,  .wcet = 4, .deadline = 10 },
+ *     { .name = "log",   .period = 100, .wcet = 10 },
+ * };
+ *
+ * static void ctrl_loop(void *arg)
+ * {
+ *     xf_osal_sched_exec_begin(&s_tasks[0]);
+ *     pid_update();
+ *     xf_osal_sched_exec_end(&s_tasks[0]);
+ * }
+ *
+ * s_tasks[0].thread = ...;
+ * if (xf_osal_sched_analyze(s_tasks, 3, XF_OSAL_PRIORITY_NORMOL, XF_OSAL_PRIORITY_REALTIME, true) != XF_OK) {
+ *     xf_osal_sched_report(s_tasks, 3, printf);
+ * }
+ * @endcode
+ */
+
+#if XF_OSAL_SCHED_IS_ENABLE || defined(__DOXYGEN__)
+
+#ifndef __XF_OSAL_SCHED_H__
+#define __XF_OSAL_SCHED_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_osal_def.h"
+#include "xf_osal_thread.h"
+
+/**
+ * @cond XFAPI_USER
+ * @ingroup group_xf_osal
+ * @defgroup group_xf_osal_sched sched
+ * @brief 周期线程的可调度性分析与优先级分配。
+ * @endcond
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/**
+ * @brief 测量执行时间使用的时间戳，默认为 tick.
+ */
+#ifndef XF_OSAL_SCHED_TIMESTAMP
+#define XF_OSAL_SCHED_TIMESTAMP()       xf_osal_kernel_get_tick_count()
+#endif
+
+/* ==================== [Typedefs] ========================================== */
+
+/**
+ * @brief 参与分析的周期线程。输入字段由调用者填写，其余字段由分析与测量接口写入。
+ */
+typedef struct _xf_osal_sched_task_t {
+    /* 输入 */
+    const char         *name;           /*!< 名称，仅用于报告 */
+    xf_osal_thread_t    thread;         /*!< 线程句柄，为 NULL 时只参与分析，不设置优先级 */
+    uint32_t            period;         /*!< 周期（或最小到达间隔），不能为 0 */
+    uint32_t            wcet;           /*!< 预估的最坏执行时间 */
+    uint32_t            deadline;       /*!< 相对截止时间，为 0 时等于周期 */
+
+    /* 测量，见 xf_osal_sched_exec_begin() */
+    uint32_t            observed_wcet;  /*!< 实测最大执行时间 */
+    uint32_t            exec_count;     /*!< 实测执行次数 */
+    uint32_t            exec_start;     /*!< 本次执行的开始时刻 */
+
+    /* 分析结果，见 xf_osal_sched_analyze() */
+    xf_osal_priority_t  priority;       /*!< 分配的优先级 */
+    uint32_t            response;       /*!< 最坏响应时间，超过截止时间后停止迭代 */
+    bool                schedulable;    /*!< 最坏响应时间不超过截止时间 */
+} xf_osal_sched_task_t;
+
+/**
+ * @brief 报告输出函数，与 printf 相同。
+ */
+typedef int (*xf_osal_sched_print_t)(const char *format, ...);
+
+/* ==================== [Global Prototypes] ================================= */
+
+/**
+ * @brief 分配优先级并做响应时间分析。
+ *
+ * 截止时间最短的线程得到 prio_high, 依次递减；线程数多于可用优先级时，
+ * 相邻的线程共用同一优先级，分析时同优先级的线程互相计入干扰。
+ *
+ * 对接层可能把 xf_osal 优先级压缩到更少的 RTOS 优先级（如 FreeRTOS 的 configMAX_PRIORITIES）。
+ * 可用优先级按 xf_osal_thread_get_effective_priority() 计算，只使用映射到不同 RTOS 优先级的值，
+ * 分析时也按等效优先级比较，因此结果与实际调度一致。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @param tasks     线程数组。
+ * @param count     线程数。
+ * @param prio_low  可分配的最低优先级。
+ * @param prio_high 可分配的最高优先级。
+ * @param apply     为 true 时对 thread 不为 NULL 的线程调用 xf_osal_thread_set_priority().
+ * @return xf_err_t
+ *      - XF_OK                 全部可调度
+ *      - XF_FAIL               存在不可调度的线程，见各线程的 schedulable
+ *      - XF_ERR_INVALID_ARG    无效参数
+ */
+xf_err_t xf_osal_sched_analyze(xf_osal_sched_task_t *tasks, uint32_t count,
+                               xf_osal_priority_t prio_low, xf_osal_priority_t prio_high, bool apply);
+
+/**
+ * @brief 标记一次执行开始，与 @ref xf_osal_sched_exec_end() 成对在该线程中调用。
+ *
+ * @param task 线程。
+ */
+void xf_osal_sched_exec_begin(xf_osal_sched_task_t *task);
+
+/**
+ * @brief 标记一次执行结束，更新实测最大执行时间。
+ *
+ * @param task 线程。
+ */
+void xf_osal_sched_exec_end(xf_osal_sched_task_t *task);
+
+/**
+ * @brief 输出可调度性报告：每个线程的周期、截止时间、执行时间、优先级与最坏响应时间，以及总利用率。
+ *
+ * @param tasks 线程数组，应已调用 xf_osal_sched_analyze().
+ * @param count 线程数。
+ * @param print 输出函数。
+ */
+void xf_osal_sched_report(const xf_osal_sched_task_t *tasks, uint32_t count, xf_osal_sched_print_t print);
+
+/* ==================== [Macros] ============================================ */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/**
+ * End of defgroup group_xf_osal_sched sched
+ * @}
+ */
+
+#endif // __XF_OSAL_SCHED_H__
+
+#endif // XF_OSAL_SCHED_IS_ENABLE
@@ -0,0 +1,228 @@
+/**
+ * @file xf_osal_select.h
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief 同时等待多个消息队列、信号量、事件，任意一个就绪即返回。
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * 典型用法：
+ *
+ * @code
+ * xf_osal_select_t set = xf_osal_select_create(QUEUE_LEN_A + QUEUE_LEN_B + 1, NULL);
+ * xf_osal_select_add_queue(set, queue_a);
+ * xf_osal_select_add_queue(set, queue_b);
+ * xf_osal_select_add_semaphore(set, sem);
+ *
+ * for (;;) {
+ *     void *ready;
+ *     xf_osal_select(set, &ready, XF_OSAL_WAIT_FOREVER);
+ *     if (ready == queue_a) {
+ *         xf_osal_queue_get(queue_a, &msg, NULL, 0);
+ *     } else if (ready == sem) {
+ *         xf_osal_semaphore_acquire(sem, 0);
+ *     }
+ *     ...
+ * }
+ * @endcode
+ *
+ * - xf_osal_select() 只报告哪个对象就绪，不会取走消息或令牌，
+ *   调用者需随后以 timeout 为 0 从该对象获取。
+ * - 已加入集合的对象应只通过 xf_osal_select() 等待，不要再直接阻塞等待。
+ * - FreeRTOS 对接层基于队列集，队列集不能包含事件组，
+ *   xf_osal_select_add_event() 总是返回 XF_ERR_NOT_SUPPORTED;
+ *   需要同时等待事件时，由置位方在 xf_osal_event_set() 之后再释放一个已加入集合的信号量。
+ */
+
+#if XF_OSAL_SELECT_IS_ENABLE || defined(__DOXYGEN__)
+
+#ifndef __XF_OSAL_SELECT_H__
+#define __XF_OSAL_SELECT_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_osal_def.h"
+
+#if XF_OSAL_QUEUE_IS_ENABLE
+#include "xf_osal_queue.h"
+#endif
+
+#if XF_OSAL_SEMAPHORE_IS_ENABLE
+#include "xf_osal_semaphore.h"
+#endif
+
+#if XF_OSAL_EVENT_IS_ENABLE
+#include "xf_osal_event.h"
+#endif
+
+/**
+ * @cond XFAPI_USER
+ * @ingroup group_xf_osal
+ * @defgroup group_xf_osal_select select
+ * @brief 同时等待多个消息队列、信号量、事件，任意一个就绪即返回。
+ * @endcond
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/**
+ * @brief 等待集合句柄。
+ */
+typedef void *xf_osal_select_t;
+
+/**
+ * @brief 等待集合的属性结构。
+ */
+typedef struct _xf_osal_select_attr_t {
+    const char *name;       /*!< 等待集合的名称，指向可读字符串。默认值: NULL. */
+    uint32_t    attr_bits;  /*!< 属性位，保留，默认值: 0. */
+    void       *cb_mem;     /*!< 控制块的内存，保留，默认值: NULL. */
+    uint32_t    cb_size;    /*!< 控制块内存大小（单位字节），保留，默认值: 0. */
+} xf_osal_select_attr_t;
+
+/* ==================== [Global Prototypes] ================================= */
+
+/**
+ * @brief 创建等待集合。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @param max_events 集合中可能同时就绪的事件总数，
+ *                   即各消息队列长度、各信号量最大令牌数与事件对象数之和。
+ * @param attr       等待集合属性。填入 NULL 时使用默认属性。
+ * @return xf_osal_select_t
+ *      - NULL                  创建失败
+ *      - (OTHER)               等待集合句柄
+ */
+xf_osal_select_t xf_osal_select_create(uint32_t max_events, const xf_osal_select_attr_t *attr);
+
+#if XF_OSAL_QUEUE_IS_ENABLE || defined(__DOXYGEN__)
+/**
+ * @brief 将消息队列加入等待集合。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ * @note 加入时消息队列应为空。一个对象只能加入一个等待集合。
+ * @note 部分对接层（如 FreeRTOS 队列集）不支持邮箱模式（@ref XF_OSAL_QUEUE_OVERWRITE）的队列，
+ *       此时返回 XF_ERR_NOT_SUPPORTED.
+ *
+ * @param select 等待集合句柄。从 @ref xf_osal_select_create() 获取。
+ * @param queue  消息队列句柄。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_RESOURCE       消息队列非空或已加入其他集合
+ *      - XF_ERR_NOT_SUPPORTED  对接层不支持该队列
+ *      - XF_ERR_INVALID_ARG    无效参数
+ *      - XF_ERR_ISR            禁止在中断服务函数中调用
+ */
+xf_err_t xf_osal_select_add_queue(xf_osal_select_t select, xf_osal_queue_t queue);
+#endif
+
+#if XF_OSAL_SEMAPHORE_IS_ENABLE || defined(__DOXYGEN__)
+/**
+ * @brief 将信号量加入等待集合。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ * @note 加入时信号量令牌数应为 0. 一个对象只能加入一个等待集合。
+ *
+ * @param select    等待集合句柄。从 @ref xf_osal_select_create() 获取。
+ * @param semaphore 信号量句柄。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_RESOURCE       信号量令牌数非 0 或已加入其他集合
+ *      - XF_ERR_INVALID_ARG    无效参数
+ *      - XF_ERR_ISR            禁止在中断服务函数中调用
+ */
+xf_err_t xf_osal_select_add_semaphore(xf_osal_select_t select, xf_osal_semaphore_t semaphore);
+#endif
+
+#if XF_OSAL_EVENT_IS_ENABLE || defined(__DOXYGEN__)
+/**
+ * @brief 将事件加入等待集合，flags 中任意一位被置位即视为就绪。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ * @note FreeRTOS 对接层（队列集）无法等待事件组，总是返回 XF_ERR_NOT_SUPPORTED,
+ *       见文件开头的说明；CMSIS-RTOS2 对接层支持。
+ *
+ * @param select 等待集合句柄。从 @ref xf_osal_select_create() 获取。
+ * @param event  事件句柄。
+ * @param flags  关注的事件标志位。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_NOT_SUPPORTED  对接层不支持等待事件
+ *      - XF_ERR_INVALID_ARG    无效参数
+ *      - XF_ERR_ISR            禁止在中断服务函数中调用
+ */
+xf_err_t xf_osal_select_add_event(xf_osal_select_t select, xf_osal_event_t event, uint32_t flags);
+#endif
+
+/**
+ * @brief 将对象移出等待集合。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @param select 等待集合句柄。从 @ref xf_osal_select_create() 获取。
+ * @param obj    已加入集合的消息队列、信号量或事件句柄。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_RESOURCE       对象不在集合中，或对象非空无法移出
+ *      - XF_ERR_INVALID_ARG    无效参数
+ *      - XF_ERR_ISR            禁止在中断服务函数中调用
+ */
+xf_err_t xf_osal_select_remove(xf_osal_select_t select, void *obj);
+
+/**
+ * @brief 等待集合中任意一个对象就绪。
+ *
+ * @note 如果 timeout 为 0，则 @b 可以 在中断服务函数中调用。
+ *
+ * @param select  等待集合句柄。从 @ref xf_osal_select_create() 获取。
+ * @param ready   返回就绪对象的句柄。
+ * @param timeout 超时时间，单位 tick.
+ *      - 如需以 ms 为单位，请配合 @ref xf_osal_kernel_ms_to_ticks() 使用。
+ *      - 一直等待，直到有对象就绪：填入 @ref XF_OSAL_WAIT_FOREVER.
+ *      - 只检查一次，无论有无对象就绪都立刻返回：填入 0.
+ * @return xf_err_t
+ *      - XF_OK                 成功，*ready 为就绪对象
+ *      - XF_ERR_TIMEOUT        超时
+ *      - XF_ERR_RESOURCE       未指定超时时没有对象就绪
+ *      - XF_ERR_INVALID_ARG    无效参数
+ */
+xf_err_t xf_osal_select(xf_osal_select_t select, void **ready, uint32_t timeout);
+
+/**
+ * @brief 删除等待集合。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ * @note 删除前应先移出所有对象。
+ *
+ * @param select 等待集合句柄。从 @ref xf_osal_select_create() 获取。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_RESOURCE       集合中仍有对象
+ *      - XF_ERR_INVALID_ARG    无效参数
+ *      - XF_ERR_ISR            禁止在中断服务函数中调用
+ */
+xf_err_t xf_osal_select_delete(xf_osal_select_t select);
+
+/* ==================== [Macros] ============================================ */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/**
+ * End of defgroup group_xf_osal_select select
+ * @}
+ */
+
+#endif // __XF_OSAL_SELECT_H__
+
+#endif // XF_OSAL_SELECT_IS_ENABLE
@@ -101,6 +101,80 @@ xf_err_t xf_osal_semaphore_acquire(xf_osal_semaphore_t semaphore, uint32_t timeo
  */
 xf_err_t xf_osal_semaphore_release(xf_osal_semaphore_t semaphore);
 
+/**
+ * @brief 在中断服务函数中尝试获取信号量令牌。
+ *
+ * 等价于在中断中调用 timeout 为 0 的 xf_osal_semaphore_acquire(),
+ * 但跳过中断上下文判断。
+ *
+ * @note @b 只能 在中断服务函数中调用。
+ *
+ * @param semaphore 信号量句柄。从 @ref xf_osal_semaphore_create() 获取。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_RESOURCE       无可用令牌
+ *      - XF_ERR_INVALID_ARG    无效参数
+ */
+xf_err_t xf_osal_semaphore_acquire_from_isr(xf_osal_semaphore_t semaphore);
+
+/**
+ * @brief 在中断服务函数中释放信号量令牌。
+ *
+ * 与 xf_osal_semaphore_release() 相同，但跳过中断上下文判断。
+ *
+ * @note @b 只能 在中断服务函数中调用。
+ *
+ * @param semaphore 信号量句柄。从 @ref xf_osal_semaphore_create() 获取。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_RESOURCE       无法释放（已达到最大令牌计数）
+ *      - XF_ERR_INVALID_ARG    无效参数
+ */
+xf_err_t xf_osal_semaphore_release_from_isr(xf_osal_semaphore_t semaphore);
+
+/**
+ * @brief 一次性获取 n 个信号量令牌，如果可用令牌不足 n 个则等待，直至超时。
+ *
+ * 要么获取全部 n 个令牌，要么一个也不获取，多个线程各自分批获取时不会互相死锁。
+ *
+ * FreeRTOS 对接层中，等待者按优先级排队，同优先级先到先得；
+ * 有线程在等待时，单令牌的 xf_osal_semaphore_acquire() 同样排到队尾，
+ * 不会抢在等待 n 个令牌的线程之前取走令牌。
+ * CMSIS-RTOS2 对接层只能逐 tick 重试，单令牌获取者可能一直抢先，
+ * n 较大时应避免与单令牌获取者长期竞争同一信号量。
+ *
+ * @note 如果 timeout 为 0，则 @b 可以 在中断服务函数中调用。
+ *
+ * @param semaphore 信号量句柄。从 @ref xf_osal_semaphore_create() 获取。
+ * @param n         需要获取的令牌数，不得为 0, 且不超过最大令牌数。
+ * @param timeout   超时时间，单位 tick.
+ *      - 如需以 ms 为单位，请配合 @ref xf_osal_kernel_ms_to_ticks() 使用。
+ *      - 一直等待，直到获取到 n 个令牌：填入 @ref XF_OSAL_WAIT_FOREVER.
+ *      - 尝试获取，无论成功与否都立刻返回：填入 0.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_TIMEOUT        超时，指定时间内无法获取 n 个令牌
+ *      - XF_ERR_RESOURCE       未指定超时时可用令牌不足 n 个
+ *      - XF_ERR_INVALID_ARG    无效参数，或 n 超过最大令牌数（永远无法满足）
+ */
+xf_err_t xf_osal_semaphore_acquire_n(xf_osal_semaphore_t semaphore, uint32_t n, uint32_t timeout);
+
+/**
+ * @brief 一次性释放 n 个信号量令牌。
+ *
+ * 要么释放全部 n 个令牌，要么一个也不释放。
+ *
+ * @note @b 可以 在中断服务函数中调用。
+ *
+ * @param semaphore 信号量句柄。从 @ref xf_osal_semaphore_create() 获取。
+ * @param n         需要释放的令牌数，不得为 0.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_RESOURCE       无法释放（释放后将超过最大令牌计数）
+ *      - XF_ERR_INVALID_ARG    无效参数
+ */
+xf_err_t xf_osal_semaphore_release_n(xf_osal_semaphore_t semaphore, uint32_t n);
+
 /**
  * @brief 获取当前信号量令牌计数。
  *
@@ -114,13 +188,19 @@ uint32_t xf_osal_semaphore_get_count(xf_osal_semaphore_t semaphore);
 /**
  * @brief 删除信号量对象。
  *
+ * 仍有线程阻塞在 xf_osal_semaphore_acquire() 或 xf_osal_semaphore_acquire_n() 上时，
+ * FreeRTOS 对接不删除信号量、不唤醒等待线程，返回 XF_ERR_RESOURCE, 信号量保持可用；
+ * 调用者应先让等待线程返回（释放足够的令牌或等其超时）再重试。
+ * CMSIS-OS2 对接的行为由 osSemaphoreDelete() 决定。
+ * 删除成功后句柄失效，不能再有线程使用。
+ *
  * @note @b 禁止 在中断服务函数中调用。
  *
  * @param semaphore 信号量句柄。从 @ref xf_osal_semaphore_create() 获取。
  * @return xf_err_t
  *      - XF_OK                 成功
  *      - XF_FAIL               通用错误
- *      - XF_ERR_RESOURCE       信号量处于无效状态
+ *      - XF_ERR_RESOURCE       仍有线程在等待该信号量，或信号量处于无效状态
  *      - XF_ERR_INVALID_ARG    无效参数
  *      - XF_ERR_ISR            禁止在中断服务函数中调用
  */
@@ -128,6 +208,13 @@ xf_err_t xf_osal_semaphore_delete(xf_osal_semaphore_t semaphore);
 
 /* ==================== [Macros] ============================================ */
 
+#if XF_OSAL_INLINE_IS_ENABLE && !defined(XF_OSAL_PORT_SOURCE)
+#define xf_osal_semaphore_acquire(semaphore, timeout) xf_osal_port_semaphore_acquire((semaphore), (timeout))
+#define xf_osal_semaphore_release(semaphore)          xf_osal_port_semaphore_release((semaphore))
+#define xf_osal_semaphore_acquire_from_isr(semaphore) xf_osal_port_semaphore_acquire_from_isr((semaphore))
+#define xf_osal_semaphore_release_from_isr(semaphore) xf_osal_port_semaphore_release_from_isr((semaphore))
+#endif
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
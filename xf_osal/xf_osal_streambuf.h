@@ -0,0 +1,240 @@
+/**
+ * @file xf_osal_streambuf.h
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief 流缓冲区，传递不分消息边界的字节流。
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * 阻塞读取的线程在缓冲区中的字节数达到触发水平（trigger level）或超时后才被唤醒，
+ * 可减少逐字节接收时的唤醒次数。
+ *
+ * @note 流缓冲区假定只有一个写者和一个读者（线程或中断），
+ *       多个线程同时写入或同时读取时，需要调用者自行加锁。
+ */
+
+#if XF_OSAL_STREAMBUF_IS_ENABLE || defined(__DOXYGEN__)
+
+#ifndef __XF_OSAL_STREAMBUF_H__
+#define __XF_OSAL_STREAMBUF_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_osal_def.h"
+
+/**
+ * @cond XFAPI_USER
+ * @ingroup group_xf_osal
+ * @defgroup group_xf_osal_streambuf streambuf
+ * @brief 流缓冲区，传递不分消息边界的字节流。
+ * @endcond
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/**
+ * @brief 流缓冲区句柄。
+ */
+typedef void *xf_osal_streambuf_t;
+
+/**
+ * @brief 流缓冲区的属性结构。
+ */
+typedef struct _xf_osal_streambuf_attr_t {
+    const char *name;       /*!< 流缓冲区的名称，指向可读字符串。默认值: NULL. */
+    uint32_t    attr_bits;  /*!< 属性位，保留，默认值: 0. */
+    void       *cb_mem;     /*!< 控制块的内存，默认值: NULL, 即自动动态分配内存。 */
+    uint32_t    cb_size;    /*!< 控制块内存大小（单位字节），不使用静态分配时设为默认值: 0. */
+    void       *buf_mem;    /*!< 用于存储数据的内存，默认值: NULL, 即自动动态分配内存。 */
+    uint32_t    buf_size;   /*!< 数据内存大小（单位字节），不得小于 size + 1. 不使用静态分配时设为默认值: 0. */
+} xf_osal_streambuf_attr_t;
+
+/* ==================== [Global Prototypes] ================================= */
+
+/**
+ * @brief 创建并初始化流缓冲区。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @param size          缓冲区大小（单位字节）。
+ * @param trigger_level 触发水平（单位字节），阻塞读取的线程在缓冲区中至少有这么多字节时被唤醒。
+ *                      填入 0 时按 1 处理，不得大于 size.
+ * @param attr          流缓冲区属性。填入 NULL 时使用默认属性。
+ * @return xf_osal_streambuf_t
+ *      - NULL                  创建失败
+ *      - (OTHER)               流缓冲区句柄
+ */
+xf_osal_streambuf_t xf_osal_streambuf_create(
+    uint32_t size, uint32_t trigger_level, const xf_osal_streambuf_attr_t *attr);
+
+/**
+ * @brief 写入数据，如果剩余空间不足，则等待直至全部写入或超时。
+ *
+ * @note 如果 timeout 为 0，则 @b 可以 在中断服务函数中调用。
+ *
+ * @param streambuf     流缓冲区句柄。从 @ref xf_osal_streambuf_create() 获取。
+ * @param data          指向数据的指针。
+ * @param len           数据长度（单位字节）。
+ * @param[out] sent     返回实际写入的字节数，可为 NULL.
+ * @param timeout       超时时间，单位 tick.
+ *      - 如需以 ms 为单位，请配合 @ref xf_osal_kernel_ms_to_ticks() 使用。
+ *      - 一直等待，直到全部写入（等待语义）：填入 @ref XF_OSAL_WAIT_FOREVER.
+ *      - 尽可能写入，无论写入多少都立刻返回：填入 0.
+ * @return xf_err_t
+ *      - XF_OK                 全部写入
+ *      - XF_ERR_TIMEOUT        超时，只写入了部分数据（见 sent）
+ *      - XF_ERR_RESOURCE       未指定超时时空间不足，只写入了部分数据（见 sent）
+ *      - XF_ERR_INVALID_ARG    无效参数
+ *      - XF_ERR_NOT_SUPPORTED  对接层不支持
+ */
+xf_err_t xf_osal_streambuf_send(
+    xf_osal_streambuf_t streambuf, const void *data, uint32_t len, uint32_t *sent, uint32_t timeout);
+
+/**
+ * @brief 读取数据，如果缓冲区中的字节数未达到触发水平，则等待直至达到或超时。
+ *
+ * @note 如果 timeout 为 0，则 @b 可以 在中断服务函数中调用。
+ *
+ * @param streambuf     流缓冲区句柄。从 @ref xf_osal_streambuf_create() 获取。
+ * @param[out] buf      接收数据的缓冲区。
+ * @param buf_size      接收缓冲区大小（单位字节），即最多读取的字节数。
+ * @param[out] received 返回实际读取的字节数，可为 NULL.
+ * @param timeout       超时时间，单位 tick.
+ *      - 如需以 ms 为单位，请配合 @ref xf_osal_kernel_ms_to_ticks() 使用。
+ *      - 一直等待，直到读到数据（等待语义）：填入 @ref XF_OSAL_WAIT_FOREVER.
+ *      - 尝试读取（尝试语义），无论成功与否都立刻返回：填入 0.
+ * @return xf_err_t
+ *      - XF_OK                 读到至少一个字节
+ *      - XF_ERR_TIMEOUT        超时，没有读到数据
+ *      - XF_ERR_RESOURCE       未指定超时时缓冲区为空
+ *      - XF_ERR_INVALID_ARG    无效参数
+ *      - XF_ERR_NOT_SUPPORTED  对接层不支持
+ */
+xf_err_t xf_osal_streambuf_receive(
+    xf_osal_streambuf_t streambuf, void *buf, uint32_t buf_size, uint32_t *received, uint32_t timeout);
+
+/**
+ * @brief 在中断服务函数中尽可能写入数据。
+ *
+ * 等价于在中断中调用 timeout 为 0 的 xf_osal_streambuf_send(), 但跳过中断上下文判断。
+ *
+ * @note @b 只能 在中断服务函数中调用。
+ *
+ * @param streambuf     流缓冲区句柄。从 @ref xf_osal_streambuf_create() 获取。
+ * @param data          指向数据的指针。
+ * @param len           数据长度（单位字节）。
+ * @param[out] sent     返回实际写入的字节数，可为 NULL.
+ * @return xf_err_t
+ *      - XF_OK                 全部写入
+ *      - XF_ERR_RESOURCE       空间不足，只写入了部分数据（见 sent）
+ *      - XF_ERR_INVALID_ARG    无效参数
+ *      - XF_ERR_NOT_SUPPORTED  对接层不支持
+ */
+xf_err_t xf_osal_streambuf_send_from_isr(
+    xf_osal_streambuf_t streambuf, const void *data, uint32_t len, uint32_t *sent);
+
+/**
+ * @brief 在中断服务函数中尝试读取数据。
+ *
+ * 等价于在中断中调用 timeout 为 0 的 xf_osal_streambuf_receive(), 但跳过中断上下文判断。
+ *
+ * @note @b 只能 在中断服务函数中调用。
+ *
+ * @param streambuf     流缓冲区句柄。从 @ref xf_osal_streambuf_create() 获取。
+ * @param[out] buf      接收数据的缓冲区。
+ * @param buf_size      接收缓冲区大小（单位字节）。
+ * @param[out] received 返回实际读取的字节数，可为 NULL.
+ * @return xf_err_t
+ *      - XF_OK                 读到至少一个字节
+ *      - XF_ERR_RESOURCE       缓冲区为空
+ *      - XF_ERR_INVALID_ARG    无效参数
+ *      - XF_ERR_NOT_SUPPORTED  对接层不支持
+ */
+xf_err_t xf_osal_streambuf_receive_from_isr(
+    xf_osal_streambuf_t streambuf, void *buf, uint32_t buf_size, uint32_t *received);
+
+/**
+ * @brief 获取缓冲区中可读的字节数。
+ *
+ * @note @b 可以 在中断服务函数中调用。
+ *
+ * @param streambuf 流缓冲区句柄。从 @ref xf_osal_streambuf_create() 获取。
+ * @return uint32_t 可读字节数。
+ */
+uint32_t xf_osal_streambuf_get_count(xf_osal_streambuf_t streambuf);
+
+/**
+ * @brief 获取缓冲区剩余空间（单位字节）。
+ *
+ * @note @b 可以 在中断服务函数中调用。
+ *
+ * @param streambuf 流缓冲区句柄。从 @ref xf_osal_streambuf_create() 获取。
+ * @return uint32_t 剩余空间。
+ */
+uint32_t xf_osal_streambuf_get_space(xf_osal_streambuf_t streambuf);
+
+/**
+ * @brief 修改触发水平。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @param streambuf     流缓冲区句柄。从 @ref xf_osal_streambuf_create() 获取。
+ * @param trigger_level 新的触发水平（单位字节），不得大于缓冲区大小。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    无效参数
+ *      - XF_ERR_ISR            禁止在中断服务函数中调用
+ *      - XF_ERR_NOT_SUPPORTED  对接层不支持
+ */
+xf_err_t xf_osal_streambuf_set_trigger_level(xf_osal_streambuf_t streambuf, uint32_t trigger_level);
+
+/**
+ * @brief 将流缓冲区重置为初始空状态。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ * @note 只有没有线程阻塞在该缓冲区上时才能重置。
+ *
+ * @param streambuf 流缓冲区句柄。从 @ref xf_osal_streambuf_create() 获取。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_RESOURCE       有线程阻塞在该缓冲区上
+ *      - XF_ERR_INVALID_ARG    无效参数
+ *      - XF_ERR_ISR            禁止在中断服务函数中调用
+ */
+xf_err_t xf_osal_streambuf_reset(xf_osal_streambuf_t streambuf);
+
+/**
+ * @brief 删除流缓冲区。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @param streambuf 流缓冲区句柄。从 @ref xf_osal_streambuf_create() 获取。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    无效参数
+ *      - XF_ERR_ISR            禁止在中断服务函数中调用
+ */
+xf_err_t xf_osal_streambuf_delete(xf_osal_streambuf_t streambuf);
+
+/* ==================== [Macros] ============================================ */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/**
+ * End of defgroup group_xf_osal_streambuf streambuf
+ * @}
+ */
+
+#endif // __XF_OSAL_STREAMBUF_H__
+
+#endif // XF_OSAL_STREAMBUF_IS_ENABLE
@@ -54,7 +54,13 @@ extern "C" {
 #define XF_OSAL_PRIVIEGED      0x00000004U /*!< 线程在特权模式下运行 */
 
 /**
- * @brief FreeRTOS 对接中，用户可用的线程通知位数(bit0 ~ bit30)。
+ * @brief FreeRTOS 对接中，接口接受的线程通知位数(bit0 ~ bit30)。
+ *
+ * 其中两位另有用途，可移植的应用程序只应使用 bit0 ~ bit28:
+ * - bit29: 协程执行器线程的唤醒位 XF_OSAL_CORO_WAKE_FLAG, 见 xf_osal_coro.h;
+ *   只在执行器线程上保留，其他线程可以使用。
+ * - bit30: CMSIS-OS2 对接层内部的唤醒位 XF_CMSIS_WAKE_FLAG, 条件变量、等待集合等用它唤醒线程；
+ *   FreeRTOS 对接层不使用该位，但为可移植起见同样不应使用。
  */
 #define MAX_BITS_TASK_NOTIFY        31U
 
@@ -150,7 +156,9 @@ typedef struct _xf_osal_thread_attr_t {
                                      */
     uint32_t            stack_size; /*!< 栈内存大小（单位字节），不使用静态分配时设为默认值: 0. */
     xf_osal_priority_t  priority;   /*!< 线程优先级，默认值: XF_OSAL_PRIORITY_NORMOL. */
-    uint32_t            reserved;   /*!< 保留，必须为 0. */
+    uint32_t            affinity_mask;  /*!< 允许运行的处理器核掩码（bit n 对应核 n），
+                                         *   默认值: 0, 即不限制。单核系统忽略该字段。
+                                         */
 } xf_osal_thread_attr_t;
 
 /**
@@ -163,6 +171,19 @@ typedef void *xf_osal_thread_t;
  */
 typedef void (*xf_osal_thread_func_t)(void *argument);
 
+/**
+ * @brief 线程局部存储的键，由 @ref xf_osal_tls_alloc() 分配。
+ */
+typedef uint32_t xf_osal_tls_key_t;
+
+/**
+ * @brief 线程局部存储的析构函数，线程通过 @ref xf_osal_thread_delete() 删除时
+ *        对其中不为 NULL 的值调用。
+ *
+ * @param value 该线程对应键的值。
+ */
+typedef void (*xf_osal_tls_destructor_t)(void *value);
+
 /* ==================== [Global Prototypes] ================================= */
 
 /**
@@ -255,6 +276,52 @@ xf_err_t xf_osal_thread_set_priority(
  */
 xf_osal_priority_t xf_osal_thread_get_priority(xf_osal_thread_t thread);
 
+/**
+ * @brief 获取优先级经对接层映射后实际生效的等效值。
+ *
+ * 对接层可能把 xf_osal 优先级压缩到更少的 RTOS 优先级（如 FreeRTOS 的 configMAX_PRIORITIES）,
+ * 两个优先级的等效值相同，说明它们落在同一 RTOS 优先级上，运行时互不抢占。
+ *
+ * @note @b 可以 在中断服务函数中调用。
+ *
+ * @param priority 优先级。
+ * @return xf_osal_priority_t 等效优先级，即以该优先级创建线程后 xf_osal_thread_get_priority() 的返回值。
+ */
+xf_osal_priority_t xf_osal_thread_get_effective_priority(xf_osal_priority_t priority);
+
+/**
+ * @brief 设置线程允许运行的处理器核。
+ *
+ * 把对延迟敏感的线程固定在某个核上，可避免在核间迁移导致缓存失效。
+ * 单核系统中 mask 为 0 或包含 bit0 时直接返回 XF_OK.
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @param thread 线程句柄。
+ * @param mask 核掩码（bit n 对应核 n），为 0 时不限制。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_ISR            禁止在中断服务函数中调用
+ *      - XF_ERR_INVALID_ARG    无效参数（如掩码中没有存在的核）
+ *      - XF_ERR_NOT_SUPPORTED  对接层不支持创建后修改（如 ESP-IDF 只能在创建时通过 affinity_mask 指定）
+ */
+xf_err_t xf_osal_thread_set_affinity(xf_osal_thread_t thread, uint32_t mask);
+
+/**
+ * @brief 获取线程允许运行的处理器核。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @param thread 线程句柄。
+ * @param[out] mask 核掩码（bit n 对应核 n），不限制时返回所有核。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_ISR            禁止在中断服务函数中调用
+ *      - XF_ERR_INVALID_ARG    无效参数
+ *      - XF_ERR_NOT_SUPPORTED  对接层不支持
+ */
+xf_err_t xf_osal_thread_get_affinity(xf_osal_thread_t thread, uint32_t *mask);
+
 /**
  * @brief 将控制权传递给处于状态 @b READY 的下一个线程。
  *
@@ -364,6 +431,8 @@ uint32_t xf_osal_thread_enumerate(
  * @brief 设置线程的指定线程标志。
  *
  * @note @b 可以 在中断服务函数中调用。
+ * @note bit29 与 bit30 保留给协程执行器与 CMSIS-OS2 对接层，见 @ref MAX_BITS_TASK_NOTIFY.
+ *       接口不拒绝这两位（执行器自身要通过本接口设置 bit29），误用会产生虚假唤醒。
  *
  * @param thread    线程句柄。
  * @param notify    指定应设置的线程标志。
@@ -377,6 +446,22 @@ uint32_t xf_osal_thread_enumerate(
  */
 xf_err_t xf_osal_thread_notify_set(xf_osal_thread_t thread, uint32_t notify);
 
+/**
+ * @brief 在中断服务函数中设置线程的指定线程标志。
+ *
+ * 与 xf_osal_thread_notify_set() 相同，但跳过中断上下文判断。
+ *
+ * @note @b 只能 在中断服务函数中调用。
+ *
+ * @param thread    线程句柄。
+ * @param notify    指定应设置的线程标志。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_FAIL               通用错误
+ *      - XF_ERR_INVALID_ARG    无效参数，参数标志设置了最高位
+ */
+xf_err_t xf_osal_thread_notify_set_from_isr(xf_osal_thread_t thread, uint32_t notify);
+
 /**
  * @brief 清除当前运行线程的指定线程标志。
  *
@@ -411,7 +496,7 @@ uint32_t xf_osal_thread_notify_get(void);
  *      - 见 @ref XF_OSAL_WAIT_ALL.
  *      - 见 @ref XF_OSAL_NO_CLEAR.
  * @param timeout 超时值，单位 ticks.
- *                可以为 0 或 @ref XF_OSAL_WAIT_FOREVER.
+ *                为 0 时只检查一次，不阻塞；可以为 @ref XF_OSAL_WAIT_FOREVER.
  * @return xf_err_t
  *      - XF_OK                 成功
  *      - XF_FAIL               通用错误
@@ -470,6 +555,68 @@ xf_err_t xf_osal_delay_until(uint32_t ticks);
  */
 xf_err_t xf_osal_delay_ms(uint32_t ms);
 
+/**
+ * @brief 分配一个线程局部存储键，所有线程中该键的值初始为 NULL.
+ *
+ * - FreeRTOS 对接层使用任务的线程局部存储指针（configNUM_THREAD_LOCAL_STORAGE_POINTERS）;
+ * - CMSIS-OS2 对接层使用按线程 ID 散列的槽位表，见 xf_cmsis_os2_config.h.
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @param[out] key 返回分配的键。
+ * @param destructor 析构函数，可为 NULL.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_NO_MEM         键已用完
+ *      - XF_ERR_ISR            禁止在中断服务函数中调用
+ *      - XF_ERR_INVALID_ARG    无效参数
+ */
+xf_err_t xf_osal_tls_alloc(xf_osal_tls_key_t *key, xf_osal_tls_destructor_t destructor);
+
+/**
+ * @brief 释放线程局部存储键。
+ *
+ * 各线程中残留的值被清为 NULL, 但不会对其调用析构函数，释放前应由使用者自行清理。
+ * 之后复用该键时不会读到旧值。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ * @note FreeRTOS 对接层需开启 configUSE_TRACE_FACILITY 才能遍历线程清除旧值；
+ *       未开启时释放的键不再复用。
+ *
+ * @param key 线程局部存储键。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_NO_MEM         无法分配遍历线程所需的内存
+ *      - XF_ERR_ISR            禁止在中断服务函数中调用
+ *      - XF_ERR_INVALID_ARG    无效参数
+ */
+xf_err_t xf_osal_tls_free(xf_osal_tls_key_t key);
+
+/**
+ * @brief 设置当前线程中该键的值。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @param key 线程局部存储键。
+ * @param value 值。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_NO_MEM         没有空闲的线程槽位（仅 CMSIS-OS2 对接层）
+ *      - XF_ERR_ISR            禁止在中断服务函数中调用
+ *      - XF_ERR_INVALID_ARG    无效参数
+ */
+xf_err_t xf_osal_tls_set(xf_osal_tls_key_t key, void *value);
+
+/**
+ * @brief 获取当前线程中该键的值。不加锁，耗时与线程数无关。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @param key 线程局部存储键。
+ * @return void* 值，未设置、键无效或在中断中调用时返回 NULL.
+ */
+void *xf_osal_tls_get(xf_osal_tls_key_t key);
+
 /* ==================== [Macros] ============================================ */
 
 #ifdef __cplusplus
@@ -0,0 +1,405 @@
+/**
+ * @file xf_osal_trace.h
+ * @author cangyu (sky.kirto@qq.com)
+ * @brief 调用跟踪记录器，把 xf_osal 接口调用记录到内存环形缓冲区。
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * 开启 XF_OSAL_TRACE_ENABLE 后，本文件把线程、定时器、事件、互斥锁、信号量、
+ * 消息队列、条件变量、消息/流缓冲区、等待集合的操作接口重定向到同名的
+ * xf_osal_trace_* 包装函数，包装函数调用原接口并记录：
+ * 开始时间戳、耗时（含阻塞时间）、线程、对象句柄、操作与返回值。
+ *
+ * - 每个核一个环形缓冲区，写入只需一次原子加，不加锁、不关中断，满后覆盖最旧的记录。
+ * - 缓冲区布局固定（见 @ref xf_osal_trace_buf_t），可由调试器直接导出内存，
+ *   再用 tools/xf_osal_trace_decode.py 转换为 Chrome / Perfetto 可打开的 JSON.
+ * - 创建、删除与只读查询接口不记录。
+ * - 开启后内联快速路径（XF_OSAL_INLINE_ENABLE）自动失效。
+ *
+ * 包装函数同时是其他调用统计功能（xf_osal_latency.h, xf_osal_mutex_profile.h）的插桩点，
+ * 开启其中任意一项时都会启用包装函数，只有开启 XF_OSAL_TRACE_ENABLE 时才写入环形缓冲区。
+ */
+
+#if XF_OSAL_TRACE_WRAP_IS_ENABLE || defined(__DOXYGEN__)
+
+#ifndef __XF_OSAL_TRACE_H__
+#define __XF_OSAL_TRACE_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_osal_def.h"
+
+/**
+ * @cond XFAPI_USER
+ * @ingroup group_xf_osal
+ * @defgroup group_xf_osal_trace trace
+ * @brief 调用跟踪记录器，把 xf_osal 接口调用记录到内存环形缓冲区。
+ * @endcond
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/**
+ * @brief 时间戳及其频率（Hz），调用跟踪与其他调用统计功能共用。
+ *
+ * 默认使用内核滴答，分辨率很低，建议改为 CPU 周期计数器，例如 Cortex-M 的 DWT->CYCCNT.
+ * 时间戳按 uint32_t 回绕。
+ */
+#ifndef XF_OSAL_TRACE_TIMESTAMP
+#define XF_OSAL_TRACE_TIMESTAMP()       xf_osal_kernel_get_tick_count()
+#define XF_OSAL_TRACE_TIMESTAMP_FREQ()  xf_osal_kernel_get_tick_freq()
+#endif
+
+#if XF_OSAL_TRACE_IS_ENABLE || defined(__DOXYGEN__)
+
+/**
+ * @brief 每个核的环形缓冲区可保存的记录数，必须是 2 的幂。每条记录 20 字节。
+ */
+#ifndef XF_OSAL_TRACE_RING_SIZE
+#define XF_OSAL_TRACE_RING_SIZE         (256U)
+#endif
+
+/**
+ * @brief 核数量与获取当前核编号（0 ~ XF_OSAL_TRACE_CORE_NUM - 1）的方法。
+ */
+#ifndef XF_OSAL_TRACE_CORE_NUM
+#define XF_OSAL_TRACE_CORE_NUM          (1U)
+#define XF_OSAL_TRACE_CORE_ID()         (0U)
+#endif
+
+#define XF_OSAL_TRACE_MAGIC             (0x52544658U)   /*!< "XFTR" */
+#define XF_OSAL_TRACE_VERSION           (1U)            /*!< 缓冲区布局版本 */
+
+#endif /* XF_OSAL_TRACE_IS_ENABLE */
+
+/* ==================== [Typedefs] ========================================== */
+
+/**
+ * @brief 被记录的操作。
+ *
+ * @note 数值写入缓冲区，修改时需同步修改 tools/xf_osal_trace_decode.py.
+ */
+typedef enum _xf_osal_trace_op_t {
+    XF_OSAL_TRACE_OP_CALIBRATE                  = 0,    /*!< xf_osal_trace_calibrate() 写入的测量记录. */
+
+    XF_OSAL_TRACE_OP_THREAD_YIELD               = 1,
+    XF_OSAL_TRACE_OP_THREAD_SUSPEND             = 2,
+    XF_OSAL_TRACE_OP_THREAD_RESUME              = 3,
+    XF_OSAL_TRACE_OP_THREAD_NOTIFY_SET          = 4,
+    XF_OSAL_TRACE_OP_THREAD_NOTIFY_SET_FROM_ISR = 5,
+    XF_OSAL_TRACE_OP_THREAD_NOTIFY_WAIT         = 6,
+    XF_OSAL_TRACE_OP_DELAY                      = 7,
+    XF_OSAL_TRACE_OP_DELAY_UNTIL                = 8,
+    XF_OSAL_TRACE_OP_DELAY_MS                   = 9,
+
+    XF_OSAL_TRACE_OP_TIMER_START                = 16,
+    XF_OSAL_TRACE_OP_TIMER_STOP                 = 17,
+
+    XF_OSAL_TRACE_OP_EVENT_SET                  = 24,
+    XF_OSAL_TRACE_OP_EVENT_SET_FROM_ISR         = 25,
+    XF_OSAL_TRACE_OP_EVENT_CLEAR                = 26,
+    XF_OSAL_TRACE_OP_EVENT_WAIT                 = 27,
+
+    XF_OSAL_TRACE_OP_MUTEX_ACQUIRE              = 32,
+    XF_OSAL_TRACE_OP_MUTEX_RELEASE              = 33,
+
+    XF_OSAL_TRACE_OP_SEMAPHORE_ACQUIRE          = 40,
+    XF_OSAL_TRACE_OP_SEMAPHORE_RELEASE          = 41,
+    XF_OSAL_TRACE_OP_SEMAPHORE_ACQUIRE_FROM_ISR = 42,
+    XF_OSAL_TRACE_OP_SEMAPHORE_RELEASE_FROM_ISR = 43,
+    XF_OSAL_TRACE_OP_SEMAPHORE_ACQUIRE_N        = 44,
+    XF_OSAL_TRACE_OP_SEMAPHORE_RELEASE_N        = 45,
+
+    XF_OSAL_TRACE_OP_QUEUE_PUT                  = 48,
+    XF_OSAL_TRACE_OP_QUEUE_GET                  = 49,
+    XF_OSAL_TRACE_OP_QUEUE_PUT_FROM_ISR         = 50,
+    XF_OSAL_TRACE_OP_QUEUE_GET_FROM_ISR         = 51,
+    XF_OSAL_TRACE_OP_QUEUE_PEEK                 = 52,
+
+    XF_OSAL_TRACE_OP_COND_WAIT                  = 56,
+    XF_OSAL_TRACE_OP_COND_TIMEDWAIT             = 57,
+    XF_OSAL_TRACE_OP_COND_SIGNAL                = 58,
+    XF_OSAL_TRACE_OP_COND_BROADCAST             = 59,
+
+    XF_OSAL_TRACE_OP_MSGBUF_SEND                = 64,
+    XF_OSAL_TRACE_OP_MSGBUF_RECEIVE             = 65,
+    XF_OSAL_TRACE_OP_STREAMBUF_SEND             = 66,
+    XF_OSAL_TRACE_OP_STREAMBUF_RECEIVE          = 67,
+
+    XF_OSAL_TRACE_OP_SELECT                     = 72,
+} xf_osal_trace_op_t;
+
+#if XF_OSAL_TRACE_IS_ENABLE || defined(__DOXYGEN__)
+
+/**
+ * @brief 一条跟踪记录（20 字节，小端）。
+ */
+typedef struct _xf_osal_trace_event_t {
+    uint32_t    timestamp;  /*!< 调用开始时间戳 */
+    uint32_t    duration;   /*!< 调用耗时（时间戳单位），包含阻塞时间 */
+    uint32_t    thread;     /*!< 调用线程句柄的低 32 位 */
+    uint32_t    obj;        /*!< 对象句柄的低 32 位，没有对象时为 0 */
+    uint16_t    op;         /*!< 操作，见 @ref xf_osal_trace_op_t */
+    int16_t     result;     /*!< 返回值 xf_err_t */
+} xf_osal_trace_event_t;
+
+/**
+ * @brief 单个核的环形缓冲区。
+ */
+typedef struct _xf_osal_trace_ring_t {
+    volatile uint32_t       head;       /*!< 累计写入的记录数，下一条记录位于 head % XF_OSAL_TRACE_RING_SIZE */
+    uint32_t                reserved;
+    xf_osal_trace_event_t   events[XF_OSAL_TRACE_RING_SIZE];
+} xf_osal_trace_ring_t;
+
+/**
+ * @brief 跟踪缓冲区，导出时从头部开始整体导出。
+ */
+typedef struct _xf_osal_trace_buf_t {
+    uint32_t                magic;          /*!< @ref XF_OSAL_TRACE_MAGIC */
+    uint16_t                version;        /*!< @ref XF_OSAL_TRACE_VERSION */
+    uint16_t                event_size;     /*!< sizeof(xf_osal_trace_event_t) */
+    uint32_t                core_num;       /*!< 环形缓冲区个数 */
+    uint32_t                ring_size;      /*!< 每个环形缓冲区的记录数 */
+    uint32_t                timestamp_freq; /*!< 时间戳频率（Hz） */
+    uint32_t                overhead;       /*!< 每条记录的开销（时间戳单位），见 @ref xf_osal_trace_calibrate() */
+    xf_osal_trace_ring_t    rings[XF_OSAL_TRACE_CORE_NUM];
+} xf_osal_trace_buf_t;
+
+#endif /* XF_OSAL_TRACE_IS_ENABLE */
+
+/* ==================== [Global Prototypes] ================================= */
+
+#if XF_OSAL_TRACE_IS_ENABLE || defined(__DOXYGEN__)
+
+/**
+ * @brief 开始记录。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ */
+void xf_osal_trace_start(void);
+
+/**
+ * @brief 停止记录。导出缓冲区前应先停止，以免导出到写了一半的记录。
+ *
+ * @note @b 可以 在中断服务函数中调用。
+ */
+void xf_osal_trace_stop(void);
+
+/**
+ * @brief 清空所有环形缓冲区。应在停止记录后调用。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ */
+void xf_osal_trace_reset(void);
+
+/**
+ * @brief 测量每条记录的开销并写入缓冲区头部。
+ *
+ * 连续写入若干条 XF_OSAL_TRACE_OP_CALIBRATE 记录（解码时忽略），取平均值。
+ * 开销与被跟踪接口本身无关，为固定的几次时间戳读取、一次原子加与一次 20 字节写入。
+ *
+ * @note @b 禁止 在中断服务函数中调用。
+ *
+ * @return uint32_t 每条记录的开销（时间戳单位）。
+ */
+uint32_t xf_osal_trace_calibrate(void);
+
+/**
+ * @brief 获取跟踪缓冲区，用于导出。
+ *
+ * @param[out] size 返回缓冲区大小（单位字节），可为 NULL.
+ * @return const xf_osal_trace_buf_t* 跟踪缓冲区。
+ */
+const xf_osal_trace_buf_t *xf_osal_trace_get_buffer(uint32_t *size);
+
+#endif /* XF_OSAL_TRACE_IS_ENABLE */
+
+/* 包装函数，由下方宏替换原接口调用，不要直接调用 */
+
+#if XF_OSAL_THREAD_IS_ENABLE
+xf_err_t xf_osal_trace_thread_yield(void);
+xf_err_t xf_osal_trace_thread_suspend(xf_osal_thread_t thread);
+xf_err_t xf_osal_trace_thread_resume(xf_osal_thread_t thread);
+xf_err_t xf_osal_trace_thread_notify_set(xf_osal_thread_t thread, uint32_t notify);
+xf_err_t xf_osal_trace_thread_notify_set_from_isr(xf_osal_thread_t thread, uint32_t notify);
+xf_err_t xf_osal_trace_thread_notify_wait(uint32_t notify, uint32_t options, uint32_t timeout);
+xf_err_t xf_osal_trace_delay(uint32_t ticks);
+xf_err_t xf_osal_trace_delay_until(uint32_t ticks);
+xf_err_t xf_osal_trace_delay_ms(uint32_t ms);
+#endif
+
+#if XF_OSAL_TIMER_IS_ENABLE
+xf_err_t xf_osal_trace_timer_start(xf_osal_timer_t timer, uint32_t ticks);
+xf_err_t xf_osal_trace_timer_stop(xf_osal_timer_t timer);
+#endif
+
+#if XF_OSAL_EVENT_IS_ENABLE
+xf_err_t xf_osal_trace_event_set(xf_osal_event_t event, uint32_t flags);
+xf_err_t xf_osal_trace_event_set_from_isr(xf_osal_event_t event, uint32_t flags);
+xf_err_t xf_osal_trace_event_clear(xf_osal_event_t event, uint32_t flags);
+xf_err_t xf_osal_trace_event_wait(xf_osal_event_t event, uint32_t flags, uint32_t options, uint32_t timeout);
+#endif
+
+#if XF_OSAL_MUTEX_IS_ENABLE
+xf_err_t xf_osal_trace_mutex_acquire(xf_osal_mutex_t mutex, uint32_t timeout);
+xf_err_t xf_osal_trace_mutex_release(xf_osal_mutex_t mutex);
+#endif
+
+#if XF_OSAL_MUTEX_PROFILE_IS_ENABLE
+xf_osal_mutex_t xf_osal_trace_mutex_create(const xf_osal_mutex_attr_t *attr);
+xf_err_t xf_osal_trace_mutex_delete(xf_osal_mutex_t mutex);
+#endif
+
+#if XF_OSAL_SEMAPHORE_IS_ENABLE
+xf_err_t xf_osal_trace_semaphore_acquire(xf_osal_semaphore_t semaphore, uint32_t timeout);
+xf_err_t xf_osal_trace_semaphore_release(xf_osal_semaphore_t semaphore);
+xf_err_t xf_osal_trace_semaphore_acquire_from_isr(xf_osal_semaphore_t semaphore);
+xf_err_t xf_osal_trace_semaphore_release_from_isr(xf_osal_semaphore_t semaphore);
+xf_err_t xf_osal_trace_semaphore_acquire_n(xf_osal_semaphore_t semaphore, uint32_t n, uint32_t timeout);
+xf_err_t xf_osal_trace_semaphore_release_n(xf_osal_semaphore_t semaphore, uint32_t n);
+#endif
+
+#if XF_OSAL_QUEUE_IS_ENABLE
+xf_err_t xf_osal_trace_queue_put(xf_osal_queue_t queue, const void *msg_ptr, uint8_t msg_prio, uint32_t timeout);
+xf_err_t xf_osal_trace_queue_get(xf_osal_queue_t queue, void *msg_ptr, uint8_t *msg_prio, uint32_t timeout);
+xf_err_t xf_osal_trace_queue_put_from_isr(xf_osal_queue_t queue, const void *msg_ptr, uint8_t msg_prio);
+xf_err_t xf_osal_trace_queue_get_from_isr(xf_osal_queue_t queue, void *msg_ptr, uint8_t *msg_prio);
+xf_err_t xf_osal_trace_queue_peek(xf_osal_queue_t queue, void *msg_ptr, uint32_t timeout);
+#endif
+
+#if XF_OSAL_COND_IS_ENABLE
+xf_err_t xf_osal_trace_cond_wait(xf_osal_cond_t cond, xf_osal_mutex_t mutex);
+xf_err_t xf_osal_trace_cond_timedwait(xf_osal_cond_t cond, xf_osal_mutex_t mutex, uint32_t timeout);
+xf_err_t xf_osal_trace_cond_signal(xf_osal_cond_t cond);
+xf_err_t xf_osal_trace_cond_broadcast(xf_osal_cond_t cond);
+#endif
+
+#if XF_OSAL_MSGBUF_IS_ENABLE
+xf_err_t xf_osal_trace_msgbuf_send(xf_osal_msgbuf_t msgbuf, const void *msg_ptr, uint32_t msg_len, uint32_t timeout);
+xf_err_t xf_osal_trace_msgbuf_receive(
+    xf_osal_msgbuf_t msgbuf, void *buf, uint32_t buf_size, uint32_t *msg_len, uint32_t timeout);
+#endif
+
+#if XF_OSAL_STREAMBUF_IS_ENABLE
+xf_err_t xf_osal_trace_streambuf_send(
+    xf_osal_streambuf_t streambuf, const void *data, uint32_t len, uint32_t *sent, uint32_t timeout);
+xf_err_t xf_osal_trace_streambuf_receive(
+    xf_osal_streambuf_t streambuf, void *buf, uint32_t buf_size, uint32_t *received, uint32_t timeout);
+#endif
+
+#if XF_OSAL_SELECT_IS_ENABLE
+xf_err_t xf_osal_trace_select(xf_osal_select_t select, void **ready, uint32_t timeout);
+#endif
+
+/* ==================== [Macros] ============================================ */
+
+/*
+ * 将接口调用重定向到包装函数。对接层与跟踪实现自身不重定向；
+ * 包装函数内以 (xf_osal_xxx)(...) 的形式调用原接口，括号阻止宏展开。
+ */
+#if !defined(XF_OSAL_PORT_SOURCE) && !defined(XF_OSAL_TRACE_SOURCE)
+
+#if XF_OSAL_THREAD_IS_ENABLE
+#define xf_osal_thread_yield()                              xf_osal_trace_thread_yield()
+#define xf_osal_thread_suspend(thread)                      xf_osal_trace_thread_suspend(thread)
+#define xf_osal_thread_resume(thread)                       xf_osal_trace_thread_resume(thread)
+#define xf_osal_thread_notify_set(thread, notify)           xf_osal_trace_thread_notify_set((thread), (notify))
+#define xf_osal_thread_notify_set_from_isr(thread, notify)  xf_osal_trace_thread_notify_set_from_isr((thread), (notify))
+#define xf_osal_thread_notify_wait(notify, options, timeout) \
+    xf_osal_trace_thread_notify_wait((notify), (options), (timeout))
+#define xf_osal_delay(ticks)                                xf_osal_trace_delay(ticks)
+#define xf_osal_delay_until(ticks)                          xf_osal_trace_delay_until(ticks)
+#define xf_osal_delay_ms(ms)                                xf_osal_trace_delay_ms(ms)
+#endif
+
+#if XF_OSAL_TIMER_IS_ENABLE
+#define xf_osal_timer_start(timer, ticks)                   xf_osal_trace_timer_start((timer), (ticks))
+#define xf_osal_timer_stop(timer)                           xf_osal_trace_timer_stop(timer)
+#endif
+
+#if XF_OSAL_EVENT_IS_ENABLE
+#define xf_osal_event_set(event, flags)                     xf_osal_trace_event_set((event), (flags))
+#define xf_osal_event_set_from_isr(event, flags)            xf_osal_trace_event_set_from_isr((event), (flags))
+#define xf_osal_event_clear(event, flags)                   xf_osal_trace_event_clear((event), (flags))
+#define xf_osal_event_wait(event, flags, options, timeout) \
+    xf_osal_trace_event_wait((event), (flags), (options), (timeout))
+#endif
+
+#if XF_OSAL_MUTEX_IS_ENABLE
+#define xf_osal_mutex_acquire(mutex, timeout)               xf_osal_trace_mutex_acquire((mutex), (timeout))
+#define xf_osal_mutex_release(mutex)                        xf_osal_trace_mutex_release(mutex)
+#endif
+
+#if XF_OSAL_MUTEX_PROFILE_IS_ENABLE
+#define xf_osal_mutex_create(attr)                          xf_osal_trace_mutex_create(attr)
+#define xf_osal_mutex_delete(mutex)                         xf_osal_trace_mutex_delete(mutex)
+#endif
+
+#if XF_OSAL_SEMAPHORE_IS_ENABLE
+#define xf_osal_semaphore_acquire(semaphore, timeout)       xf_osal_trace_semaphore_acquire((semaphore), (timeout))
+#define xf_osal_semaphore_release(semaphore)                xf_osal_trace_semaphore_release(semaphore)
+#define xf_osal_semaphore_acquire_from_isr(semaphore)       xf_osal_trace_semaphore_acquire_from_isr(semaphore)
+#define xf_osal_semaphore_release_from_isr(semaphore)       xf_osal_trace_semaphore_release_from_isr(semaphore)
+#define xf_osal_semaphore_acquire_n(semaphore, n, timeout)  xf_osal_trace_semaphore_acquire_n((semaphore), (n), (timeout))
+#define xf_osal_semaphore_release_n(semaphore, n)           xf_osal_trace_semaphore_release_n((semaphore), (n))
+#endif
+
+#if XF_OSAL_QUEUE_IS_ENABLE
+#define xf_osal_queue_put(queue, msg_ptr, msg_prio, timeout) \
+    xf_osal_trace_queue_put((queue), (msg_ptr), (msg_prio), (timeout))
+#define xf_osal_queue_get(queue, msg_ptr, msg_prio, timeout) \
+    xf_osal_trace_queue_get((queue), (msg_ptr), (msg_prio), (timeout))
+#define xf_osal_queue_put_from_isr(queue, msg_ptr, msg_prio) \
+    xf_osal_trace_queue_put_from_isr((queue), (msg_ptr), (msg_prio))
+#define xf_osal_queue_get_from_isr(queue, msg_ptr, msg_prio) \
+    xf_osal_trace_queue_get_from_isr((queue), (msg_ptr), (msg_prio))
+#define xf_osal_queue_peek(queue, msg_ptr, timeout)         xf_osal_trace_queue_peek((queue), (msg_ptr), (timeout))
+#endif
+
+#if XF_OSAL_COND_IS_ENABLE
+#define xf_osal_cond_wait(cond, mutex)                      xf_osal_trace_cond_wait((cond), (mutex))
+#define xf_osal_cond_timedwait(cond, mutex, timeout)        xf_osal_trace_cond_timedwait((cond), (mutex), (timeout))
+#define xf_osal_cond_signal(cond)                           xf_osal_trace_cond_signal(cond)
+#define xf_osal_cond_broadcast(cond)                        xf_osal_trace_cond_broadcast(cond)
+#endif
+
+#if XF_OSAL_MSGBUF_IS_ENABLE
+#define xf_osal_msgbuf_send(msgbuf, msg_ptr, msg_len, timeout) \
+    xf_osal_trace_msgbuf_send((msgbuf), (msg_ptr), (msg_len), (timeout))
+#define xf_osal_msgbuf_receive(msgbuf, buf, buf_size, msg_len, timeout) \
+    xf_osal_trace_msgbuf_receive((msgbuf), (buf), (buf_size), (msg_len), (timeout))
+#endif
+
+#if XF_OSAL_STREAMBUF_IS_ENABLE
+#define xf_osal_streambuf_send(streambuf, data, len, sent, timeout) \
+    xf_osal_trace_streambuf_send((streambuf), (data), (len), (sent), (timeout))
+#define xf_osal_streambuf_receive(streambuf, buf, buf_size, received, timeout) \
+    xf_osal_trace_streambuf_receive((streambuf), (buf), (buf_size), (received), (timeout))
+#endif
+
+#if XF_OSAL_SELECT_IS_ENABLE
+#define xf_osal_select(select, ready, timeout)              xf_osal_trace_select((select), (ready), (timeout))
+#endif
+
+#endif /* !XF_OSAL_PORT_SOURCE && !XF_OSAL_TRACE_SOURCE */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/**
+ * End of defgroup group_xf_osal_trace trace
+ * @}
+ */
+
+#endif // __XF_OSAL_TRACE_H__
+
+#endif // XF_OSAL_TRACE_WRAP_IS_ENABLE